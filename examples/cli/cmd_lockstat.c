@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/cli.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include "libmcu/lockstat.h"
+
+#define BUFSIZE				80
+
+static void print(struct cli_io const *io, const char *str)
+{
+	io->write(str, strnlen(str, BUFSIZE));
+}
+
+static uint64_t avg(uint64_t total, uint32_t count)
+{
+	return count? total / count : 0;
+}
+
+static void print_histogram(struct cli_io const *io, const char *label,
+		const uint32_t *histogram)
+{
+	char buf[BUFSIZE];
+
+	snprintf(buf, sizeof(buf), "  %s:", label);
+	print(io, buf);
+
+	for (unsigned int i = 0; i < LOCKSTAT_HISTOGRAM_BUCKETS; i++) {
+		if (histogram[i]) {
+			snprintf(buf, sizeof(buf), " %" PRIu64 "ns+=%" PRIu32,
+					lockstat_bucket_ns(i), histogram[i]);
+			print(io, buf);
+		}
+	}
+
+	print(io, "\n");
+}
+
+static void print_lock(const struct lockstat *stat, void *ctx)
+{
+	struct cli_io const *io = (struct cli_io const *)ctx;
+	char buf[BUFSIZE];
+
+	snprintf(buf, sizeof(buf), "%s: %" PRIu32 " acquired, %" PRIu32
+			" contended\n", stat->name,
+			stat->acquisitions, stat->contentions);
+	print(io, buf);
+	snprintf(buf, sizeof(buf), "  wait avg/max: %" PRIu64 "/%" PRIu64
+			"ns, hold avg/max: %" PRIu64 "/%" PRIu64 "ns\n",
+			avg(stat->wait_total_ns, stat->contentions),
+			stat->wait_max_ns,
+			avg(stat->hold_total_ns, stat->acquisitions),
+			stat->hold_max_ns);
+	print(io, buf);
+
+	print_histogram(io, "wait", stat->wait_histogram);
+	print_histogram(io, "hold", stat->hold_histogram);
+
+	for (unsigned int i = 0; i < LOCKSTAT_MAX_HOLDERS; i++) {
+		const struct lockstat_holder *holder = &stat->holders[i];
+
+		if (holder->count == 0) {
+			break;
+		}
+
+		snprintf(buf, sizeof(buf), "  holder %p: %" PRIu32
+				" times, %" PRIu64 "ns\n", holder->caller,
+				holder->count, holder->hold_ns);
+		print(io, buf);
+	}
+}
+
+DEFINE_CLI_CMD(lockstat, "Lock contention: lockstat [reset]") {
+	struct cli const *cli = (struct cli const *)env;
+
+	if (argc > 2) {
+		return CLI_CMD_INVALID_PARAM;
+	} else if (argc == 2) {
+		if (strcmp(argv[1], "reset") != 0) {
+			return CLI_CMD_INVALID_PARAM;
+		}
+		lockstat_reset();
+		return CLI_CMD_SUCCESS;
+	}
+
+	lockstat_iterate(print_lock, (void *)(uintptr_t)cli->io);
+
+	return CLI_CMD_SUCCESS;
+}
@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/cli.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "libmcu/profiler.h"
+
+#define BUFSIZE				40
+
+static int write_io(const void *data, size_t datasize, void *ctx)
+{
+	struct cli_io const *io = (struct cli_io const *)ctx;
+	return io->write(data, datasize);
+}
+
+static cli_cmd_error_t dump(struct cli_io const *io)
+{
+	char buf[BUFSIZE];
+
+	profiler_collect();
+
+	if (profiler_export_folded(write_io, (void *)(uintptr_t)io) < 0) {
+		return CLI_CMD_ERROR;
+	}
+
+	snprintf(buf, sizeof(buf), "dropped: %" PRIu32 "\n",
+			profiler_dropped());
+	io->write(buf, strnlen(buf, sizeof(buf)));
+
+	return CLI_CMD_SUCCESS;
+}
+
+DEFINE_CLI_CMD(prof, "Sampling profiler: prof start [hz]|stop|dump|reset") {
+	struct cli const *cli = (struct cli const *)env;
+
+	if (argc < 2 || argc > 3) {
+		return CLI_CMD_INVALID_PARAM;
+	}
+
+	if (strcmp(argv[1], "start") == 0) {
+		unsigned int hz = argc == 3?
+			(unsigned int)strtoul(argv[2], NULL, 10) : 0;
+		return profiler_start(hz) == 0? CLI_CMD_SUCCESS : CLI_CMD_ERROR;
+	} else if (argc == 3) {
+		return CLI_CMD_INVALID_PARAM;
+	} else if (strcmp(argv[1], "stop") == 0) {
+		profiler_stop();
+	} else if (strcmp(argv[1], "dump") == 0) {
+		return dump(cli->io);
+	} else if (strcmp(argv[1], "reset") == 0) {
+		profiler_reset();
+	} else {
+		return CLI_CMD_INVALID_PARAM;
+	}
+
+	return CLI_CMD_SUCCESS;
+}
@@ -14,9 +14,6 @@
 #undef MIN
 #define MIN(x, y)				((x) > (y)? (y) : (x))
 
-#if !defined(KVSTORE_MAX_KEY_LENGTH)
-#define KVSTORE_MAX_KEY_LENGTH			32
-#endif
 #if !defined(KVSTORE_MAX_NAMESPACE_LENGTH)
 #define KVSTORE_MAX_NAMESPACE_LENGTH		32
 #endif
@@ -92,7 +89,8 @@ static int memory_kvstore_write(struct kvstore *kvstore,
 
 		strcpy(entry->key, key);
 		entry->key[len] = '\0';
-		list_add(&entry->list, &kvstore->keylist_head);
+		/* appended to keep the keys in the order of creation */
+		list_add_tail(&entry->list, &kvstore->keylist_head);
 	}
 
 	memcpy(entry->value, value, size);
@@ -121,6 +119,26 @@ static int memory_kvstore_read(struct kvstore *kvstore,
 	return 0;
 }
 
+static int memory_kvstore_iterate(struct kvstore *kvstore, char const *prefix,
+		kvstore_iterate_cb_t cb, void *ctx)
+{
+	size_t len = prefix? strnlen(prefix, KVSTORE_MAX_KEY_LENGTH) : 0;
+	struct list *p;
+
+	list_for_each(p, &kvstore->keylist_head) {
+		struct memory_kvstore_entry const *entry =
+			list_entry(p, typeof(*entry), list);
+		if (strncmp(entry->key, prefix? prefix : "", len)) {
+			continue;
+		}
+		if (!(*cb)(entry->key, entry->value_size, ctx)) {
+			break;
+		}
+	}
+
+	return 0;
+}
+
 void memory_kvstore_destroy(struct kvstore *kvstore)
 {
 	struct list *p, *n;
@@ -158,6 +176,7 @@ struct kvstore *memory_kvstore_create(char const *ns)
 
 	p->api.write = memory_kvstore_write;
 	p->api.read = memory_kvstore_read;
+	p->api.iterate = memory_kvstore_iterate;
 	list_init(&p->keylist_head);
 	strcpy(p->namespace, ns);
 	p->namespace[len] = '\0';
@@ -12,6 +12,7 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <errno.h>
 
 #define adc_enable		libmcu_adc_enable
 #define adc_disable		libmcu_adc_disable
@@ -44,6 +45,14 @@ typedef enum {
 } adc_channel_t;
 
 struct adc;
+struct ringbuf;
+
+struct adc_stream_param {
+	/** channels to be sampled. A frame holds one sample per channel in
+	 * ascending order of channel */
+	adc_channel_t channels;
+	uint32_t sample_rate_hz;
+};
 
 struct adc_api {
 	int (*enable)(struct adc *self);
@@ -53,6 +62,10 @@ struct adc_api {
 	int (*measure)(struct adc *self);
 	int (*read)(struct adc *self, adc_channel_t channel);
 	int (*convert_to_millivolts)(struct adc *self, int value);
+	int (*stream_start)(struct adc *self,
+			const struct adc_stream_param *param,
+			struct ringbuf *ringbuf);
+	int (*stream_stop)(struct adc *self);
 };
 
 static inline int adc_enable(struct adc *self) {
@@ -83,6 +96,35 @@ static inline int adc_convert_to_millivolts(struct adc *self, int value) {
 	return ((struct adc_api *)self)->convert_to_millivolts(self, value);
 }
 
+/**
+ * @brief Start continuous acquisition into a ring buffer.
+ *
+ * Raw samples are written as uint16_t frames, e.g. by DMA on MCUs, without
+ * any call per sample. Frames that do not fit in @p ringbuf are dropped.
+ *
+ * @param[in] self The ADC instance.
+ * @param[in] param Channels and sampling rate.
+ * @param[in] ringbuf Ring buffer to receive the frames. It should be drained
+ *            fast enough, e.g. with @ref adc_pipeline_process.
+ *
+ * @return 0 on success, -ENOTSUP if the port does not support streaming,
+ *         other negative error code otherwise.
+ */
+static inline int adc_stream_start(struct adc *self,
+		const struct adc_stream_param *param, struct ringbuf *ringbuf) {
+	if (!((struct adc_api *)self)->stream_start) {
+		return -ENOTSUP;
+	}
+	return ((struct adc_api *)self)->stream_start(self, param, ringbuf);
+}
+
+static inline int adc_stream_stop(struct adc *self) {
+	if (!((struct adc_api *)self)->stream_stop) {
+		return -ENOTSUP;
+	}
+	return ((struct adc_api *)self)->stream_stop(self);
+}
+
 struct adc *adc_create(uint8_t adc_num);
 int adc_delete(struct adc *self);
 
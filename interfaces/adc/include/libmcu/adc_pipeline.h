@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_ADC_PIPELINE_H
+#define LIBMCU_ADC_PIPELINE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if !defined(ADC_PIPELINE_MAX_CHANNELS)
+#define ADC_PIPELINE_MAX_CHANNELS		8U
+#endif
+#if !defined(ADC_PIPELINE_MAX_CIC_ORDER)
+#define ADC_PIPELINE_MAX_CIC_ORDER		4U
+#endif
+
+struct ringbuf;
+struct adc_pipeline;
+
+struct adc_pipeline_param {
+	/** the number of samples in a frame streamed by @ref adc_stream_start */
+	uint8_t nr_channels;
+	/** the number of CIC integrator and comb stages. 1 makes it a moving
+	 * average decimator */
+	uint8_t cic_order;
+	/** the number of input frames per output frame */
+	uint16_t decimation;
+	/** the number of fractional bits of the outputs. Decimating by 4^n
+	 * with n fractional bits is oversampling by n bits of resolution */
+	uint8_t frac_bits;
+	/** the number of output frames in a min/max/mean window. 0 to
+	 * disable windowing */
+	uint16_t window_len;
+};
+
+struct adc_window {
+	int32_t min;
+	int32_t max;
+	int32_t mean;
+};
+
+/**
+ * @brief Create a decimation pipeline stage for streamed ADC samples.
+ *
+ * The DC gain of the CIC filter, decimation^cic_order, should not exceed
+ * 65536 so that the 32-bit integrators do not lose 16-bit samples.
+ *
+ * @param[in] param Pipeline parameters.
+ *
+ * @return A pointer to the pipeline on success, NULL otherwise.
+ */
+struct adc_pipeline *adc_pipeline_create(const struct adc_pipeline_param *param);
+void adc_pipeline_destroy(struct adc_pipeline *self);
+
+/**
+ * @brief Decimate the frames available in a ring buffer.
+ *
+ * Raw uint16_t frames are consumed from @p in and decimated int32_t frames in
+ * Q(frac_bits) fixed point are written to @p out. It stops early when @p out
+ * gets full, leaving the rest of the input for the next time.
+ *
+ * @param[in] self The pipeline.
+ * @param[in] in Ring buffer filled by @ref adc_stream_start.
+ * @param[in] out Ring buffer to receive the output frames. NULL when only the
+ *            windows are of interest.
+ *
+ * @return The number of output frames produced.
+ */
+size_t adc_pipeline_process(struct adc_pipeline *self,
+		struct ringbuf *in, struct ringbuf *out);
+
+/**
+ * @brief Get the min/max/mean of the last completed window of a channel.
+ *
+ * @param[in] self The pipeline.
+ * @param[in] index Channel index in a frame.
+ * @param[out] window The statistics in Q(frac_bits) fixed point.
+ *
+ * @return 0 on success, -EAGAIN if no window completed yet, -EINVAL on
+ *         invalid parameters.
+ */
+int adc_pipeline_get_window(const struct adc_pipeline *self,
+		uint8_t index, struct adc_window *window);
+
+/**
+ * @brief Reset the filter states and windows.
+ *
+ * @param[in] self The pipeline.
+ */
+void adc_pipeline_reset(struct adc_pipeline *self);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_ADC_PIPELINE_H */
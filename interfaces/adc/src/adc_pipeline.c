@@ -0,0 +1,259 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/adc_pipeline.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "libmcu/ringbuf.h"
+
+#define MAX_GAIN			(1UL << 16)
+#define MAX_FRAC_BITS			15U
+
+/* The integrators and combs wrap around in modular arithmetic, which is
+ * harmless to a CIC filter as long as the output fits in 32 bits. */
+struct channel {
+	uint32_t integrators[ADC_PIPELINE_MAX_CIC_ORDER];
+	uint32_t combs[ADC_PIPELINE_MAX_CIC_ORDER];
+
+	int64_t sum;
+	int32_t min;
+	int32_t max;
+
+	struct adc_window window;
+};
+
+struct adc_pipeline {
+	struct adc_pipeline_param param;
+	uint32_t gain;
+
+	uint16_t phase;
+	uint16_t window_count;
+	bool window_ready;
+
+	struct channel channels[];
+};
+
+static size_t input_frame_size(const struct adc_pipeline *self)
+{
+	return self->param.nr_channels * sizeof(uint16_t);
+}
+
+static size_t output_frame_size(const struct adc_pipeline *self)
+{
+	return self->param.nr_channels * sizeof(int32_t);
+}
+
+static bool has_room(const struct ringbuf *out, size_t size)
+{
+	return !out || (ringbuf_capacity(out) - ringbuf_length(out)) >= size;
+}
+
+static void integrate(struct adc_pipeline *self, struct channel *ch,
+		uint16_t sample)
+{
+	ch->integrators[0] += sample;
+
+	for (uint8_t i = 1; i < self->param.cic_order; i++) {
+		ch->integrators[i] += ch->integrators[i-1];
+	}
+}
+
+static int32_t comb(struct adc_pipeline *self, struct channel *ch)
+{
+	uint32_t acc = ch->integrators[self->param.cic_order - 1];
+
+	for (uint8_t i = 0; i < self->param.cic_order; i++) {
+		const uint32_t prev = ch->combs[i];
+		ch->combs[i] = acc;
+		acc -= prev;
+	}
+
+	return (int32_t)(((uint64_t)acc << self->param.frac_bits) /
+			self->gain);
+}
+
+static void update_window(struct adc_pipeline *self, struct channel *ch,
+		int32_t value)
+{
+	if (self->window_count == 0) {
+		ch->min = ch->max = value;
+		ch->sum = 0;
+	}
+
+	ch->min = value < ch->min? value : ch->min;
+	ch->max = value > ch->max? value : ch->max;
+	ch->sum += value;
+}
+
+static void close_window(struct adc_pipeline *self)
+{
+	if (++self->window_count < self->param.window_len) {
+		return;
+	}
+
+	for (uint8_t i = 0; i < self->param.nr_channels; i++) {
+		struct channel *ch = &self->channels[i];
+		ch->window.min = ch->min;
+		ch->window.max = ch->max;
+		ch->window.mean = (int32_t)(ch->sum / self->param.window_len);
+	}
+
+	self->window_count = 0;
+	self->window_ready = true;
+}
+
+/* Returns 1 when an output frame is produced, 0 when the frame is just
+ * integrated, or -ENOSPC when there is no room for the output. */
+static int process_frame(struct adc_pipeline *self, const uint8_t *frame,
+		struct ringbuf *out)
+{
+	int32_t outputs[ADC_PIPELINE_MAX_CHANNELS];
+	const bool emit = (self->phase + 1U) >= self->param.decimation;
+
+	if (emit && !has_room(out, output_frame_size(self))) {
+		return -ENOSPC;
+	}
+
+	for (uint8_t i = 0; i < self->param.nr_channels; i++) {
+		uint16_t sample;
+		memcpy(&sample, &frame[i * sizeof(sample)], sizeof(sample));
+		integrate(self, &self->channels[i], sample);
+	}
+
+	if (!emit) {
+		self->phase++;
+		return 0;
+	}
+
+	self->phase = 0;
+
+	for (uint8_t i = 0; i < self->param.nr_channels; i++) {
+		outputs[i] = comb(self, &self->channels[i]);
+		if (self->param.window_len) {
+			update_window(self, &self->channels[i], outputs[i]);
+		}
+	}
+
+	if (self->param.window_len) {
+		close_window(self);
+	}
+
+	if (out) {
+		ringbuf_write(out, outputs, output_frame_size(self));
+	}
+
+	return 1;
+}
+
+size_t adc_pipeline_process(struct adc_pipeline *self,
+		struct ringbuf *in, struct ringbuf *out)
+{
+	const size_t frame_size = input_frame_size(self);
+	size_t produced = 0;
+
+	while (ringbuf_length(in) >= frame_size) {
+		uint8_t tmp[ADC_PIPELINE_MAX_CHANNELS * sizeof(uint16_t)];
+		size_t contiguous = 0;
+		const uint8_t *p = (const uint8_t *)
+			ringbuf_peek_pointer(in, 0, &contiguous);
+		size_t consumed = 0;
+
+		if (contiguous < frame_size) {
+			/* a frame wrapping around the end of the buffer */
+			ringbuf_peek(in, 0, tmp, frame_size);
+			p = tmp;
+			contiguous = frame_size;
+		}
+
+		while (consumed + frame_size <= contiguous) {
+			const int rc = process_frame(self, &p[consumed], out);
+
+			if (rc < 0) {
+				ringbuf_consume(in, consumed);
+				return produced;
+			}
+
+			consumed += frame_size;
+			produced += (size_t)rc;
+		}
+
+		ringbuf_consume(in, consumed);
+	}
+
+	return produced;
+}
+
+int adc_pipeline_get_window(const struct adc_pipeline *self,
+		uint8_t index, struct adc_window *window)
+{
+	if (!self || !window || index >= self->param.nr_channels) {
+		return -EINVAL;
+	}
+
+	if (!self->window_ready) {
+		return -EAGAIN;
+	}
+
+	*window = self->channels[index].window;
+
+	return 0;
+}
+
+void adc_pipeline_reset(struct adc_pipeline *self)
+{
+	memset(self->channels, 0,
+			sizeof(self->channels[0]) * self->param.nr_channels);
+	self->phase = 0;
+	self->window_count = 0;
+	self->window_ready = false;
+}
+
+static uint32_t calc_gain(const struct adc_pipeline_param *param)
+{
+	uint64_t gain = 1;
+
+	for (uint8_t i = 0; i < param->cic_order && gain <= MAX_GAIN; i++) {
+		gain *= param->decimation;
+	}
+
+	return gain > MAX_GAIN? 0 : (uint32_t)gain;
+}
+
+struct adc_pipeline *adc_pipeline_create(const struct adc_pipeline_param *param)
+{
+	struct adc_pipeline *self;
+	uint32_t gain;
+
+	if (!param || !param->nr_channels ||
+			param->nr_channels > ADC_PIPELINE_MAX_CHANNELS ||
+			!param->cic_order ||
+			param->cic_order > ADC_PIPELINE_MAX_CIC_ORDER ||
+			!param->decimation ||
+			param->frac_bits > MAX_FRAC_BITS ||
+			(gain = calc_gain(param)) == 0) {
+		return NULL;
+	}
+
+	if ((self = (struct adc_pipeline *)calloc(1, sizeof(*self) +
+			sizeof(self->channels[0]) * param->nr_channels))
+			== NULL) {
+		return NULL;
+	}
+
+	self->param = *param;
+	self->gain = gain;
+
+	return self;
+}
+
+void adc_pipeline_destroy(struct adc_pipeline *self)
+{
+	free(self);
+}
@@ -0,0 +1,180 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_EVLOOP_H
+#define LIBMCU_EVLOOP_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#if !defined(EVLOOP_MAX_WATCHES)
+#define EVLOOP_MAX_WATCHES		32U
+#endif
+#if !defined(EVLOOP_POST_MAXLEN)
+#define EVLOOP_POST_MAXLEN		32U
+#endif
+
+#define EVLOOP_READ			(1U << 0)
+#define EVLOOP_WRITE			(1U << 1)
+/** error or hang-up. It gets reported whether asked or not */
+#define EVLOOP_ERROR			(1U << 2)
+
+#define EVLOOP_WAIT_FOREVER		UINT32_MAX
+
+struct evloop;
+struct evloop_timer;
+
+typedef void (*evloop_fd_callback_t)(struct evloop *loop,
+		int fd, uint32_t events, void *ctx);
+typedef void (*evloop_callback_t)(void *ctx);
+
+/**
+ * @brief Create an event loop.
+ *
+ * An event loop multiplexes file descriptors, timers and functions posted
+ * from other threads on the single thread running @ref evloop_run. All the
+ * callbacks get called in that thread, one at a time.
+ *
+ * @return Pointer to the event loop on success, NULL otherwise.
+ */
+struct evloop *evloop_create(void);
+
+/**
+ * @brief Destroy an event loop.
+ *
+ * Timers created on the loop should be destroyed beforehand. File descriptors
+ * added are not closed.
+ *
+ * @param[in] self The event loop.
+ */
+void evloop_destroy(struct evloop *self);
+
+/**
+ * @brief Run the event loop until @ref evloop_stop is called.
+ *
+ * @param[in] self The event loop.
+ *
+ * @return 0 when stopped, negative error code otherwise.
+ */
+int evloop_run(struct evloop *self);
+
+/**
+ * @brief Wait for events once and dispatch them.
+ *
+ * It is for running the loop as a part of another loop.
+ *
+ * @param[in] self The event loop.
+ * @param[in] timeout_ms Time to wait for events. @ref EVLOOP_WAIT_FOREVER to
+ *            wait until any event.
+ *
+ * @return The number of events dispatched, negative error code otherwise.
+ */
+int evloop_run_once(struct evloop *self, uint32_t timeout_ms);
+
+/**
+ * @brief Make @ref evloop_run return.
+ *
+ * It can be called from any thread.
+ *
+ * @param[in] self The event loop.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int evloop_stop(struct evloop *self);
+
+/**
+ * @brief Watch a file descriptor.
+ *
+ * @param[in] self The event loop.
+ * @param[in] fd The file descriptor to watch.
+ * @param[in] events Bitwise OR of @ref EVLOOP_READ and @ref EVLOOP_WRITE.
+ * @param[in] cb Callback to be called when any of @p events occurs.
+ * @param[in] ctx User context passed to @p cb.
+ *
+ * @return 0 on success. -EEXIST if @p fd is being watched already, -ENOSPC
+ *         when @ref EVLOOP_MAX_WATCHES reached, or negative error code.
+ */
+int evloop_add_fd(struct evloop *self, int fd, uint32_t events,
+		evloop_fd_callback_t cb, void *ctx);
+
+/**
+ * @brief Change the events to watch for a file descriptor.
+ *
+ * @param[in] self The event loop.
+ * @param[in] fd The file descriptor being watched.
+ * @param[in] events Bitwise OR of @ref EVLOOP_READ and @ref EVLOOP_WRITE.
+ *
+ * @return 0 on success, -ENOENT if @p fd is not being watched.
+ */
+int evloop_modify_fd(struct evloop *self, int fd, uint32_t events);
+
+/**
+ * @brief Stop watching a file descriptor.
+ *
+ * It is safe to call in any callback, even for a file descriptor with events
+ * pending in the same iteration.
+ *
+ * @param[in] self The event loop.
+ * @param[in] fd The file descriptor being watched.
+ *
+ * @return 0 on success, -ENOENT if @p fd is not being watched.
+ */
+int evloop_remove_fd(struct evloop *self, int fd);
+
+/**
+ * @brief Create a timer running on the event loop.
+ *
+ * Expirations missed while the loop is busy get coalesced into one callback.
+ *
+ * @param[in] self The event loop.
+ * @param[in] cb Callback to be called on expiration.
+ * @param[in] ctx User context passed to @p cb.
+ *
+ * @return Pointer to the timer on success, NULL otherwise.
+ */
+struct evloop_timer *evloop_timer_create(struct evloop *self,
+		evloop_callback_t cb, void *ctx);
+void evloop_timer_destroy(struct evloop_timer *timer);
+
+/**
+ * @brief Arm a timer.
+ *
+ * Arming an armed timer restarts it. It fits for the `update_alarm` callback
+ * of apptimer, with apptimer_schedule() called in @p cb.
+ *
+ * @param[in] timer The timer.
+ * @param[in] timeout_ms Time to the first expiration. 0 expires immediately.
+ * @param[in] interval_ms Period of the following expirations. 0 for one-shot.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int evloop_timer_start(struct evloop_timer *timer,
+		uint32_t timeout_ms, uint32_t interval_ms);
+int evloop_timer_stop(struct evloop_timer *timer);
+
+/**
+ * @brief Run a function in the event loop thread.
+ *
+ * It can be called from any thread. Schedulers such as ao or actor can post
+ * their dispatch function here instead of running a thread of their own.
+ *
+ * @param[in] self The event loop.
+ * @param[in] func The function to run.
+ * @param[in] ctx User context passed to @p func.
+ *
+ * @return 0 on success, -ENOSPC when @ref EVLOOP_POST_MAXLEN functions are
+ *         pending already.
+ */
+int evloop_post(struct evloop *self, evloop_callback_t func, void *ctx);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_EVLOOP_H */
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_FLASH_CACHE_H
+#define LIBMCU_FLASH_CACHE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "libmcu/flash.h"
+
+/*
+ * Flash on top of another flash, turning many small accesses into fewer
+ * page-sized ones.
+ *
+ * Reads are served from a cache of one page, filled a whole page at a time on
+ * a miss. Writes contiguous to the previous one within the same page are
+ * combined and programmed in a single call when written to another page,
+ * erased, read back or synced. Only the bytes actually written are programmed,
+ * never a padding, so it works on flash that does not allow programming the
+ * same location twice.
+ *
+ *	struct flash *flash = flash_cache_create(flash_create(0), 256);
+ *	struct kvstore *kvs = flash_kvstore_new(flash, scratch);
+ *
+ * @note Pending writes are lost on power loss until synced.
+ */
+
+/**
+ * @brief Create a cache in front of @p flash.
+ *
+ * @param[in] flash the flash to cache
+ * @param[in] page_size the program page size of @p flash, e.g. 256 for SPI
+ *            NOR. Two buffers of this size are allocated.
+ *
+ * @return the flash on success, NULL otherwise.
+ */
+struct flash *flash_cache_create(struct flash *flash, size_t page_size);
+
+/**
+ * @brief Write back the pending writes and free the cache.
+ */
+void flash_cache_delete(struct flash *cache);
+
+/**
+ * @brief Write back the pending writes.
+ *
+ * @return 0 on success, otherwise the error of the underlying flash.
+ */
+int flash_cache_sync(struct flash *cache);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_FLASH_CACHE_H */
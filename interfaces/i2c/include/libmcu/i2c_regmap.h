@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_I2C_REGMAP_H
+#define LIBMCU_I2C_REGMAP_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "libmcu/i2c.h"
+
+struct i2c_regmap;
+
+/**
+ * @brief Tell if a register may change without being written by the host.
+ *
+ * Volatile registers, e.g. status and data registers, are never cached and
+ * always accessed on the bus.
+ *
+ * @param[in] reg The register address.
+ * @param[in] ctx User context given in @ref i2c_regmap_param.
+ *
+ * @return true if the register is volatile, false otherwise.
+ */
+typedef bool (*i2c_regmap_volatile_t)(uint32_t reg, void *ctx);
+
+struct i2c_regmap_param {
+	/** register address width in bits, passed to @ref i2c_read_reg */
+	uint8_t reg_addr_bits;
+	/** the number of 8-bit registers, addressed from 0 to nr_regs - 1 */
+	uint16_t nr_regs;
+	/** the maximum number of bytes in a burst transfer. 0 for no limit */
+	uint16_t max_burst_len;
+	uint32_t timeout_ms;
+	/** NULL to treat all the registers as non-volatile */
+	i2c_regmap_volatile_t is_volatile;
+	void *is_volatile_ctx;
+};
+
+/**
+ * @brief Create a register map on top of an I2C device.
+ *
+ * The device is expected to auto-increment the register address so that
+ * adjacent registers can be accessed in a single burst transfer.
+ *
+ * @param[in] dev The I2C device.
+ * @param[in] param Register map parameters.
+ *
+ * @return A pointer to the register map on success, NULL otherwise.
+ */
+struct i2c_regmap *i2c_regmap_create(struct i2c_device *dev,
+		const struct i2c_regmap_param *param);
+void i2c_regmap_destroy(struct i2c_regmap *self);
+
+/**
+ * @brief Read consecutive registers.
+ *
+ * Cached registers are served from the shadow cache and the rest are read in
+ * as few burst transfers as possible.
+ *
+ * @param[in] self The register map.
+ * @param[in] reg The first register address.
+ * @param[out] buf Buffer to hold the register values.
+ * @param[in] len The number of registers to read.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int i2c_regmap_read(struct i2c_regmap *self,
+		uint32_t reg, void *buf, size_t len);
+
+/**
+ * @brief Write consecutive registers.
+ *
+ * Non-volatile registers are only marked dirty in the shadow cache while
+ * writes are deferred by @ref i2c_regmap_defer. Otherwise the registers are
+ * written in a single burst transfer.
+ *
+ * @param[in] self The register map.
+ * @param[in] reg The first register address.
+ * @param[in] data The register values.
+ * @param[in] len The number of registers to write.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int i2c_regmap_write(struct i2c_regmap *self,
+		uint32_t reg, const void *data, size_t len);
+
+/**
+ * @brief Read-modify-write a register.
+ *
+ * Nothing goes out to the bus when the value is not changed.
+ *
+ * @param[in] self The register map.
+ * @param[in] reg The register address.
+ * @param[in] mask Bits to be updated.
+ * @param[in] val New value of the bits in @p mask.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int i2c_regmap_update_bits(struct i2c_regmap *self,
+		uint32_t reg, uint8_t mask, uint8_t val);
+
+/**
+ * @brief Start deferring writes to non-volatile registers.
+ *
+ * The deferred writes go out on @ref i2c_regmap_flush.
+ *
+ * @param[in] self The register map.
+ */
+void i2c_regmap_defer(struct i2c_regmap *self);
+
+/**
+ * @brief Write out the dirty registers and stop deferring writes.
+ *
+ * Dirty registers are coalesced into burst transfers. A gap of clean cached
+ * registers between dirty ones is rewritten with the cached values rather
+ * than splitting the transfer.
+ *
+ * @param[in] self The register map.
+ *
+ * @return 0 on success, negative error code otherwise. The registers failed
+ *         to write remain dirty and writes keep being deferred.
+ */
+int i2c_regmap_flush(struct i2c_regmap *self);
+
+/**
+ * @brief Drop the shadow cache, e.g. after the device is reset.
+ *
+ * Dirty registers not flushed yet are discarded as well.
+ *
+ * @param[in] self The register map.
+ */
+void i2c_regmap_invalidate(struct i2c_regmap *self);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_I2C_REGMAP_H */
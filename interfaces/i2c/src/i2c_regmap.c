@@ -0,0 +1,292 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/i2c_regmap.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#define REG_VALID			(1U << 0)
+#define REG_DIRTY			(1U << 1)
+#define REG_VOLATILE			(1U << 2)
+
+struct i2c_regmap {
+	struct i2c_device *dev;
+	struct i2c_regmap_param param;
+
+	uint8_t *cache;
+	uint8_t *flags;
+
+	bool deferred;
+};
+
+static bool is_cached(const struct i2c_regmap *self, uint32_t reg)
+{
+	return (self->flags[reg] & (REG_VALID | REG_VOLATILE)) == REG_VALID;
+}
+
+static bool is_volatile(const struct i2c_regmap *self, uint32_t reg)
+{
+	return (self->flags[reg] & REG_VOLATILE) != 0;
+}
+
+static bool is_dirty(const struct i2c_regmap *self, uint32_t reg)
+{
+	return (self->flags[reg] & REG_DIRTY) != 0;
+}
+
+static bool is_in_range(const struct i2c_regmap *self, uint32_t reg, size_t len)
+{
+	return len && reg < self->param.nr_regs &&
+		len <= (size_t)(self->param.nr_regs - reg);
+}
+
+static size_t limit_burst(const struct i2c_regmap *self, size_t len)
+{
+	if (self->param.max_burst_len && len > self->param.max_burst_len) {
+		return self->param.max_burst_len;
+	}
+
+	return len;
+}
+
+static int read_burst(struct i2c_regmap *self,
+		uint32_t reg, uint8_t *buf, size_t len)
+{
+	while (len) {
+		const size_t n = limit_burst(self, len);
+		const int err = i2c_read_reg(self->dev, reg,
+				self->param.reg_addr_bits,
+				buf, n, self->param.timeout_ms);
+
+		if (err < 0) {
+			return err;
+		}
+
+		reg += (uint32_t)n;
+		buf += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+static int write_burst(struct i2c_regmap *self,
+		uint32_t reg, const uint8_t *data, size_t len)
+{
+	while (len) {
+		const size_t n = limit_burst(self, len);
+		const int err = i2c_write_reg(self->dev, reg,
+				self->param.reg_addr_bits,
+				data, n, self->param.timeout_ms);
+
+		if (err < 0) {
+			return err;
+		}
+
+		for (uint32_t i = reg; i < reg + n; i++) {
+			self->flags[i] &= (uint8_t)~REG_DIRTY;
+		}
+
+		reg += (uint32_t)n;
+		data += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+static void invalidate_range(struct i2c_regmap *self, uint32_t reg, size_t len)
+{
+	for (uint32_t i = reg; i < reg + len; i++) {
+		self->flags[i] &= (uint8_t)~(REG_VALID | REG_DIRTY);
+	}
+}
+
+/* The span from the first to the last uncached register is read in a single
+ * burst. Registers cached in between get overwritten by the cached values
+ * afterward as the cache may hold dirty values not written yet. */
+int i2c_regmap_read(struct i2c_regmap *self,
+		uint32_t reg, void *buf, size_t len)
+{
+	uint8_t *p = (uint8_t *)buf;
+	uint32_t first = reg + (uint32_t)len;
+	uint32_t last = reg;
+
+	if (!self || !buf || !is_in_range(self, reg, len)) {
+		return -EINVAL;
+	}
+
+	for (uint32_t i = reg; i < reg + len; i++) {
+		if (!is_cached(self, i)) {
+			first = i < first? i : first;
+			last = i;
+		}
+	}
+
+	if (first <= last) {
+		const int err = read_burst(self, first,
+				&p[first - reg], last - first + 1);
+		if (err) {
+			return err;
+		}
+	}
+
+	for (uint32_t i = reg; i < reg + len; i++) {
+		if (is_cached(self, i)) {
+			p[i - reg] = self->cache[i];
+		} else if (!is_volatile(self, i)) {
+			self->cache[i] = p[i - reg];
+			self->flags[i] |= REG_VALID;
+		}
+	}
+
+	return 0;
+}
+
+int i2c_regmap_write(struct i2c_regmap *self,
+		uint32_t reg, const void *data, size_t len)
+{
+	bool has_volatile = false;
+
+	if (!self || !data || !is_in_range(self, reg, len)) {
+		return -EINVAL;
+	}
+
+	memcpy(&self->cache[reg], data, len);
+
+	for (uint32_t i = reg; i < reg + len; i++) {
+		if (is_volatile(self, i)) {
+			has_volatile = true;
+		} else {
+			self->flags[i] |= REG_VALID | REG_DIRTY;
+		}
+	}
+
+	if (self->deferred && !has_volatile) {
+		return 0;
+	}
+
+	const int err = write_burst(self, reg, (const uint8_t *)data, len);
+
+	if (err) {
+		/* the device state is unknown after a partial write */
+		invalidate_range(self, reg, len);
+	}
+
+	return err;
+}
+
+int i2c_regmap_update_bits(struct i2c_regmap *self,
+		uint32_t reg, uint8_t mask, uint8_t val)
+{
+	uint8_t old;
+	int err;
+
+	if ((err = i2c_regmap_read(self, reg, &old, 1)) != 0) {
+		return err;
+	}
+
+	const uint8_t updated = (uint8_t)((old & ~mask) | (val & mask));
+
+	if (updated == old && !is_volatile(self, reg)) {
+		return 0;
+	}
+
+	return i2c_regmap_write(self, reg, &updated, 1);
+}
+
+void i2c_regmap_defer(struct i2c_regmap *self)
+{
+	self->deferred = true;
+}
+
+/* A burst is extended over clean cached registers as long as another dirty
+ * register follows within the burst length limit. */
+static size_t get_flush_len(const struct i2c_regmap *self, uint32_t start)
+{
+	const size_t maxlen = limit_burst(self,
+			(size_t)(self->param.nr_regs - start));
+	size_t len = 1;
+
+	for (size_t i = 1; i < maxlen; i++) {
+		const uint32_t reg = start + (uint32_t)i;
+
+		if (is_dirty(self, reg)) {
+			len = i + 1;
+		} else if (!is_cached(self, reg)) {
+			break;
+		}
+	}
+
+	return len;
+}
+
+int i2c_regmap_flush(struct i2c_regmap *self)
+{
+	uint32_t reg = 0;
+
+	while (reg < self->param.nr_regs) {
+		if (!is_dirty(self, reg)) {
+			reg++;
+			continue;
+		}
+
+		const size_t len = get_flush_len(self, reg);
+		const int err = write_burst(self, reg, &self->cache[reg], len);
+
+		if (err) {
+			return err;
+		}
+
+		reg += (uint32_t)len;
+	}
+
+	self->deferred = false;
+
+	return 0;
+}
+
+void i2c_regmap_invalidate(struct i2c_regmap *self)
+{
+	invalidate_range(self, 0, self->param.nr_regs);
+}
+
+struct i2c_regmap *i2c_regmap_create(struct i2c_device *dev,
+		const struct i2c_regmap_param *param)
+{
+	struct i2c_regmap *self;
+
+	if (!dev || !param || !param->nr_regs) {
+		return NULL;
+	}
+
+	if ((self = (struct i2c_regmap *)calloc(1, sizeof(*self) +
+			(size_t)param->nr_regs * 2)) == NULL) {
+		return NULL;
+	}
+
+	self->dev = dev;
+	self->param = *param;
+	self->cache = (uint8_t *)&self[1];
+	self->flags = &self->cache[param->nr_regs];
+
+	if (param->is_volatile) {
+		for (uint32_t i = 0; i < param->nr_regs; i++) {
+			if ((*param->is_volatile)(i, param->is_volatile_ctx)) {
+				self->flags[i] = REG_VOLATILE;
+			}
+		}
+	}
+
+	return self;
+}
+
+void i2c_regmap_destroy(struct i2c_regmap *self)
+{
+	free(self);
+}
@@ -14,6 +14,17 @@ extern "C" {
 #include "libmcu/kvstore.h"
 #include "libmcu/flash.h"
 
+/**
+ * @brief Create a key-value store on a flash partition.
+ *
+ * @ref kvstore_iterate is supported only when built with
+ * FLASH_KVSTORE_KEY_NAMES, which keeps the key names in the partition at the
+ * cost of one more meta entry per key. Keys written without it or longer than
+ * KVSTORE_MAX_KEY_LENGTH are not enumerated.
+ *
+ * @param[in] flash partition to keep the keys and values
+ * @param[in] scratch partition used to reclaim space. NULL if none.
+ */
 struct kvstore *flash_kvstore_new(struct flash *flash, struct flash *scratch);
 
 #if defined(__cplusplus)
@@ -11,10 +11,27 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <errno.h>
+
+#if !defined(KVSTORE_MAX_KEY_LENGTH)
+#define KVSTORE_MAX_KEY_LENGTH			32
+#endif
 
 struct kvstore;
 
+/**
+ * @brief Called for each key found by @ref kvstore_iterate.
+ *
+ * @param[in] key null-terminated key
+ * @param[in] size size of the value in bytes
+ * @param[in] ctx context given to @ref kvstore_iterate
+ *
+ * @return true to continue, false to stop the iteration.
+ */
+typedef bool (*kvstore_iterate_cb_t)(char const *key, size_t size, void *ctx);
+
 struct kvstore_api {
 	int (*write)(struct kvstore *self,
 			char const *key, void const *value, size_t size);
@@ -23,6 +40,8 @@ struct kvstore_api {
 	int (*clear)(struct kvstore *self, char const *key);
 	int (*open)(struct kvstore *self, char const *ns);
 	void (*close)(struct kvstore *self);
+	int (*iterate)(struct kvstore *self, char const *prefix,
+			kvstore_iterate_cb_t cb, void *ctx);
 };
 
 static inline int kvstore_open(struct kvstore *self, char const *ns) {
@@ -47,6 +66,25 @@ static inline int kvstore_clear(struct kvstore *self, char const *key) {
 	return ((struct kvstore_api *)self)->clear(self, key);
 }
 
+/**
+ * @brief Iterate over the keys starting with @p prefix.
+ *
+ * The order follows the implementation. Reading the values in the callback is
+ * allowed, but writing or clearing is not.
+ *
+ * @param[in] prefix prefix of the keys. NULL or "" for all the keys.
+ *
+ * @return 0 on success, -ENOTSUP if the implementation does not support it or
+ *         other negative errno on failure.
+ */
+static inline int kvstore_iterate(struct kvstore *self, char const *prefix,
+		kvstore_iterate_cb_t cb, void *ctx) {
+	if (!((struct kvstore_api *)self)->iterate) {
+		return -ENOTSUP;
+	}
+	return ((struct kvstore_api *)self)->iterate(self, prefix, cb, ctx);
+}
+
 #if defined(__cplusplus)
 }
 #endif
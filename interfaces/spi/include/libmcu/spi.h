@@ -34,6 +34,30 @@ struct spi_pin {
 struct spi;
 struct spi_device;
 
+/**
+ * @brief A single transfer in a transaction list.
+ *
+ * @p tx_len bytes of @p tx are written first, then @p rx_len bytes are read
+ * into @p rx. Either one can be omitted by giving NULL and 0.
+ */
+struct spi_xfer {
+	const void *tx;
+	size_t tx_len;
+	void *rx;
+	size_t rx_len;
+};
+
+/**
+ * @brief Completion callback of a transaction list.
+ *
+ * @param[in] dev The SPI device the list was submitted to.
+ * @param[in] err 0 when all the transfers are done, otherwise the error code
+ *            of the first transfer failed. The transfers after the failed one
+ *            are not performed.
+ * @param[in] ctx User context given to @ref spi_submit.
+ */
+typedef void (*spi_done_cb_t)(struct spi_device *dev, int err, void *ctx);
+
 /**
  * @brief Create a SPI instance.
  *
@@ -144,6 +168,30 @@ int spi_writeread(struct spi_device *dev,
 		const void *txdata, size_t txdata_len,
 		void *rxbuf, size_t rx_len);
 
+/**
+ * @brief Submit a list of transfers to a SPI device.
+ *
+ * The transfers are performed in order and @p done_cb gets called once all of
+ * them are done or on the first failure. Ports may chain the transfers, e.g.
+ * with DMA descriptors, and complete asynchronously. The generic
+ * implementation performs them one by one with the blocking calls and calls
+ * @p done_cb before returning.
+ *
+ * @note @p xfers and the buffers it points to should stay valid until
+ *       @p done_cb gets called.
+ *
+ * @param[in] dev The SPI device.
+ * @param[in] xfers The list of transfers.
+ * @param[in] n The number of transfers in @p xfers.
+ * @param[in] done_cb Completion callback. NULL if not needed.
+ * @param[in] cb_ctx User context passed to @p done_cb.
+ *
+ * @return 0 when the list is accepted, otherwise a negative error code.
+ */
+int spi_submit(struct spi_device *dev,
+		const struct spi_xfer *xfers, size_t n,
+		spi_done_cb_t done_cb, void *cb_ctx);
+
 #if defined(__cplusplus)
 }
 #endif
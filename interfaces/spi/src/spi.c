@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/spi.h"
+#include "libmcu/compiler.h"
+
+#include <errno.h>
+
+static int transfer(struct spi_device *dev, const struct spi_xfer *xfer)
+{
+	if (xfer->tx_len && xfer->rx_len) {
+		return spi_writeread(dev, xfer->tx, xfer->tx_len,
+				xfer->rx, xfer->rx_len);
+	} else if (xfer->tx_len) {
+		return spi_write(dev, xfer->tx, xfer->tx_len);
+	} else if (xfer->rx_len) {
+		return spi_read(dev, xfer->rx, xfer->rx_len);
+	}
+
+	return 0;
+}
+
+LIBMCU_WEAK
+int spi_submit(struct spi_device *dev,
+		const struct spi_xfer *xfers, size_t n,
+		spi_done_cb_t done_cb, void *cb_ctx)
+{
+	int err = 0;
+
+	if (!dev || (!xfers && n)) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		const int rc = transfer(dev, &xfers[i]);
+
+		if (rc < 0) {
+			err = rc;
+			break;
+		}
+	}
+
+	if (done_cb) {
+		(*done_cb)(dev, err, cb_ctx);
+	}
+
+	return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_UART_RX_H
+#define LIBMCU_UART_RX_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "libmcu/uart.h"
+#include "libmcu/ringbuf.h"
+
+#if !defined(UART_RX_MAX_IDLE_FRAMES)
+#define UART_RX_MAX_IDLE_FRAMES			8U /* should be power of 2 */
+#endif
+
+struct uart_rx_param {
+	/** a frame ends when no byte is received for this time. 0 to
+	 * disable */
+	uint32_t idle_gap_ms;
+	/** a frame ends with @ref delimiter when true */
+	bool use_delimiter;
+	uint8_t delimiter;
+};
+
+struct uart_rx_stats {
+	/** bytes accepted into the ring */
+	size_t received;
+	/** bytes dropped as the ring was full */
+	size_t dropped;
+	/** the number of times bytes got dropped */
+	uint32_t overruns;
+	/** the maximum number of bytes held in the ring */
+	size_t high_water;
+};
+
+/**
+ * @brief RX ring shared between a port, the producer, and an application, the
+ *        consumer.
+ *
+ * A port pushes received bytes from an ISR, a DMA completion or a reader
+ * thread while a single consumer takes them out. Both sides may run
+ * concurrently without a lock. The members are private.
+ */
+struct uart_rx {
+	struct ringbuf ringbuf;
+	struct uart_rx_param param;
+	struct uart_rx_stats stats;
+
+	/* producer side */
+	volatile size_t total;
+	volatile unsigned long last_rx_ms;
+	size_t idle_frames[UART_RX_MAX_IDLE_FRAMES];
+	volatile size_t idle_frames_index;
+	size_t idle_framed;
+
+	/* consumer side */
+	volatile size_t idle_frames_outdex;
+	size_t consumed;
+	size_t scanned;
+};
+
+/**
+ * @brief Initialize a UART RX ring on the given buffer.
+ *
+ * @param[in] self The RX ring.
+ * @param[in] buf Buffer to hold the received bytes. The size gets rounded
+ *            down to a power of 2.
+ * @param[in] bufsize The size of @p buf.
+ * @param[in] param Framing parameters. NULL for no framing.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int uart_rx_init(struct uart_rx *self, void *buf, size_t bufsize,
+		const struct uart_rx_param *param);
+
+/**
+ * @brief Change the framing parameters. Called by the consumer.
+ *
+ * @param[in] self The RX ring.
+ * @param[in] param Framing parameters.
+ */
+void uart_rx_configure(struct uart_rx *self, const struct uart_rx_param *param);
+
+/**
+ * @brief Put received bytes into the ring. Called by the producer.
+ *
+ * Bytes that do not fit are dropped and counted as an overrun.
+ *
+ * @param[in] self The RX ring.
+ * @param[in] data Received bytes.
+ * @param[in] len The number of bytes in @p data.
+ *
+ * @return The number of bytes accepted.
+ */
+size_t uart_rx_push(struct uart_rx *self, const void *data, size_t len);
+
+/**
+ * @brief Get the number of bytes received but not consumed yet.
+ *
+ * @param[in] self The RX ring.
+ *
+ * @return The number of bytes in the ring.
+ */
+size_t uart_rx_length(const struct uart_rx *self);
+
+/**
+ * @brief Access received bytes in place without copying.
+ *
+ * @param[in] self The RX ring.
+ * @param[in] offset Offset from the oldest byte.
+ * @param[out] contiguous The number of bytes accessible from the pointer
+ *             returned. The rest wraps around to the beginning of the ring.
+ *
+ * @return A pointer to the bytes, NULL if @p offset is out of the data.
+ */
+const void *uart_rx_peek(const struct uart_rx *self,
+		size_t offset, size_t *contiguous);
+
+/**
+ * @brief Discard the oldest bytes after processing them in place.
+ *
+ * @param[in] self The RX ring.
+ * @param[in] len The number of bytes to consume.
+ */
+void uart_rx_consume(struct uart_rx *self, size_t len);
+
+/**
+ * @brief Copy out and consume the oldest bytes.
+ *
+ * @param[in] self The RX ring.
+ * @param[out] buf Buffer to copy the bytes into.
+ * @param[in] bufsize The size of @p buf.
+ *
+ * @return The number of bytes copied.
+ */
+size_t uart_rx_read(struct uart_rx *self, void *buf, size_t bufsize);
+
+/**
+ * @brief Get the length of the oldest complete frame.
+ *
+ * A frame completes with the delimiter, included in the frame, or with an
+ * idle gap. The frame can be accessed with @ref uart_rx_peek and then
+ * released with @ref uart_rx_consume.
+ *
+ * @param[in] self The RX ring.
+ *
+ * @return The frame length in bytes, 0 if no frame completed yet.
+ */
+size_t uart_rx_frame(struct uart_rx *self);
+
+/**
+ * @brief Discard all the bytes in the ring. Called by the consumer.
+ *
+ * @param[in] self The RX ring.
+ */
+void uart_rx_clear(struct uart_rx *self);
+
+void uart_rx_get_stats(const struct uart_rx *self,
+		struct uart_rx_stats *stats);
+void uart_rx_reset_stats(struct uart_rx *self);
+
+/**
+ * @brief Get the RX ring of a UART instance.
+ *
+ * Ports built on the RX ring override it. The default returns NULL.
+ *
+ * @param[in] uart The UART instance.
+ *
+ * @return The RX ring, NULL if the port does not use it.
+ */
+struct uart_rx *uart_rx_get(struct uart *uart);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_UART_RX_H */
@@ -0,0 +1,232 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/uart_rx.h"
+
+#include <string.h>
+#include <errno.h>
+#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#endif
+
+#include "libmcu/board.h"
+#include "libmcu/compiler.h"
+
+#define IDLE_FRAMES_MASK		(UART_RX_MAX_IDLE_FRAMES - 1)
+
+static void release(void)
+{
+#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+	atomic_thread_fence(memory_order_release);
+#endif
+}
+
+static void acquire(void)
+{
+#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+	atomic_thread_fence(memory_order_acquire);
+#endif
+}
+
+static bool is_idle(const struct uart_rx *self, unsigned long now)
+{
+	return self->param.idle_gap_ms &&
+		(now - self->last_rx_ms) >= self->param.idle_gap_ms;
+}
+
+/* Records the end of the frame received so far when a new burst of bytes
+ * starts after an idle gap. The frame merges into the next one when the queue
+ * is full. */
+static void mark_idle_frame(struct uart_rx *self, unsigned long now)
+{
+	const size_t index = self->idle_frames_index;
+
+	if (self->total == self->idle_framed || !is_idle(self, now)) {
+		return;
+	}
+
+	self->idle_framed = self->total;
+
+	if (index - self->idle_frames_outdex >= UART_RX_MAX_IDLE_FRAMES) {
+		return;
+	}
+
+	self->idle_frames[index & IDLE_FRAMES_MASK] = self->total;
+	release();
+	self->idle_frames_index = index + 1;
+}
+
+size_t uart_rx_push(struct uart_rx *self, const void *data, size_t len)
+{
+	const unsigned long now = board_get_time_since_boot_ms();
+
+	mark_idle_frame(self, now);
+
+	const size_t accepted = ringbuf_write(&self->ringbuf, data, len);
+	const size_t length = ringbuf_length(&self->ringbuf);
+
+	if (accepted < len) {
+		self->stats.dropped += len - accepted;
+		self->stats.overruns++;
+	}
+
+	self->stats.received += accepted;
+
+	if (length > self->stats.high_water) {
+		self->stats.high_water = length;
+	}
+
+	self->last_rx_ms = now;
+	release();
+	self->total += accepted;
+
+	return accepted;
+}
+
+/* Returns 0 when no idle gap has been detected. Stale entries, ends of frames
+ * already consumed, get dropped. */
+static size_t get_idle_frame(struct uart_rx *self, size_t len)
+{
+	while (self->idle_frames_outdex != self->idle_frames_index) {
+		acquire();
+		const size_t end = self->idle_frames[self->idle_frames_outdex
+				& IDLE_FRAMES_MASK];
+		const size_t frame = end - self->consumed;
+
+		if (frame && frame <= len) {
+			return frame;
+		}
+
+		self->idle_frames_outdex++;
+	}
+
+	if (self->param.idle_gap_ms) {
+		const size_t total = self->total;
+		acquire();
+		if (total != self->consumed &&
+				is_idle(self, board_get_time_since_boot_ms())) {
+			return total - self->consumed;
+		}
+	}
+
+	return 0;
+}
+
+static size_t find_delimiter(struct uart_rx *self, size_t len)
+{
+	while (self->scanned < len) {
+		size_t contiguous;
+		const uint8_t *p = (const uint8_t *)ringbuf_peek_pointer(
+				&self->ringbuf, self->scanned, &contiguous);
+		const size_t n = len - self->scanned < contiguous?
+				len - self->scanned : contiguous;
+		const uint8_t *found = (const uint8_t *)
+				memchr(p, self->param.delimiter, n);
+
+		if (found) {
+			return self->scanned + (size_t)(found - p) + 1;
+		}
+
+		self->scanned += n;
+	}
+
+	return 0;
+}
+
+size_t uart_rx_frame(struct uart_rx *self)
+{
+	const size_t len = ringbuf_length(&self->ringbuf);
+	const size_t idle = get_idle_frame(self, len);
+
+	if (self->param.use_delimiter) {
+		const size_t delimited = find_delimiter(self, idle? idle : len);
+		if (delimited) {
+			return delimited;
+		}
+	}
+
+	return idle;
+}
+
+size_t uart_rx_length(const struct uart_rx *self)
+{
+	return ringbuf_length(&self->ringbuf);
+}
+
+const void *uart_rx_peek(const struct uart_rx *self,
+		size_t offset, size_t *contiguous)
+{
+	return ringbuf_peek_pointer(&self->ringbuf, offset, contiguous);
+}
+
+void uart_rx_consume(struct uart_rx *self, size_t len)
+{
+	const size_t available = ringbuf_length(&self->ringbuf);
+
+	len = len > available? available : len;
+
+	ringbuf_consume(&self->ringbuf, len);
+	self->consumed += len;
+	self->scanned = self->scanned > len? self->scanned - len : 0;
+}
+
+size_t uart_rx_read(struct uart_rx *self, void *buf, size_t bufsize)
+{
+	const size_t len = ringbuf_peek(&self->ringbuf, 0, buf, bufsize);
+	uart_rx_consume(self, len);
+	return len;
+}
+
+void uart_rx_clear(struct uart_rx *self)
+{
+	uart_rx_consume(self, ringbuf_length(&self->ringbuf));
+}
+
+void uart_rx_get_stats(const struct uart_rx *self,
+		struct uart_rx_stats *stats)
+{
+	*stats = self->stats;
+}
+
+void uart_rx_reset_stats(struct uart_rx *self)
+{
+	memset(&self->stats, 0, sizeof(self->stats));
+}
+
+void uart_rx_configure(struct uart_rx *self, const struct uart_rx_param *param)
+{
+	self->param = *param;
+	self->scanned = 0;
+}
+
+int uart_rx_init(struct uart_rx *self, void *buf, size_t bufsize,
+		const struct uart_rx_param *param)
+{
+	if (!self || !buf || !bufsize) {
+		return -EINVAL;
+	}
+
+	memset(self, 0, sizeof(*self));
+
+	if (!ringbuf_create_static(&self->ringbuf, buf, bufsize)) {
+		return -EINVAL;
+	}
+
+	if (param) {
+		self->param = *param;
+	}
+
+	self->last_rx_ms = board_get_time_since_boot_ms();
+
+	return 0;
+}
+
+LIBMCU_WEAK
+struct uart_rx *uart_rx_get(struct uart *uart)
+{
+	unused(uart);
+	return NULL;
+}
@@ -25,6 +25,12 @@ int actor_timer_start(struct actor_timer *timer);
 int actor_timer_stop(struct actor_timer *timer);
 
 int actor_timer_step(uint32_t elapsed_ms);
+/**
+ * @brief Get the time left until the earliest armed timer expires.
+ *
+ * @return The time left in milliseconds, or UINT32_MAX if no timer is armed.
+ */
+uint32_t actor_timer_next_deadline_ms(void);
 
 size_t actor_timer_cap(void);
 size_t actor_timer_len(void);
@@ -191,6 +191,24 @@ int actor_timer_step(uint32_t elapsed_ms)
 	return 0;
 }
 
+uint32_t actor_timer_next_deadline_ms(void)
+{
+	uint32_t earliest = UINT32_MAX;
+	struct list *p;
+
+	actor_lock();
+	list_for_each(p, &m.timer_armed) {
+		const struct actor_timer *timer =
+			list_entry(p, struct actor_timer, link);
+		if (timer->timeout_ms < earliest) {
+			earliest = timer->timeout_ms;
+		}
+	}
+	actor_unlock();
+
+	return earliest;
+}
+
 int actor_timer_init(void *mem, size_t memsize)
 {
 	const size_t mask = sizeof(uintptr_t) - 1;
@@ -28,6 +28,12 @@ int ao_timer_cancel(const struct ao * const ao,
 bool ao_timer_is_armed(const struct ao * const ao,
 		const struct ao_event * const event);
 void ao_timer_step(uint32_t elapsed_ms);
+/**
+ * @brief Get the time left until the earliest timer expires.
+ *
+ * @return The time left in milliseconds, or UINT32_MAX if no timer is armed.
+ */
+uint32_t ao_timer_next_deadline_ms(void);
 void ao_timer_reset(void);
 
 int ao_timer_init(void);
@@ -201,6 +201,26 @@ void ao_timer_step(uint32_t elapsed_ms)
 	ao_timer_unlock();
 }
 
+uint32_t ao_timer_next_deadline_ms(void)
+{
+	uint32_t earliest = UINT32_MAX;
+
+	if (!initialized) {
+		return earliest;
+	}
+
+	ao_timer_lock();
+	for (unsigned int i = 0; i < AO_TIMER_MAXLEN; i++) {
+		const struct ao_timer *timer = &timer_pool[i];
+		if (is_allocated(timer) && timer->timeout_ms < earliest) {
+			earliest = timer->timeout_ms;
+		}
+	}
+	ao_timer_unlock();
+
+	return earliest;
+}
+
 void ao_timer_reset(void)
 {
 	if (!initialize()) {
@@ -18,6 +18,8 @@ extern "C" {
 #define APPTIMER_MAX_TIMEOUT		\
 	((1UL << (sizeof(apptimer_timeout_t) * CHAR_BIT - 1)) - 1)
 
+#define APPTIMER_NO_DEADLINE		((apptimer_timeout_t)-1)
+
 #if !defined(APPTIMER_DEBUG)
 #define APPTIMER_DEBUG(...)
 #endif
@@ -62,6 +64,14 @@ apptimer_error_t apptimer_start(apptimer_t timer,
 apptimer_error_t apptimer_stop(apptimer_t timer);
 int apptimer_count(void);
 
+/**
+ * @brief Get the time left until the earliest timer expires
+ *
+ * @return The time left in the unit of @ref apptimer_schedule, or
+ *         @ref APPTIMER_NO_DEADLINE if no timer is running.
+ */
+apptimer_timeout_t apptimer_next_deadline(void);
+
 /**
  * @brief Process expirations and bookkeepings
  *
@@ -274,6 +274,42 @@ apptimer_error_t apptimer_destroy(apptimer_t timer)
 	return APPTIMER_SUCCESS;
 }
 
+static apptimer_timeout_t get_time_left(const struct llist *head,
+		apptimer_timeout_t earliest)
+{
+	struct llist *p;
+
+	llist_for_each(p, head) {
+		const struct apptimer *timer =
+			llist_entry(p, struct apptimer, list);
+		const apptimer_timeout_t left = is_timer_expired(timer)? 0 :
+			get_time_distance(timer->goaltime, get_timer_counter());
+		earliest = MIN(earliest, left);
+	}
+
+	return earliest;
+}
+
+apptimer_timeout_t apptimer_next_deadline(void)
+{
+	apptimer_timeout_t earliest = APPTIMER_NO_DEADLINE;
+
+	pthread_mutex_lock(&m.wheels_lock);
+	{
+		earliest = get_time_left(&m.pending, earliest);
+
+		for (int i = 0; i < NR_WHEELS; i++) {
+			for (int j = 0; j < NR_SLOTS; j++) {
+				earliest = get_time_left(&m.wheels[i][j],
+						earliest);
+			}
+		}
+	}
+	pthread_mutex_unlock(&m.wheels_lock);
+
+	return earliest;
+}
+
 int apptimer_count(void)
 {
 	return m.active_timers;
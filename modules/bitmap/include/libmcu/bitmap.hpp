@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_BITMAP_HPP
+#define LIBMCU_BITMAP_HPP
+
+#include <stddef.h>
+
+#include "libmcu/bitmap.h"
+
+namespace libmcu {
+
+/**
+ * @brief Bitmap of @p N bits with the size fixed at compile time.
+ *
+ * The storage layout is the same as @ref DEFINE_BITMAP so that @ref data can
+ * be handed to the C API. Word index and bit mask are computed with shifts as
+ * the word size is a power of 2.
+ */
+template <size_t N>
+class Bitmap {
+	static_assert(N > 0, "N should be greater than 0.");
+
+public:
+	static constexpr size_t size() { return N; }
+
+	explicit Bitmap(bool initial_value = false) { fill(initial_value); }
+
+	bool get(size_t pos) const {
+		return (words[word(pos)] & mask(pos)) != 0;
+	}
+	void set(size_t pos) { words[word(pos)] |= mask(pos); }
+	void clear(size_t pos) { words[word(pos)] &= ~mask(pos); }
+
+	void fill(bool value) {
+		const bitmap_static_t v = value? ~bitmap_static_t(0) : 0;
+		for (size_t i = 0; i < NR_WORDS; i++) {
+			words[i] = v;
+		}
+		words[NR_WORDS - 1] &= LAST_WORD_MASK;
+	}
+
+	size_t count() const {
+		size_t cnt = 0;
+		for (size_t i = 0; i < NR_WORDS; i++) {
+			cnt += popcount(words[i]);
+		}
+		return cnt;
+	}
+
+	bitmap_t data() { return words; }
+
+private:
+	static constexpr size_t UNIT_BITS = sizeof(bitmap_static_t) * CHAR_BIT;
+	static constexpr size_t NR_WORDS = (N + UNIT_BITS - 1) / UNIT_BITS;
+	static constexpr bitmap_static_t LAST_WORD_MASK = (N % UNIT_BITS)?
+		(bitmap_static_t(1) << (N % UNIT_BITS)) - 1 :
+		~bitmap_static_t(0);
+
+	static_assert((UNIT_BITS & (UNIT_BITS - 1)) == 0,
+			"word size should be power of 2.");
+
+	static constexpr size_t word(size_t pos) { return pos / UNIT_BITS; }
+	static constexpr bitmap_static_t mask(size_t pos) {
+		return bitmap_static_t(1) << (pos % UNIT_BITS);
+	}
+
+	static size_t popcount(bitmap_static_t x) {
+#if defined(__GNUC__)
+		return static_cast<size_t>(__builtin_popcountll(x));
+#else
+		size_t cnt = 0;
+		for (; x; x &= x - 1) {
+			cnt++;
+		}
+		return cnt;
+#endif
+	}
+
+	bitmap_static_t words[NR_WORDS];
+};
+
+} /* namespace libmcu */
+
+#endif /* LIBMCU_BITMAP_HPP */
@@ -21,6 +21,8 @@ extern "C" {
 #define CLI_ASSERT(exp)
 #endif
 
+struct arena;
+
 struct cli_io {
 	int (*read)(void *buf, size_t bufsize);
 	int (*write)(void const *data, size_t datasize);
@@ -40,6 +42,8 @@ struct cli {
 
 	void *env;
 	bool pause;
+
+	struct arena *arena;
 };
 
 void cli_init(struct cli *cli, struct cli_io const *io,
@@ -48,6 +52,17 @@ void cli_register_cmdlist(struct cli *cli, const struct cli_cmd **cmdlist);
 void cli_run(struct cli *cli, void (*sleep)(void));
 cli_cmd_error_t cli_step(struct cli *cli);
 
+/**
+ * @brief Give commands an arena for their scratch memory.
+ *
+ * The arena is set as the default one, @ref arena_default, while a command
+ * runs and everything allocated from it is released when the command returns.
+ * Commands may also reach it with `((struct cli const *)env)->arena`.
+ *
+ * @param[in] arena arena for the commands. NULL not to give any.
+ */
+void cli_set_arena(struct cli *cli, struct arena *arena);
+
 #if defined(__cplusplus)
 }
 #endif
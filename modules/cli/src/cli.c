@@ -5,6 +5,7 @@
  */
 
 #include "libmcu/cli.h"
+#include "libmcu/arena.h"
 #include <stdint.h>
 #include <string.h>
 
@@ -320,6 +321,26 @@ static void report_result(struct cli_io const *io, cli_cmd_error_t err,
 	}
 }
 
+static cli_cmd_error_t run_command(struct cli const *cli,
+		struct cli_cmd const *cmd, int argc, char const *argv[],
+		void *env)
+{
+	if (!cli->arena) {
+		return cmd->func(argc, argv, env);
+	}
+
+	struct arena *prev = arena_set_default(cli->arena);
+	arena_mark_t mark;
+
+	arena_save(cli->arena, &mark);
+	cli_cmd_error_t rc = cmd->func(argc, argv, env);
+	arena_restore(cli->arena, &mark);
+
+	arena_set_default(prev);
+
+	return rc;
+}
+
 static cli_cmd_error_t process_command(struct cli const *cli,
 		int argc, char const *argv[], void *env)
 {
@@ -333,7 +354,7 @@ static cli_cmd_error_t process_command(struct cli const *cli,
 	for (size_t i = 0; cli->cmdlist && cli->cmdlist[i]; i++) {
 		cmd = cli->cmdlist[i];
 		if (strcmp(cmd->name, argv[0]) == 0) {
-			rc = cmd->func(argc, argv, env);
+			rc = run_command(cli, cmd, argc, argv, env);
 			break;
 		}
 	}
@@ -389,6 +410,13 @@ void cli_run(struct cli *cli, void (*sleep)(void))
 			strlen(CLI_PROMPT_EXIT_MESSAGE));
 }
 
+void cli_set_arena(struct cli *cli, struct arena *arena)
+{
+	CLI_ASSERT(cli != NULL);
+
+	cli->arena = arena;
+}
+
 void cli_register_cmdlist(struct cli *cli, const struct cli_cmd **cmdlist)
 {
 	CLI_ASSERT(cli != NULL && cmdlist != NULL);
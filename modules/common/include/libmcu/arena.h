@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_ARENA_H
+#define LIBMCU_ARENA_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Bump allocator for short-lived buffers.
+ *
+ * Allocations are carved out of caller buffers, or blocks allocated on demand,
+ * and released all together by rolling back to a mark instead of one by one,
+ * leaving no holes in the heap. Not thread-safe; an arena is meant to be used
+ * by one context at a time.
+ */
+
+#if !defined(ARENA_DEFAULT_ALIGN)
+#define ARENA_DEFAULT_ALIGN		(sizeof(void *) * 2)
+#endif
+
+/* followed by the memory to allocate from */
+struct arena_block {
+	struct arena_block *next;
+	size_t size;
+	size_t used;
+	bool allocated;
+};
+
+struct arena {
+	struct arena_block *head;
+	struct arena_block *current;
+	/* size of the blocks allocated on demand. 0 not to allocate any */
+	size_t block_size;
+};
+
+typedef struct {
+	struct arena_block *block;
+	size_t used;
+} arena_mark_t;
+
+/**
+ * @brief Run the following statement or block with the allocations released
+ *        at the end.
+ *
+ * @note Leaving the block with break, return or goto skips the release.
+ */
+#define ARENA_SCOPE(arena)						\
+	for (arena_mark_t arena_scope_mark,				\
+			*arena_scope_once = (arena_save(arena,		\
+					&arena_scope_mark), &arena_scope_mark);\
+			arena_scope_once;				\
+			arena_restore(arena, &arena_scope_mark),	\
+			arena_scope_once = NULL)
+
+/**
+ * @brief Initialize an arena on a buffer.
+ *
+ * @param[in] buf buffer to allocate from. NULL to start with no buffer
+ * @param[in] bufsize size of @p buf in bytes
+ */
+void arena_init(struct arena *arena, void *buf, size_t bufsize);
+
+/**
+ * @brief Initialize an arena allocating blocks from the heap on demand.
+ *
+ * Blocks are kept for reuse once allocated until @ref arena_deinit, so the
+ * heap sees only a few long-lived allocations.
+ *
+ * @param[in] block_size size of a block. An allocation larger than that gets
+ *            a block of its own size.
+ */
+void arena_init_chained(struct arena *arena, size_t block_size);
+
+/**
+ * @brief Free the blocks allocated on demand.
+ */
+void arena_deinit(struct arena *arena);
+
+/**
+ * @brief Chain one more buffer to allocate from when the others are full.
+ *
+ * @return 0 on success, -EINVAL if @p buf is too small to hold anything.
+ */
+int arena_add(struct arena *arena, void *buf, size_t bufsize);
+
+/**
+ * @brief Allocate aligned to @ref ARENA_DEFAULT_ALIGN.
+ *
+ * @return A pointer to the memory, or NULL if no space left.
+ */
+void *arena_alloc(struct arena *arena, size_t size);
+
+/**
+ * @brief Allocate aligned to @p align.
+ *
+ * @param[in] align alignment in bytes. It should be a power of 2.
+ *
+ * @return A pointer to the memory, or NULL if no space left or @p align is
+ *         not a power of 2.
+ */
+void *arena_alloc_aligned(struct arena *arena, size_t size, size_t align);
+
+/**
+ * @brief Take a mark to release the allocations made after.
+ */
+void arena_save(const struct arena *arena, arena_mark_t *mark);
+
+/**
+ * @brief Release all the allocations made since @p mark was taken.
+ *
+ * Marks are to be restored in the reverse order of being taken.
+ */
+void arena_restore(struct arena *arena, const arena_mark_t *mark);
+
+/**
+ * @brief Release all the allocations.
+ */
+void arena_reset(struct arena *arena);
+
+/**
+ * @brief Get the number of bytes in use, including the alignment padding.
+ */
+size_t arena_used(const struct arena *arena);
+
+/**
+ * @brief Get the default arena of the calling context.
+ *
+ * It is per thread when ARENA_THREAD_LOCAL is defined as the thread-local
+ * storage specifier of the toolchain, e.g. __thread, or global otherwise.
+ *
+ * @return The default arena, or NULL if none set.
+ */
+struct arena *arena_default(void);
+
+/**
+ * @brief Set the default arena of the calling context.
+ *
+ * @return The previous default arena.
+ */
+struct arena *arena_set_default(struct arena *arena);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_ARENA_H */
@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_DEADLINE_H
+#define LIBMCU_DEADLINE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#if !defined(DEADLINE_MAX_SOURCES)
+#define DEADLINE_MAX_SOURCES		4U
+#endif
+
+#define DEADLINE_NONE			UINT32_MAX
+
+/**
+ * @brief Report the time left until the next deadline of a module.
+ *
+ * @return The time left in milliseconds, 0 if already due, or
+ *         @ref DEADLINE_NONE if nothing is pending.
+ */
+typedef uint32_t (*deadline_source_t)(void);
+
+/**
+ * @brief Register a source of deadlines, e.g. @ref ao_timer_next_deadline_ms.
+ *
+ * Sources are supposed to be registered at initialization, before
+ * @ref deadline_next_ms gets called from another thread.
+ *
+ * @param[in] source The function reporting the next deadline.
+ *
+ * @return 0 on success, -EEXIST if already registered, -ENOSPC if
+ *         @ref DEADLINE_MAX_SOURCES are registered already.
+ */
+int deadline_register(deadline_source_t source);
+int deadline_unregister(deadline_source_t source);
+
+/**
+ * @brief Get the time left until the earliest deadline of all the sources.
+ *
+ * @return The time left in milliseconds, or @ref DEADLINE_NONE if none of the
+ *         sources has a pending deadline.
+ */
+uint32_t deadline_next_ms(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_DEADLINE_H */
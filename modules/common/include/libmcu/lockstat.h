@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_LOCKSTAT_H
+#define LIBMCU_LOCKSTAT_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Lock contention statistics.
+ *
+ * A lock gets its statistics with @ref LOCKSTAT_DEFINE next to it, and the
+ * lock implementation reports to it on every acquisition and release, e.g.
+ * with the pthread wrappers in libmcu/lockstat_pthread.h.
+ * The statistics are updated while holding the lock being measured, so no
+ * other lock is involved.
+ *
+ * Everything compiles out unless LOCKSTAT_ENABLED is defined.
+ */
+
+#if !defined(LOCKSTAT_HISTOGRAM_BUCKETS)
+#define LOCKSTAT_HISTOGRAM_BUCKETS		16U
+#endif
+#if !defined(LOCKSTAT_HISTOGRAM_SHIFT)
+/* the first bucket counts durations shorter than 1 << shift nanoseconds */
+#define LOCKSTAT_HISTOGRAM_SHIFT		10U
+#endif
+#if !defined(LOCKSTAT_MAX_HOLDERS)
+#define LOCKSTAT_MAX_HOLDERS			4U
+#endif
+
+struct lockstat_holder {
+	const void *caller;
+	uint32_t count;
+	uint64_t hold_ns;
+};
+
+struct lockstat {
+	const char *name;
+	struct lockstat *next;
+	bool registered;
+
+	uint32_t acquisitions;
+	uint32_t contentions;
+
+	uint64_t wait_total_ns;
+	uint64_t wait_max_ns;
+	uint64_t hold_total_ns;
+	uint64_t hold_max_ns;
+
+	/* wait times of the contended acquisitions only */
+	uint32_t wait_histogram[LOCKSTAT_HISTOGRAM_BUCKETS];
+	uint32_t hold_histogram[LOCKSTAT_HISTOGRAM_BUCKETS];
+
+	/* sorted by count in descending order */
+	struct lockstat_holder holders[LOCKSTAT_MAX_HOLDERS];
+
+	const void *holder;
+	uint64_t acquired_at;
+};
+
+#if defined(LOCKSTAT_ENABLED)
+#define LOCKSTAT_DEFINE(var)		\
+	static struct lockstat var = { .name = #var, }
+#else
+#define LOCKSTAT_DEFINE(var)		struct lockstat
+#endif
+
+typedef void (*lockstat_iterate_cb_t)(const struct lockstat *stat, void *ctx);
+
+/**
+ * @brief Report an acquisition. Call right after taking the lock.
+ *
+ * @param[in] stat statistics of the lock
+ * @param[in] wait_ns time spent waiting for the lock
+ * @param[in] contended true if the lock was held by another at the attempt
+ * @param[in] caller address of the code taking the lock
+ */
+void lockstat_acquired(struct lockstat *stat, uint64_t wait_ns,
+		bool contended, const void *caller);
+
+/**
+ * @brief Report a release. Call right before releasing the lock.
+ */
+void lockstat_released(struct lockstat *stat);
+
+/**
+ * @brief Iterate over the locks acquired at least once.
+ *
+ * The values are read without the locks held and may be torn while in use.
+ */
+void lockstat_iterate(lockstat_iterate_cb_t cb, void *ctx);
+
+/**
+ * @brief Clear the statistics of all the locks.
+ *
+ * @note Call it only when none of the locks is held.
+ */
+void lockstat_reset(void);
+
+/**
+ * @brief Get the lower bound of a histogram bucket in nanoseconds.
+ */
+uint64_t lockstat_bucket_ns(unsigned int bucket);
+
+/**
+ * @brief Monotonic time in nanoseconds.
+ *
+ * The default derives it from @ref board_get_time_since_boot_us. Override it
+ * for a finer resolution.
+ */
+uint64_t lockstat_get_time_ns(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_LOCKSTAT_H */
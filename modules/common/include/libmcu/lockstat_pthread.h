@@ -0,0 +1,58 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_LOCKSTAT_PTHREAD_H
+#define LIBMCU_LOCKSTAT_PTHREAD_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <pthread.h>
+#include "libmcu/lockstat.h"
+
+/*
+ * pthread mutex wrappers reporting to @ref lockstat. They turn into plain
+ * pthread_mutex_lock() and pthread_mutex_unlock() unless LOCKSTAT_ENABLED is
+ * defined:
+ *
+ *	static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+ *	LOCKSTAT_DEFINE(metrics_lockstat);
+ *
+ *	void metrics_lock(void) {
+ *		LOCKSTAT_MUTEX_LOCK(metrics_lockstat, &lock);
+ *	}
+ *
+ * The caller recorded is the return address of the function using the macro,
+ * which is where the library takes its lock. The functions below are needed
+ * only with LOCKSTAT_ENABLED, implemented in ports/posix/lockstat_pthread.c.
+ */
+
+#if defined(LOCKSTAT_ENABLED)
+#define LOCKSTAT_MUTEX_LOCK(stat, mutex)	\
+	lockstat_mutex_lock(&(stat), mutex, \
+			__builtin_return_address(0))
+#define LOCKSTAT_MUTEX_UNLOCK(stat, mutex)	\
+	lockstat_mutex_unlock(&(stat), mutex)
+#else
+#define LOCKSTAT_MUTEX_LOCK(stat, mutex)	pthread_mutex_lock(mutex)
+#define LOCKSTAT_MUTEX_UNLOCK(stat, mutex)	pthread_mutex_unlock(mutex)
+#endif
+
+/**
+ * @brief Lock @p mutex, telling contention with a try first.
+ *
+ * @return 0 on success, otherwise the error of pthread_mutex_lock().
+ */
+int lockstat_mutex_lock(struct lockstat *stat, pthread_mutex_t *mutex,
+		const void *caller);
+int lockstat_mutex_unlock(struct lockstat *stat, pthread_mutex_t *mutex);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_LOCKSTAT_PTHREAD_H */
@@ -85,6 +85,35 @@ int msgq_set_sync(struct msgq *q,
  */
 int msgq_push(struct msgq *q, const void *data, const size_t datasize);
 
+/**
+ * @brief Pushes a message, dropping the oldest messages if not enough space.
+ *
+ * Whole messages are dropped from the oldest, never a part of one, as many as
+ * needed to make room for the new message. It is safe for a single producer
+ * and a single consumer without the lock functions as @ref msgq_push is.
+ *
+ * @param[in] q Pointer to the message queue.
+ * @param[in] data Pointer to the message data.
+ * @param[in] datasize Size of the message data.
+ *
+ * @return 0 on success, -ENOMEM if the message is larger than the capacity,
+ *         or other negative value on failure.
+ */
+int msgq_push_overwrite(struct msgq *q,
+		const void *data, const size_t datasize);
+
+/**
+ * @brief Returns the number of messages dropped by @ref msgq_push_overwrite.
+ *
+ * A message popped by the consumer at the very moment of being dropped may be
+ * counted too when no lock functions are set.
+ *
+ * @param[in] q Pointer to the message queue.
+ *
+ * @return The number of messages dropped.
+ */
+size_t msgq_dropped(const struct msgq *q);
+
 /**
  * @brief Pops a message from the message queue.
  *
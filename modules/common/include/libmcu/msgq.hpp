@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_MSGQ_HPP
+#define LIBMCU_MSGQ_HPP
+
+#include <errno.h>
+#include <stdint.h>
+
+#include "libmcu/msgq.h"
+#include "libmcu/ringbuf.hpp"
+
+namespace libmcu {
+
+/**
+ * @brief Message queue of @p N bytes with the capacity fixed at compile time.
+ *
+ * Messages are framed the same way as @ref msgq, with a
+ * @ref msgq_msg_meta_t header in front of each. No lock is taken. Guard
+ * push and pop with a mutex when they run in different contexts.
+ */
+template <size_t N>
+class MsgQueue {
+public:
+	static constexpr size_t capacity() { return N; }
+
+	/** The queue size to hold @p n messages of @p max_msg_size bytes. */
+	static constexpr size_t calc_size(size_t n, size_t max_msg_size) {
+		return round_up_power2((sizeof(msgq_msg_meta_t) + max_msg_size)
+				* n);
+	}
+
+	MsgQueue() = default;
+	MsgQueue(const MsgQueue &) = delete;
+	MsgQueue &operator=(const MsgQueue &) = delete;
+	MsgQueue(MsgQueue &&) = default;
+	MsgQueue &operator=(MsgQueue &&) = default;
+
+	/**
+	 * @return 0 on success, -ENOMEM if not enough space.
+	 */
+	int push(const void *data, size_t datasize) {
+		const msgq_msg_meta_t meta = { datasize };
+
+		if (sizeof(meta) + datasize > ring.available()) {
+			return -ENOMEM;
+		}
+
+		ring.write(reinterpret_cast<const uint8_t *>(&meta),
+				sizeof(meta));
+		ring.write(static_cast<const uint8_t *>(data), datasize);
+
+		return 0;
+	}
+
+	/**
+	 * @return The length of the message on success. -ENOENT if empty,
+	 *         -ERANGE if @p bufsize is smaller than the message.
+	 */
+	int pop(void *buf, size_t bufsize) {
+		const size_t size = next_msg_size();
+
+		if (ring.empty()) {
+			return -ENOENT;
+		} else if (size > bufsize) {
+			return -ERANGE;
+		}
+
+		ring.peek(sizeof(msgq_msg_meta_t),
+				static_cast<uint8_t *>(buf), size);
+		ring.consume(sizeof(msgq_msg_meta_t) + size);
+
+		return static_cast<int>(size);
+	}
+
+	size_t next_msg_size() const {
+		msgq_msg_meta_t meta;
+
+		if (ring.peek(0, reinterpret_cast<uint8_t *>(&meta),
+				sizeof(meta)) != sizeof(meta)) {
+			return 0;
+		}
+
+		return meta.size;
+	}
+
+	/** The number of bytes queued including the message headers. */
+	size_t length() const { return ring.length(); }
+	bool empty() const { return ring.empty(); }
+
+	/** The largest message that can be pushed. */
+	size_t available() const {
+		const size_t n = ring.available();
+		return n < sizeof(msgq_msg_meta_t)?
+			0 : n - sizeof(msgq_msg_meta_t);
+	}
+
+private:
+	static constexpr size_t round_up_power2(size_t n, size_t v = 1) {
+		return v >= n? v : round_up_power2(n, v << 1);
+	}
+
+	RingBuffer<uint8_t, N> ring;
+};
+
+} /* namespace libmcu */
+
+#endif /* LIBMCU_MSGQ_HPP */
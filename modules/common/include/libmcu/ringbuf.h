@@ -23,8 +23,21 @@ struct ringbuf {
 	size_t index;
 	size_t outdex;
 	uint8_t *buffer;
+	/* the oldest data not overwritten yet, moved by the producer */
+	size_t oldest;
+	/* bytes overwritten before read, counted by the consumer */
+	size_t dropped;
 };
 
+/**
+ * @brief Get the size of a record from its header.
+ *
+ * @param[in] header The header at the beginning of the record.
+ *
+ * @return The size of the whole record including the header.
+ */
+typedef size_t (*ringbuf_record_size_t)(const void *header);
+
 #define DEFINE_RINGBUF(_name, _bufsize) \
 	static uint8_t LIBMCU_CONCAT(_name, _buf)[_bufsize]; \
 	static struct ringbuf _name = { \
@@ -32,6 +45,8 @@ struct ringbuf {
 		.index = 0, \
 		.outdex = 0, \
 		.buffer = LIBMCU_CONCAT(_name, _buf), \
+		.oldest = 0, \
+		.dropped = 0, \
 	}; \
 	static_assert((_bufsize & (_bufsize - 1)) == 0, \
 			      "_bufsize should be power of 2.")
@@ -52,6 +67,58 @@ struct ringbuf {
 size_t ringbuf_write(struct ringbuf *handle,
 		const void *data, const size_t datasize);
 
+/**
+ * @brief Writes data to the ring buffer, overwriting the oldest if full.
+ *
+ * This function always accepts the data, dropping the oldest data as much as
+ * needed. If the data is larger than the capacity, only the last part of it
+ * that fits is written.
+ *
+ * Like @ref ringbuf_write, it is safe for a single producer and a single
+ * consumer without a lock. The consumer finds out that it has been
+ * overwritten when consuming, so data obtained with @ref ringbuf_peek or
+ * @ref ringbuf_peek_pointer is valid only if the following
+ * @ref ringbuf_consume succeeds. @ref ringbuf_read takes care of it.
+ *
+ * @param[in] handle Pointer to the ring buffer handle.
+ * @param[in] data Pointer to the data to be written to the ring buffer.
+ * @param[in] datasize Size of the data to be written, in bytes.
+ *
+ * @return The number of bytes actually written to the ring buffer.
+ */
+size_t ringbuf_write_overwrite(struct ringbuf *handle,
+		const void *data, const size_t datasize);
+
+/**
+ * @brief Drops the oldest records to make room for new data.
+ *
+ * This is for the producer writing records, each starting with a header that
+ * tells its size, not to leave a partial record behind when overwriting.
+ * Write the new record with @ref ringbuf_write afterward.
+ *
+ * @param[in] handle Pointer to the ring buffer handle.
+ * @param[in] size The size of the room to make, in bytes.
+ * @param[out] header Buffer to read a header into.
+ * @param[in] header_size The size of the header, in bytes.
+ * @param[in] get_record_size Function to get the size of a record.
+ *
+ * @return The number of records dropped.
+ */
+size_t ringbuf_drop_oldest(struct ringbuf *handle, const size_t size,
+		void *header, const size_t header_size,
+		ringbuf_record_size_t get_record_size);
+
+/**
+ * @brief Gets the number of bytes overwritten before being read.
+ *
+ * The bytes are counted when the consumer catches up, not when overwritten.
+ *
+ * @param[in] handle Pointer to the ring buffer handle.
+ *
+ * @return The number of bytes dropped.
+ */
+size_t ringbuf_dropped(const struct ringbuf *handle);
+
 /**
  * @brief Cancels the write operation on the ring buffer.
  *
@@ -114,7 +181,9 @@ const void *ringbuf_peek_pointer(const struct ringbuf *handle,
  * @param[in] consume_size The size of the data to consume, in bytes.
  *
  * @return true if the operation was successful, false if the consume size
- *         exceeds the available data in the buffer.
+ *         exceeds the available data in the buffer or if the data has been
+ *         overwritten by @ref ringbuf_write_overwrite. Peek again in the
+ *         latter case.
  */
 bool ringbuf_consume(struct ringbuf *handle, const size_t consume_size);
 
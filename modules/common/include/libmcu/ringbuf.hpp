@@ -0,0 +1,225 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_RINGBUF_HPP
+#define LIBMCU_RINGBUF_HPP
+
+#include <stddef.h>
+#include <string.h>
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace libmcu {
+
+/**
+ * @brief Ring buffer of @p T with the capacity fixed at compile time.
+ *
+ * Indexing is masked with a constant as @p N is a power of 2. Elements are
+ * constructed in place on push and destroyed on pop, so non-trivial and
+ * move-only types can be stored. Like @ref ringbuf, it is safe for a single
+ * producer and a single consumer without a lock.
+ *
+ * The buffer itself is move-only. Copying it by accident would duplicate the
+ * queued elements.
+ */
+template <typename T, size_t N>
+class RingBuffer {
+	static_assert(N > 0 && (N & (N - 1)) == 0, "N should be power of 2.");
+
+public:
+	static constexpr size_t capacity() { return N; }
+
+	RingBuffer() : index(0), outdex(0) {}
+	~RingBuffer() { clear(); }
+
+	RingBuffer(const RingBuffer &) = delete;
+	RingBuffer &operator=(const RingBuffer &) = delete;
+
+	RingBuffer(RingBuffer &&other) : index(0), outdex(0) {
+		take(other);
+	}
+	RingBuffer &operator=(RingBuffer &&other) {
+		if (this != &other) {
+			clear();
+			take(other);
+		}
+		return *this;
+	}
+
+	size_t length() const { return index - outdex; }
+	size_t available() const { return N - length(); }
+	bool empty() const { return index == outdex; }
+	bool full() const { return length() == N; }
+
+	template <typename... Args>
+	bool emplace(Args &&...args) {
+		if (full()) {
+			return false;
+		}
+		new (slot(index)) T(std::forward<Args>(args)...);
+		std::atomic_thread_fence(std::memory_order_release);
+		index++;
+		return true;
+	}
+
+	bool push(const T &value) { return emplace(value); }
+	bool push(T &&value) { return emplace(std::move(value)); }
+
+	bool pop(T &value) {
+		if (empty()) {
+			return false;
+		}
+		std::atomic_thread_fence(std::memory_order_acquire);
+		T *p = slot(outdex);
+		value = std::move(*p);
+		p->~T();
+		outdex++;
+		return true;
+	}
+
+	/** The oldest element. It should not be called when empty. */
+	T &front() { return *slot(outdex); }
+	const T &front() const { return *slot(outdex); }
+
+	/**
+	 * @brief Copy as many elements as fit.
+	 *
+	 * @return The number of elements written.
+	 */
+	size_t write(const T *data, size_t n) {
+		const size_t len = n < available()? n : available();
+		const size_t i = mask(index);
+		const size_t cut = len < N - i? len : N - i;
+
+		copy_in(slot(i), data, cut);
+		copy_in(slot(0), data + cut, len - cut);
+
+		std::atomic_thread_fence(std::memory_order_release);
+		index += len;
+
+		return len;
+	}
+
+	/**
+	 * @brief Copy the elements starting at @p offset without consuming.
+	 *
+	 * @return The number of elements copied.
+	 */
+	size_t peek(size_t offset, T *buf, size_t n) const {
+		if (offset >= length()) {
+			return 0;
+		}
+
+		const size_t left = length() - offset;
+		const size_t len = n < left? n : left;
+		const size_t i = mask(outdex + offset);
+		const size_t cut = len < N - i? len : N - i;
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		copy_out(buf, slot(i), cut);
+		copy_out(buf + cut, slot(0), len - cut);
+
+		return len;
+	}
+
+	bool consume(size_t n) {
+		if (n > length()) {
+			return false;
+		}
+		for (size_t i = 0; i < n; i++) {
+			slot(outdex + i)->~T();
+		}
+		outdex += n;
+		return true;
+	}
+
+	/**
+	 * @brief Copy and consume the elements.
+	 *
+	 * @return The number of elements read.
+	 */
+	size_t read(T *buf, size_t n) {
+		const size_t len = peek(0, buf, n);
+		consume(len);
+		return len;
+	}
+
+	/**
+	 * @brief Get the contiguous elements starting at @p offset.
+	 *
+	 * @return A pointer to the element, or nullptr if @p offset is out of
+	 *         range.
+	 */
+	const T *peek_pointer(size_t offset, size_t *contiguous) const {
+		if (offset >= length()) {
+			return nullptr;
+		}
+		const size_t i = mask(outdex + offset);
+		const size_t left = length() - offset;
+		*contiguous = left < N - i? left : N - i;
+		return slot(i);
+	}
+
+	void clear() { consume(length()); }
+
+private:
+	static constexpr size_t MASK = N - 1;
+	static constexpr size_t mask(size_t i) { return i & MASK; }
+
+	T *slot(size_t i) {
+		return reinterpret_cast<T *>(&storage[mask(i) * sizeof(T)]);
+	}
+	const T *slot(size_t i) const {
+		return reinterpret_cast<const T *>(&storage[mask(i) * sizeof(T)]);
+	}
+
+	/* memmove() rather than memcpy() as GCC otherwise inlines the copy of
+	 * the size bounded by N as rep movs on x86, which is slower than the
+	 * library call for small copies. */
+	static void copy_in(T *dst, const T *src, size_t n) {
+		if (std::is_trivially_copyable<T>::value) {
+			if (n) {
+				memmove(static_cast<void *>(dst), src,
+						n * sizeof(T));
+			}
+			return;
+		}
+		for (size_t i = 0; i < n; i++) {
+			new (&dst[i]) T(src[i]);
+		}
+	}
+
+	static void copy_out(T *dst, const T *src, size_t n) {
+		if (std::is_trivially_copyable<T>::value) {
+			if (n) {
+				memmove(static_cast<void *>(dst), src,
+						n * sizeof(T));
+			}
+			return;
+		}
+		for (size_t i = 0; i < n; i++) {
+			dst[i] = src[i];
+		}
+	}
+
+	void take(RingBuffer &other) {
+		while (!other.empty()) {
+			emplace(std::move(other.front()));
+			other.consume(1);
+		}
+	}
+
+	alignas(T) unsigned char storage[N * sizeof(T)];
+	size_t index;
+	size_t outdex;
+};
+
+} /* namespace libmcu */
+
+#endif /* LIBMCU_RINGBUF_HPP */
@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/arena.h"
+#include "libmcu/compiler.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(ARENA_THREAD_LOCAL)
+#define ARENA_THREAD_LOCAL
+#endif
+
+static ARENA_THREAD_LOCAL struct arena *default_arena;
+
+static void append_block(struct arena *arena, struct arena_block *block)
+{
+	struct arena_block **p = &arena->head;
+
+	while (*p) {
+		p = &(*p)->next;
+	}
+
+	*p = block;
+
+	if (!arena->current) {
+		arena->current = block;
+	}
+}
+
+static void *take(struct arena_block *block, size_t size, size_t align)
+{
+	const uintptr_t base = (uintptr_t)(block + 1);
+	const uintptr_t end = base + block->size;
+	const uintptr_t p = ALIGN(base + block->used, align);
+
+	if (p > end || size > end - p) {
+		return NULL;
+	}
+
+	block->used = p - base + size;
+
+	return (void *)p;
+}
+
+static struct arena_block *grow(struct arena *arena, size_t size, size_t align)
+{
+	/* enough for the worst case padding */
+	const size_t need = size + align - 1;
+	const size_t block_size = need > arena->block_size?
+		need : arena->block_size;
+
+	if (need < size || block_size > SIZE_MAX - sizeof(struct arena_block)) {
+		return NULL;
+	}
+
+	struct arena_block *block = (struct arena_block *)
+		malloc(sizeof(*block) + block_size);
+
+	if (block) {
+		*block = (struct arena_block) {
+			.size = block_size,
+			.allocated = true,
+		};
+		append_block(arena, block);
+	}
+
+	return block;
+}
+
+void *arena_alloc_aligned(struct arena *arena, size_t size, size_t align)
+{
+	if (align == 0 || (align & (align - 1)) != 0) {
+		return NULL;
+	}
+
+	/* the blocks after the current one are all empty */
+	for (struct arena_block *block = arena->current; block;
+			block = block->next) {
+		void *p = take(block, size, align);
+
+		if (p) {
+			arena->current = block;
+			return p;
+		}
+	}
+
+	if (arena->block_size) {
+		struct arena_block *block = grow(arena, size, align);
+
+		if (block) {
+			arena->current = block;
+			return take(block, size, align);
+		}
+	}
+
+	return NULL;
+}
+
+void *arena_alloc(struct arena *arena, size_t size)
+{
+	return arena_alloc_aligned(arena, size, ARENA_DEFAULT_ALIGN);
+}
+
+void arena_save(const struct arena *arena, arena_mark_t *mark)
+{
+	mark->block = arena->current;
+	mark->used = arena->current? arena->current->used : 0;
+}
+
+void arena_restore(struct arena *arena, const arena_mark_t *mark)
+{
+	if (!mark->block) {
+		arena_reset(arena);
+		return;
+	}
+
+	mark->block->used = mark->used;
+
+	for (struct arena_block *p = mark->block->next; p; p = p->next) {
+		p->used = 0;
+	}
+
+	arena->current = mark->block;
+}
+
+void arena_reset(struct arena *arena)
+{
+	for (struct arena_block *p = arena->head; p; p = p->next) {
+		p->used = 0;
+	}
+
+	arena->current = arena->head;
+}
+
+size_t arena_used(const struct arena *arena)
+{
+	size_t used = 0;
+
+	for (const struct arena_block *p = arena->head; p; p = p->next) {
+		used += p->used;
+	}
+
+	return used;
+}
+
+int arena_add(struct arena *arena, void *buf, size_t bufsize)
+{
+	const uintptr_t start = ALIGN((uintptr_t)buf, sizeof(void *));
+	const size_t padding = start - (uintptr_t)buf;
+
+	if (!buf || bufsize <= padding + sizeof(struct arena_block)) {
+		return -EINVAL;
+	}
+
+	struct arena_block *block = (struct arena_block *)start;
+
+	*block = (struct arena_block) {
+		.size = bufsize - padding - sizeof(*block),
+	};
+	append_block(arena, block);
+
+	return 0;
+}
+
+void arena_init(struct arena *arena, void *buf, size_t bufsize)
+{
+	memset(arena, 0, sizeof(*arena));
+
+	if (buf) {
+		arena_add(arena, buf, bufsize);
+	}
+}
+
+void arena_init_chained(struct arena *arena, size_t block_size)
+{
+	memset(arena, 0, sizeof(*arena));
+	arena->block_size = block_size;
+}
+
+void arena_deinit(struct arena *arena)
+{
+	struct arena_block **p = &arena->head;
+
+	while (*p) {
+		struct arena_block *block = *p;
+
+		if (block->allocated) {
+			*p = block->next;
+			free(block);
+		} else {
+			block->used = 0;
+			p = &block->next;
+		}
+	}
+
+	arena->current = arena->head;
+	arena->block_size = 0;
+}
+
+struct arena *arena_default(void)
+{
+	return default_arena;
+}
+
+struct arena *arena_set_default(struct arena *arena)
+{
+	struct arena *prev = default_arena;
+	default_arena = arena;
+	return prev;
+}
@@ -79,6 +79,13 @@ unsigned long board_get_time_since_boot_ms(void)
 	return 0;
 }
 
+LIBMCU_WEAK
+LIBMCU_NO_INSTRUMENT
+uint64_t board_get_time_since_boot_us(void)
+{
+	return (uint64_t)board_get_time_since_boot_ms() * 1000U;
+}
+
 LIBMCU_WEAK
 uint32_t board_random(void)
 {
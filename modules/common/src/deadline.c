@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/deadline.h"
+#include <errno.h>
+#include <stddef.h>
+
+static deadline_source_t sources[DEADLINE_MAX_SOURCES];
+
+int deadline_register(deadline_source_t source)
+{
+	deadline_source_t *slot = NULL;
+
+	if (!source) {
+		return -EINVAL;
+	}
+
+	for (unsigned int i = 0; i < DEADLINE_MAX_SOURCES; i++) {
+		if (sources[i] == source) {
+			return -EEXIST;
+		} else if (!sources[i] && !slot) {
+			slot = &sources[i];
+		}
+	}
+
+	if (!slot) {
+		return -ENOSPC;
+	}
+
+	*slot = source;
+
+	return 0;
+}
+
+int deadline_unregister(deadline_source_t source)
+{
+	if (!source) {
+		return -ENOENT;
+	}
+
+	for (unsigned int i = 0; i < DEADLINE_MAX_SOURCES; i++) {
+		if (sources[i] == source) {
+			sources[i] = NULL;
+			return 0;
+		}
+	}
+
+	return -ENOENT;
+}
+
+uint32_t deadline_next_ms(void)
+{
+	uint32_t earliest = DEADLINE_NONE;
+
+	for (unsigned int i = 0; i < DEADLINE_MAX_SOURCES; i++) {
+		const deadline_source_t source = sources[i];
+
+		if (source) {
+			const uint32_t t = (*source)();
+			earliest = t < earliest? t : earliest;
+		}
+	}
+
+	return earliest;
+}
@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/lockstat.h"
+#include "libmcu/board.h"
+#include "libmcu/compiler.h"
+#include <string.h>
+
+static struct lockstat *head;
+
+static void register_lock(struct lockstat *stat)
+{
+	/* locks register themselves on the first acquisition, each under its
+	 * own lock, so the list head is the only thing shared */
+	struct lockstat *next = __atomic_load_n(&head, __ATOMIC_RELAXED);
+
+	do {
+		stat->next = next;
+	} while (!__atomic_compare_exchange_n(&head, &next, stat, true,
+			__ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+	stat->registered = true;
+}
+
+static unsigned int get_bucket(uint64_t ns)
+{
+	unsigned int bucket = 0;
+
+	for (ns >>= LOCKSTAT_HISTOGRAM_SHIFT; ns; ns >>= 1) {
+		bucket++;
+	}
+
+	return bucket < LOCKSTAT_HISTOGRAM_BUCKETS?
+		bucket : LOCKSTAT_HISTOGRAM_BUCKETS - 1;
+}
+
+static void update_holder(struct lockstat *stat, const void *caller,
+		uint64_t hold_ns)
+{
+	struct lockstat_holder *holders = stat->holders;
+	unsigned int i;
+
+	for (i = 0; i < LOCKSTAT_MAX_HOLDERS; i++) {
+		if (holders[i].caller == caller || holders[i].count == 0) {
+			break;
+		}
+	}
+
+	if (i == LOCKSTAT_MAX_HOLDERS) {
+		/* take over the least frequent one, keeping its count so that a
+		 * newcomer does not get evicted right away */
+		i = LOCKSTAT_MAX_HOLDERS - 1;
+		holders[i].hold_ns = 0;
+	}
+
+	holders[i].caller = caller;
+	holders[i].count++;
+	holders[i].hold_ns += hold_ns;
+
+	for (; i > 0 && holders[i].count > holders[i - 1].count; i--) {
+		const struct lockstat_holder tmp = holders[i - 1];
+		holders[i - 1] = holders[i];
+		holders[i] = tmp;
+	}
+}
+
+void lockstat_acquired(struct lockstat *stat, uint64_t wait_ns,
+		bool contended, const void *caller)
+{
+	if (!stat->registered) {
+		register_lock(stat);
+	}
+
+	stat->acquisitions++;
+
+	if (contended) {
+		stat->contentions++;
+		stat->wait_total_ns += wait_ns;
+		stat->wait_max_ns = wait_ns > stat->wait_max_ns?
+			wait_ns : stat->wait_max_ns;
+		stat->wait_histogram[get_bucket(wait_ns)]++;
+	}
+
+	stat->holder = caller;
+	stat->acquired_at = lockstat_get_time_ns();
+}
+
+void lockstat_released(struct lockstat *stat)
+{
+	const uint64_t hold_ns = lockstat_get_time_ns() - stat->acquired_at;
+
+	stat->hold_total_ns += hold_ns;
+	stat->hold_max_ns = hold_ns > stat->hold_max_ns?
+		hold_ns : stat->hold_max_ns;
+	stat->hold_histogram[get_bucket(hold_ns)]++;
+
+	update_holder(stat, stat->holder, hold_ns);
+}
+
+void lockstat_iterate(lockstat_iterate_cb_t cb, void *ctx)
+{
+	for (const struct lockstat *p = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+			p; p = p->next) {
+		(*cb)(p, ctx);
+	}
+}
+
+void lockstat_reset(void)
+{
+	for (struct lockstat *p = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+			p; p = p->next) {
+		const size_t offset = offsetof(struct lockstat, acquisitions);
+		memset((uint8_t *)p + offset, 0, sizeof(*p) - offset);
+	}
+}
+
+uint64_t lockstat_bucket_ns(unsigned int bucket)
+{
+	if (bucket == 0) {
+		return 0;
+	} else if (bucket >= LOCKSTAT_HISTOGRAM_BUCKETS) {
+		bucket = LOCKSTAT_HISTOGRAM_BUCKETS - 1;
+	}
+
+	return (uint64_t)1 << (LOCKSTAT_HISTOGRAM_SHIFT + bucket - 1);
+}
+
+LIBMCU_WEAK
+uint64_t lockstat_get_time_ns(void)
+{
+	return board_get_time_since_boot_us() * 1000U;
+}
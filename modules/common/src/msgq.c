@@ -15,6 +15,7 @@
 struct msgq {
 	struct ringbuf *ringbuf;
 	size_t capacity;
+	size_t dropped;
 
 	msgq_lock_fn lock;
 	msgq_unlock_fn unlock;
@@ -48,23 +49,44 @@ static int push_message(struct ringbuf *ringbuf,
 	return 0;
 }
 
+static size_t get_message_size(const void *header)
+{
+	const msgq_msg_meta_t *meta = (const msgq_msg_meta_t *)header;
+	return sizeof(*meta) + meta->size;
+}
+
 static int pop_message(struct ringbuf *ringbuf, void *buf, size_t bufsize)
 {
 	msgq_msg_meta_t meta;
 
-	if (ringbuf_peek(ringbuf, 0, &meta, sizeof(meta)) != sizeof(meta)) {
-		return -ENOENT;
-	}
+	/* what is peeked is valid only if it is not overwritten by
+	 * msgq_push_overwrite() in the meantime, which consuming tells. A torn
+	 * header is retried rather than reported as an error */
+	for (;;) {
+		if (ringbuf_peek(ringbuf, 0, &meta, sizeof(meta))
+				!= sizeof(meta)) {
+			return -ENOENT;
+		}
 
-	if (meta.size > bufsize) {
-		return -ERANGE;
-	}
+		if (meta.size > bufsize) {
+			if (!ringbuf_consume(ringbuf, 0)) {
+				continue;
+			}
+			return -ERANGE;
+		}
 
-	if (ringbuf_peek(ringbuf, sizeof(meta), buf, meta.size) != meta.size) {
-		return -EIO;
-	}
+		if (ringbuf_peek(ringbuf, sizeof(meta), buf, meta.size)
+				!= meta.size) {
+			if (!ringbuf_consume(ringbuf, 0)) {
+				continue;
+			}
+			return -EIO;
+		}
 
-	ringbuf_consume(ringbuf, sizeof(meta) + meta.size);
+		if (ringbuf_consume(ringbuf, sizeof(meta) + meta.size)) {
+			break;
+		}
+	}
 
 	return (int)meta.size;
 }
@@ -84,6 +106,36 @@ int msgq_push(struct msgq *q, const void *data, const size_t datasize)
 	return err;
 }
 
+int msgq_push_overwrite(struct msgq *q,
+		const void *data, const size_t datasize)
+{
+	msgq_msg_meta_t meta;
+
+	if (datasize > ringbuf_capacity(q->ringbuf) - sizeof(meta)) {
+		return -ENOMEM;
+	}
+
+	if (q->lock && q->lock(q->sync_ctx) != 0) {
+		return -EAGAIN;
+	}
+
+	q->dropped += ringbuf_drop_oldest(q->ringbuf, sizeof(meta) + datasize,
+			&meta, sizeof(meta), get_message_size);
+
+	int err = push_message(q->ringbuf, data, datasize);
+
+	if (q->unlock) {
+		err |= q->unlock(q->sync_ctx);
+	}
+
+	return err;
+}
+
+size_t msgq_dropped(const struct msgq *q)
+{
+	return q->dropped;
+}
+
 int msgq_pop(struct msgq *q, void *buf, size_t bufsize)
 {
 	if (q->lock && q->lock(q->sync_ctx) != 0) {
@@ -198,6 +250,7 @@ struct msgq *msgq_create(const size_t capacity_bytes)
 		}
 
 		q->capacity = capacity_bytes;
+		q->dropped = 0;
 		q->lock = NULL;
 		q->unlock = NULL;
 		q->sync_ctx = NULL;
@@ -25,9 +25,24 @@ static size_t get_capacity(const struct ringbuf *handle)
 	return handle->capacity;
 }
 
+/* true if the producer has moved the oldest over pos, which lies in
+ * (pos, index] then. The oldest never goes beyond the index. */
+static bool is_overwritten(const struct ringbuf *handle, const size_t pos)
+{
+	return handle->oldest - pos - 1 < handle->index - pos;
+}
+
+static size_t get_outdex(const struct ringbuf *handle)
+{
+	return is_overwritten(handle, handle->outdex)?
+		handle->oldest : handle->outdex;
+}
+
 static size_t get_length(const struct ringbuf *handle)
 {
-	return handle->index - handle->outdex;
+	/* it may exceed the capacity for a moment while being overwritten */
+	const size_t len = handle->index - get_outdex(handle);
+	return MIN(len, handle->capacity);
 }
 
 static size_t get_available(const struct ringbuf *handle)
@@ -41,12 +56,14 @@ static void initialize(struct ringbuf *handle, const size_t bufsize)
 							       power of 2 */
 	handle->index = 0;
 	handle->outdex = 0;
+	handle->oldest = 0;
+	handle->dropped = 0;
 }
 
 static uint8_t *get_pointer(const struct ringbuf *handle,
 		const size_t offset, size_t *contiguous)
 {
-	size_t index = GET_INDEX(handle->outdex + offset, handle->capacity);
+	size_t index = GET_INDEX(get_outdex(handle) + offset, handle->capacity);
 	uint8_t *p = &handle->buffer[index];
 
 	if (offset >= get_length(handle)) {
@@ -67,10 +84,12 @@ static size_t read_core(const struct ringbuf *handle,
 	size_t contiguous;
 	const uint8_t *p = get_pointer(handle, offset, &contiguous);
 	const uint8_t *base = handle->buffer;
+	/* taken once as the other side may change it in the meantime */
+	const size_t length = get_length(handle);
 	size_t bytes_read = 0;
 
-	if (p) {
-		const size_t len = MIN(get_length(handle) - offset, bufsize);
+	if (p && offset < length) {
+		const size_t len = MIN(length - offset, bufsize);
 		const size_t remained = contiguous < len? len - contiguous : 0;
 		const size_t cut = len - remained;
 
@@ -85,22 +104,28 @@ static size_t read_core(const struct ringbuf *handle,
 
 static bool consume_core(struct ringbuf *handle, const size_t consume_size)
 {
+#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+	/* the data read before should not have been overwritten */
+	atomic_thread_fence(memory_order_acquire);
+#endif
+	if (is_overwritten(handle, handle->outdex)) {
+		handle->dropped += handle->oldest - handle->outdex;
+		handle->outdex = handle->oldest;
+		return false;
+	}
+
 	if (get_length(handle) < consume_size) {
 		return false;
 	}
 
-#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
-	atomic_thread_fence(memory_order_acquire);
-#endif
 	handle->outdex += consume_size;
 
 	return true;
 }
 
-size_t ringbuf_write(struct ringbuf *handle,
-		const void *data, const size_t datasize)
+static void write_core(struct ringbuf *handle,
+		const void *data, const size_t len)
 {
-	const size_t len = MIN(get_available(handle), datasize);
 	const size_t index = GET_INDEX(handle->index, handle->capacity);
 	const size_t contiguous = handle->capacity - index;
 	const size_t remained = (contiguous < len)? len - contiguous : 0;
@@ -113,10 +138,101 @@ size_t ringbuf_write(struct ringbuf *handle,
 	atomic_thread_fence(memory_order_release);
 #endif
 	handle->index += len;
+}
+
+static void update_oldest(struct ringbuf *handle, const size_t oldest)
+{
+	handle->oldest = oldest;
+#if __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+	/* let the consumer know before the data gets overwritten */
+	atomic_thread_fence(memory_order_release);
+#endif
+}
+
+static size_t drop_oldest(struct ringbuf *handle, const size_t size,
+		void *header, const size_t header_size,
+		ringbuf_record_size_t get_record_size)
+{
+	const size_t index = handle->index;
+	size_t oldest = get_outdex(handle);
+	size_t count = 0;
+
+	while (handle->capacity - (index - oldest) < size) {
+		if (get_record_size == NULL) {
+			count = index + size - handle->capacity - oldest;
+			oldest += count;
+			break;
+		}
+
+		const size_t pos = GET_INDEX(oldest, handle->capacity);
+		const size_t contiguous = handle->capacity - pos;
+
+		if (header_size <= contiguous) {
+			memcpy(header, &handle->buffer[pos], header_size);
+		} else {
+			memcpy(header, &handle->buffer[pos], contiguous);
+			memcpy((uint8_t *)header + contiguous, handle->buffer,
+					header_size - contiguous);
+		}
+
+		const size_t record_size = (*get_record_size)(header);
+
+		if (record_size == 0 || record_size > index - oldest) {
+			oldest = index;
+		} else {
+			oldest += record_size;
+		}
+
+		count++;
+	}
+
+	update_oldest(handle, oldest);
+
+	return count;
+}
+
+size_t ringbuf_write(struct ringbuf *handle,
+		const void *data, const size_t datasize)
+{
+	const size_t available = get_available(handle);
+	const size_t len = MIN(available, datasize);
+
+	/* keep the oldest from falling too far behind to compare with */
+	handle->oldest = get_outdex(handle);
+	write_core(handle, data, len);
+
+	return len;
+}
+
+size_t ringbuf_write_overwrite(struct ringbuf *handle,
+		const void *data, const size_t datasize)
+{
+	const size_t len = MIN(handle->capacity, datasize);
+
+	drop_oldest(handle, len, NULL, 0, NULL);
+	write_core(handle, (const uint8_t *)data + datasize - len, len);
 
 	return len;
 }
 
+size_t ringbuf_drop_oldest(struct ringbuf *handle, const size_t size,
+		void *header, const size_t header_size,
+		ringbuf_record_size_t get_record_size)
+{
+	if (size > handle->capacity || header == NULL ||
+			header_size == 0 || header_size > handle->capacity ||
+			get_record_size == NULL) {
+		return 0;
+	}
+
+	return drop_oldest(handle, size, header, header_size, get_record_size);
+}
+
+size_t ringbuf_dropped(const struct ringbuf *handle)
+{
+	return handle->dropped;
+}
+
 size_t ringbuf_write_cancel(struct ringbuf *handle, const size_t size)
 {
 	if (get_length(handle) < size) {
@@ -143,7 +259,9 @@ const void *ringbuf_peek_pointer(const struct ringbuf *handle,
 	const void *p = get_pointer(handle, offset, contiguous);
 
 	if (contiguous) {
-		*contiguous = MIN(*contiguous, get_length(handle) - offset);
+		const size_t length = get_length(handle);
+		*contiguous = offset < length?
+			MIN(*contiguous, length - offset) : 0;
 	}
 
 	return p;
@@ -157,11 +275,11 @@ bool ringbuf_consume(struct ringbuf *handle, const size_t consume_size)
 size_t ringbuf_read(struct ringbuf *handle,
 		const size_t offset, void *buf, const size_t bufsize)
 {
-	size_t bytes_read = read_core(handle, offset, buf, bufsize);
+	size_t bytes_read;
 
-	if (bytes_read > 0) {
-		consume_core(handle, bytes_read + offset);
-	}
+	do {
+		bytes_read = read_core(handle, offset, buf, bufsize);
+	} while (bytes_read > 0 && !consume_core(handle, bytes_read + offset));
 
 	return bytes_read;
 }
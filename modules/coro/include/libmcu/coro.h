@@ -0,0 +1,234 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_CORO_H
+#define LIBMCU_CORO_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "libmcu/llist.h"
+
+#if !defined(CORO_POLL_INTERVAL_MS)
+/** How often the polling awaits get evaluated while nothing else is ready */
+#define CORO_POLL_INTERVAL_MS		10U
+#endif
+
+#define CORO_WAIT_FOREVER		UINT32_MAX
+#define CORO_NO_DEADLINE		UINT32_MAX
+
+typedef enum {
+	CORO_YIELDED,	/**< ready to run again in the next pass */
+	CORO_POLLING,	/**< waiting on a polled condition */
+	CORO_WAITING,	/**< sleeping or waiting for an event */
+	CORO_DONE,
+} coro_status_t;
+
+struct coro;
+struct coro_sched;
+
+typedef coro_status_t (*coro_func_t)(struct coro *co, void *ctx);
+typedef void (*coro_wakeup_t)(void *ctx);
+
+struct coro_event {
+	struct coro_sched *sched;
+	bool signaled;
+};
+
+struct coro {
+	struct llist link;
+	coro_func_t func;
+	void *ctx;
+	struct coro_event *event;
+	uint32_t deadline_ms;
+	/** result of the last await. 0 or the result of the awaited
+	 * operation on success, -ETIMEDOUT on timeout */
+	int err;
+	uint16_t line;
+	uint8_t state;
+	bool has_deadline;
+	/** set under the scheduler lock while the body is being called */
+	bool running;
+	/** cancelled while running. The scheduler stops it on return */
+	bool cancelled;
+};
+
+struct coro_sched {
+	struct llist coros;
+	pthread_mutex_t lock;
+	coro_wakeup_t wakeup;
+	void *wakeup_ctx;
+};
+
+/*
+ * Coroutine body. Local variables do not survive across the await points as
+ * there is no stack of its own. Keep the state in @p ctx instead. No more than
+ * one await point is allowed in a line and no await inside a switch statement.
+ *
+ *	static coro_status_t session(struct coro *co, void *ctx) {
+ *		struct session *s = ctx;
+ *		CORO_BEGIN(co);
+ *		while (s->running) {
+ *			CORO_AWAIT_MSGQ(co, s->q, s->buf, sizeof(s->buf), 1000);
+ *			if (co->err > 0) {
+ *				handle(s, co->err);
+ *			}
+ *		}
+ *		CORO_END(co);
+ *	}
+ */
+#define CORO_BEGIN(co)			switch ((co)->line) { case 0:
+#define CORO_END(co)			default: break; } return CORO_DONE
+
+#define CORO_MARK(co)			\
+	(co)->line = (uint16_t)__LINE__; case __LINE__:
+
+#define CORO_YIELD(co) do {		\
+	(co)->line = (uint16_t)__LINE__;\
+	return CORO_YIELDED;		\
+	case __LINE__:;			\
+} while (0)
+
+/** Sleep for @p ms without blocking the other coroutines. */
+#define CORO_SLEEP(co, ms) do {		\
+	coro_prepare_sleep(co, ms);	\
+	(co)->line = (uint16_t)__LINE__;\
+	return CORO_WAITING;		\
+	case __LINE__:;			\
+} while (0)
+
+/** Wait for @ref coro_event_signal. co->err is 0 when signaled, -ETIMEDOUT on
+ * timeout. Signal it from an apptimer callback to await a timer. */
+#define CORO_AWAIT_EVENT(co, ev, timeout_ms) do {		\
+	if (coro_prepare_event(co, ev, timeout_ms)) {		\
+		(co)->line = (uint16_t)__LINE__;		\
+		return CORO_WAITING;				\
+		case __LINE__:;					\
+	}							\
+} while (0)
+
+/** Poll @p cond. co->err is 0 when it gets true, -ETIMEDOUT on timeout. */
+#define CORO_AWAIT_UNTIL(co, cond, timeout_ms) do {		\
+	coro_set_timeout(co, timeout_ms);			\
+	CORO_MARK(co)						\
+	if ((cond)) {						\
+		(co)->err = 0;					\
+	} else if (coro_is_timedout(co)) {			\
+		(co)->err = -ETIMEDOUT;				\
+	} else {						\
+		return CORO_POLLING;				\
+	}							\
+} while (0)
+
+/** Receive a message. co->err is the message length on success. */
+#define CORO_AWAIT_MSGQ(co, q, buf, bufsize, timeout_ms) do {	\
+	CORO_AWAIT_UNTIL(co, msgq_len(q) > 0, timeout_ms);	\
+	if ((co)->err == 0) {					\
+		(co)->err = msgq_pop(q, buf, bufsize);		\
+	}							\
+} while (0)
+
+/** Read from an L4 connection in a bounded busy poll. l4_read() is called once
+ * in each poll, every @ref CORO_POLL_INTERVAL_MS while the others are idle, and
+ * blocks the whole scheduler up to the timeout_ms of the connection when
+ * nothing has arrived. Keep that timeout to a few milliseconds. co->err is the
+ * number of bytes read, the error returned by l4_read() or -ETIMEDOUT. */
+#define CORO_AWAIT_L4_READ(co, conn, buf, bufsize, timeout_ms) do {	\
+	coro_set_timeout(co, timeout_ms);				\
+	CORO_MARK(co)							\
+	if (((co)->err = l4_read(conn, buf, bufsize)) == 0) {		\
+		if (!coro_is_timedout(co)) {				\
+			return CORO_POLLING;				\
+		}							\
+		(co)->err = -ETIMEDOUT;					\
+	}								\
+} while (0)
+
+/**
+ * @brief Initialize a scheduler.
+ *
+ * @param[in] sched The scheduler.
+ * @param[in] wakeup Called when a coroutine gets ready from another thread,
+ *            to wake up the loop running @ref coro_sched_run. e.g. posting a
+ *            job to a jobqueue. NULL if not needed.
+ * @param[in] ctx User context passed to @p wakeup.
+ */
+void coro_sched_init(struct coro_sched *sched,
+		coro_wakeup_t wakeup, void *ctx);
+
+/**
+ * @brief Run the ready coroutines once each.
+ *
+ * Call it from the main loop or a job, sleeping for the time returned.
+ *
+ * @param[in] sched The scheduler.
+ *
+ * @return Time in milliseconds until any coroutine gets ready. 0 to run again
+ *         right away, @ref CORO_NO_DEADLINE if every coroutine is waiting for
+ *         an event without timeout or none is there.
+ */
+uint32_t coro_sched_run(struct coro_sched *sched);
+
+/**
+ * @brief Get the number of coroutines not done yet.
+ */
+int coro_sched_count(struct coro_sched *sched);
+
+/**
+ * @brief Start a coroutine.
+ *
+ * It can be called from any thread.
+ *
+ * @param[in] sched The scheduler.
+ * @param[in] co Coroutine storage to be kept until done.
+ * @param[in] func Coroutine body.
+ * @param[in] ctx User context passed to @p func.
+ *
+ * @return 0 on success, -EINVAL on invalid parameters.
+ */
+int coro_spawn(struct coro_sched *sched, struct coro *co,
+		coro_func_t func, void *ctx);
+
+/**
+ * @brief Stop a coroutine not done yet.
+ *
+ * It can be called from any thread. A coroutine being run at the moment is
+ * stopped by the scheduler once its body returns, so @ref coro_is_done may
+ * still be false right after it.
+ *
+ * @return 0 on success, -ENOENT if already done or cancelled.
+ */
+int coro_cancel(struct coro_sched *sched, struct coro *co);
+bool coro_is_done(const struct coro *co);
+
+void coro_event_init(struct coro_event *ev, struct coro_sched *sched);
+
+/**
+ * @brief Wake up the coroutine waiting for the event.
+ *
+ * The event stays signaled until a coroutine consumes it. It can be called
+ * from any thread.
+ */
+void coro_event_signal(struct coro_event *ev);
+
+/* internal helpers for the await macros */
+void coro_prepare_sleep(struct coro *co, uint32_t ms);
+bool coro_prepare_event(struct coro *co, struct coro_event *ev,
+		uint32_t timeout_ms);
+void coro_set_timeout(struct coro *co, uint32_t timeout_ms);
+bool coro_is_timedout(const struct coro *co);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_CORO_H */
@@ -0,0 +1,268 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/coro.h"
+#include "libmcu/board.h"
+
+typedef enum {
+	CORO_STATE_READY,
+	CORO_STATE_POLLING,
+	CORO_STATE_SLEEPING,
+	CORO_STATE_BLOCKED,
+	CORO_STATE_DONE,
+} coro_state_t;
+
+static uint32_t get_time_ms(void)
+{
+	return (uint32_t)board_get_time_since_boot_ms();
+}
+
+static uint32_t get_time_left(const struct coro *co, uint32_t now)
+{
+	if (!co->has_deadline) {
+		return CORO_NO_DEADLINE;
+	}
+
+	const int32_t left = (int32_t)(co->deadline_ms - now);
+	return left > 0? (uint32_t)left : 0;
+}
+
+static uint32_t min_u32(uint32_t a, uint32_t b)
+{
+	return a < b? a : b;
+}
+
+/* It should be called with the lock held. Returns true if the coroutine got
+ * ready to run. */
+static bool update_state(struct coro *co, uint32_t now)
+{
+	switch (co->state) {
+	case CORO_STATE_READY:
+	case CORO_STATE_POLLING:
+		return true;
+	case CORO_STATE_SLEEPING:
+		if (get_time_left(co, now) == 0) {
+			co->state = CORO_STATE_READY;
+			return true;
+		}
+		break;
+	case CORO_STATE_BLOCKED:
+		if (co->event->signaled) {
+			co->event->signaled = false;
+			co->err = 0;
+		} else if (get_time_left(co, now) == 0) {
+			co->err = -ETIMEDOUT;
+		} else {
+			break;
+		}
+		co->event = NULL;
+		co->state = CORO_STATE_READY;
+		return true;
+	default:
+		break;
+	}
+
+	return false;
+}
+
+/* It should be called with the lock held. */
+static uint32_t get_next_wake(const struct coro *co, uint32_t now)
+{
+	switch (co->state) {
+	case CORO_STATE_READY:
+		return 0;
+	case CORO_STATE_POLLING:
+		return min_u32(CORO_POLL_INTERVAL_MS, get_time_left(co, now));
+	case CORO_STATE_SLEEPING:
+	case CORO_STATE_BLOCKED:
+		return get_time_left(co, now);
+	default:
+		return CORO_NO_DEADLINE;
+	}
+}
+
+static void set_state_from_status(struct coro *co, coro_status_t status)
+{
+	switch (status) {
+	case CORO_YIELDED:
+		co->state = CORO_STATE_READY;
+		break;
+	case CORO_POLLING:
+		co->state = CORO_STATE_POLLING;
+		break;
+	case CORO_WAITING: /* already set by the await */
+		break;
+	case CORO_DONE:
+	default:
+		co->state = CORO_STATE_DONE;
+		break;
+	}
+}
+
+uint32_t coro_sched_run(struct coro_sched *sched)
+{
+	uint32_t next = CORO_NO_DEADLINE;
+
+	pthread_mutex_lock(&sched->lock);
+
+	struct llist *pos = sched->coros.next;
+
+	while (pos != &sched->coros) {
+		struct coro *co = llist_entry(pos, struct coro, link);
+
+		if (update_state(co, get_time_ms())) {
+			co->running = true;
+			pthread_mutex_unlock(&sched->lock);
+			const coro_status_t status = (*co->func)(co, co->ctx);
+			pthread_mutex_lock(&sched->lock);
+			co->running = false;
+
+			set_state_from_status(co, status);
+
+			if (co->cancelled) {
+				co->state = CORO_STATE_DONE;
+			}
+		}
+
+		/* taken after the call as the others may have been cancelled
+		 * while the lock was released. The running one stays linked */
+		pos = pos->next;
+
+		if (co->state == CORO_STATE_DONE) {
+			llist_del(&co->link);
+		} else {
+			next = min_u32(next, get_next_wake(co, get_time_ms()));
+		}
+	}
+
+	pthread_mutex_unlock(&sched->lock);
+
+	return next;
+}
+
+int coro_sched_count(struct coro_sched *sched)
+{
+	pthread_mutex_lock(&sched->lock);
+	const int count = llist_count(&sched->coros);
+	pthread_mutex_unlock(&sched->lock);
+
+	return count;
+}
+
+static void wakeup(struct coro_sched *sched)
+{
+	if (sched->wakeup) {
+		(*sched->wakeup)(sched->wakeup_ctx);
+	}
+}
+
+int coro_spawn(struct coro_sched *sched, struct coro *co,
+		coro_func_t func, void *ctx)
+{
+	if (!sched || !co || !func) {
+		return -EINVAL;
+	}
+
+	*co = (struct coro) {
+		.func = func,
+		.ctx = ctx,
+		.state = CORO_STATE_READY,
+	};
+
+	pthread_mutex_lock(&sched->lock);
+	llist_add_tail(&co->link, &sched->coros);
+	pthread_mutex_unlock(&sched->lock);
+
+	wakeup(sched);
+
+	return 0;
+}
+
+int coro_cancel(struct coro_sched *sched, struct coro *co)
+{
+	int err = -ENOENT;
+
+	pthread_mutex_lock(&sched->lock);
+	if (co->state != CORO_STATE_DONE && !co->cancelled) {
+		if (co->running) {
+			/* leave it to the scheduler not to race with the body */
+			co->cancelled = true;
+		} else {
+			llist_del(&co->link);
+			co->state = CORO_STATE_DONE;
+		}
+		err = 0;
+	}
+	pthread_mutex_unlock(&sched->lock);
+
+	return err;
+}
+
+bool coro_is_done(const struct coro *co)
+{
+	return co->state == CORO_STATE_DONE;
+}
+
+void coro_set_timeout(struct coro *co, uint32_t timeout_ms)
+{
+	co->has_deadline = timeout_ms != CORO_WAIT_FOREVER;
+	co->deadline_ms = get_time_ms() + timeout_ms;
+}
+
+bool coro_is_timedout(const struct coro *co)
+{
+	return get_time_left(co, get_time_ms()) == 0;
+}
+
+void coro_prepare_sleep(struct coro *co, uint32_t ms)
+{
+	coro_set_timeout(co, ms);
+	co->state = CORO_STATE_SLEEPING;
+}
+
+bool coro_prepare_event(struct coro *co, struct coro_event *ev,
+		uint32_t timeout_ms)
+{
+	bool wait = true;
+
+	pthread_mutex_lock(&ev->sched->lock);
+	if (ev->signaled) {
+		ev->signaled = false;
+		co->err = 0;
+		wait = false;
+	} else {
+		coro_set_timeout(co, timeout_ms);
+		co->event = ev;
+		co->state = CORO_STATE_BLOCKED;
+	}
+	pthread_mutex_unlock(&ev->sched->lock);
+
+	return wait;
+}
+
+void coro_event_signal(struct coro_event *ev)
+{
+	pthread_mutex_lock(&ev->sched->lock);
+	ev->signaled = true;
+	pthread_mutex_unlock(&ev->sched->lock);
+
+	wakeup(ev->sched);
+}
+
+void coro_event_init(struct coro_event *ev, struct coro_sched *sched)
+{
+	ev->sched = sched;
+	ev->signaled = false;
+}
+
+void coro_sched_init(struct coro_sched *sched,
+		coro_wakeup_t wakeup_func, void *ctx)
+{
+	llist_init(&sched->coros);
+	pthread_mutex_init(&sched->lock, NULL);
+	sched->wakeup = wakeup_func;
+	sched->wakeup_ctx = ctx;
+}
@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_L4POOL_H
+#define LIBMCU_L4POOL_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "libmcu/l4.h"
+#include "libmcu/retry.h"
+
+#if !defined(L4POOL_MAX_CONNECTIONS)
+#define L4POOL_MAX_CONNECTIONS		4U
+#endif
+
+struct l4pool;
+
+/**
+ * @brief Health check callback for an idle connection.
+ *
+ * Typically sends a protocol level keep-alive, e.g. MQTT PINGREQ.
+ *
+ * @param[in] conn The connected L4 instance to be checked.
+ * @param[in] ctx User context given to @ref l4pool_set_health_check.
+ *
+ * @return 0 when the connection is still usable. Otherwise the connection
+ *         gets closed.
+ */
+typedef int (*l4pool_health_check_t)(struct l4 *conn, void *ctx);
+
+struct l4pool_param {
+	/** maximum number of connections opened at the same time including
+	 * leased ones. It should not exceed @ref L4POOL_MAX_CONNECTIONS. */
+	uint8_t max_connections;
+	/** an idle connection gets closed after this time. 0 to keep it
+	 * forever. */
+	uint32_t idle_timeout_ms;
+	/** an idle connection gets health checked at this interval. 0 to
+	 * disable. */
+	uint32_t keepalive_interval_ms;
+	/** backoff applied to reconnection attempts per endpoint */
+	struct retry_param retry;
+};
+
+/**
+ * @brief Create a connection pool.
+ *
+ * @param[in] param Pool parameters.
+ *
+ * @return A pointer to the pool on success, NULL otherwise.
+ */
+struct l4pool *l4pool_create(const struct l4pool_param *param);
+
+/**
+ * @brief Destroy a connection pool.
+ *
+ * All the connections in the pool, including leased ones, get disconnected
+ * and destroyed.
+ *
+ * @param[in] self The pool to destroy.
+ */
+void l4pool_destroy(struct l4pool *self);
+
+/**
+ * @brief Set the health check function for idle connections.
+ *
+ * @param[in] self The pool.
+ * @param[in] func Health check function. NULL to disable.
+ * @param[in] ctx User context passed to @p func.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int l4pool_set_health_check(struct l4pool *self,
+		l4pool_health_check_t func, void *ctx);
+
+/**
+ * @brief Lease a connected L4 instance for the given endpoint and port.
+ *
+ * An idle connection to the same endpoint and port is handed out when
+ * available, skipping the connection handshake. Otherwise a new connection is
+ * made with @p param.
+ *
+ * @note @p param is stored in the pool as is. Buffers it points to such as
+ *       the endpoint and certificates should stay valid as long as the pool
+ *       lives.
+ *
+ * @param[in] self The pool.
+ * @param[in] param Connection parameters, keyed by endpoint and port.
+ * @param[out] conn The connected L4 instance.
+ *
+ * @return 0 on success. -EBUSY when all the connections are leased, -EAGAIN
+ *         while backing off from a previous connection failure,
+ *         -ETIMEDOUT when the retry attempts are exhausted, or the error
+ *         returned by @ref l4_connect.
+ */
+int l4pool_acquire(struct l4pool *self,
+		const struct l4_conn_param *param, struct l4 **conn);
+
+/**
+ * @brief Give a leased connection back to the pool to be reused.
+ *
+ * @param[in] self The pool.
+ * @param[in] conn The connection leased by @ref l4pool_acquire.
+ *
+ * @return 0 on success, -ENOENT if @p conn is not leased from the pool.
+ */
+int l4pool_release(struct l4pool *self, struct l4 *conn);
+
+/**
+ * @brief Give a broken connection back to the pool.
+ *
+ * The connection gets closed and the next acquisition for the endpoint is
+ * delayed by the retry backoff.
+ *
+ * @param[in] self The pool.
+ * @param[in] conn The connection leased by @ref l4pool_acquire.
+ *
+ * @return 0 on success, -ENOENT if @p conn is not leased from the pool.
+ */
+int l4pool_invalidate(struct l4pool *self, struct l4 *conn);
+
+/**
+ * @brief Run keep-alive bookkeeping for idle connections.
+ *
+ * Idle connections get closed on idle timeout and health checked on keep-alive
+ * interval. It is supposed to be called periodically.
+ *
+ * @param[in] self The pool.
+ */
+void l4pool_step(struct l4pool *self);
+
+/**
+ * @brief Get the number of connections opened in the pool.
+ *
+ * @param[in] self The pool.
+ *
+ * @return The number of connections, leased or idle.
+ */
+uint8_t l4pool_count(struct l4pool *self);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_L4POOL_H */
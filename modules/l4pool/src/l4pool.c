@@ -0,0 +1,436 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/l4pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "libmcu/board.h"
+
+typedef enum {
+	ENTRY_FREE,
+	ENTRY_IDLE,
+	ENTRY_LEASED,
+	ENTRY_BACKOFF,
+} entry_state_t;
+
+struct l4pool_entry {
+	struct l4_conn_param param;
+	struct l4 *conn;
+	struct retry retry;
+
+	entry_state_t state;
+
+	unsigned long last_used_ms;
+	unsigned long last_checked_ms;
+	unsigned long backoff_start_ms;
+	uint32_t backoff_ms;
+};
+
+struct l4pool {
+	struct l4pool_param param;
+	struct l4pool_entry entries[L4POOL_MAX_CONNECTIONS];
+
+	l4pool_health_check_t health_check;
+	void *health_check_ctx;
+
+	pthread_mutex_t lock;
+};
+
+static bool is_same_endpoint(const struct l4_conn_param *a,
+		const struct l4_conn_param *b)
+{
+	return a->port == b->port && a->endpoint_len == b->endpoint_len &&
+		memcmp(a->endpoint, b->endpoint, a->endpoint_len) == 0;
+}
+
+static bool is_opened(const struct l4pool_entry *entry)
+{
+	return entry->state == ENTRY_IDLE || entry->state == ENTRY_LEASED;
+}
+
+static uint8_t count_opened(const struct l4pool *self)
+{
+	uint8_t count = 0;
+
+	for (unsigned int i = 0; i < L4POOL_MAX_CONNECTIONS; i++) {
+		if (is_opened(&self->entries[i])) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+static struct l4pool_entry *find_by_state(struct l4pool *self,
+		const struct l4_conn_param *param, entry_state_t state)
+{
+	for (unsigned int i = 0; i < L4POOL_MAX_CONNECTIONS; i++) {
+		struct l4pool_entry *p = &self->entries[i];
+		if (p->state == state && is_same_endpoint(&p->param, param)) {
+			return p;
+		}
+	}
+
+	return NULL;
+}
+
+static struct l4pool_entry *find_by_conn(struct l4pool *self,
+		const struct l4 *conn)
+{
+	for (unsigned int i = 0; i < L4POOL_MAX_CONNECTIONS; i++) {
+		struct l4pool_entry *p = &self->entries[i];
+		if (p->state == ENTRY_LEASED && p->conn == conn) {
+			return p;
+		}
+	}
+
+	return NULL;
+}
+
+static struct l4pool_entry *find_oldest(struct l4pool *self,
+		entry_state_t state, unsigned long now)
+{
+	struct l4pool_entry *oldest = NULL;
+
+	for (unsigned int i = 0; i < L4POOL_MAX_CONNECTIONS; i++) {
+		struct l4pool_entry *p = &self->entries[i];
+		if (p->state != state) {
+			continue;
+		}
+		if (!oldest || (now - p->last_used_ms) >
+				(now - oldest->last_used_ms)) {
+			oldest = p;
+		}
+	}
+
+	return oldest;
+}
+
+static struct l4pool_entry *find_free(struct l4pool *self)
+{
+	for (unsigned int i = 0; i < L4POOL_MAX_CONNECTIONS; i++) {
+		if (self->entries[i].state == ENTRY_FREE) {
+			return &self->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static bool is_backing_off(const struct l4pool_entry *entry, unsigned long now)
+{
+	return (now - entry->backoff_start_ms) < entry->backoff_ms;
+}
+
+static void close_connection(struct l4 *conn)
+{
+	if (conn) {
+		l4_disconnect(conn);
+		l4_destroy_default(conn);
+	}
+}
+
+static void clear_entry(struct l4pool_entry *entry)
+{
+	entry->state = ENTRY_FREE;
+	entry->conn = NULL;
+	entry->backoff_ms = 0;
+	retry_reset(&entry->retry);
+}
+
+/* It should be called with the lock held. Returns -ETIMEDOUT when the retry
+ * attempts are exhausted, resetting the entry to start over next time. */
+static int backoff_entry(struct l4pool_entry *entry, unsigned long now)
+{
+	uint32_t backoff_ms;
+
+	entry->conn = NULL;
+
+	if (retry_backoff(&entry->retry, &backoff_ms,
+			(uint16_t)board_random()) != RETRY_ERROR_NONE) {
+		clear_entry(entry);
+		return -ETIMEDOUT;
+	}
+
+	entry->state = ENTRY_BACKOFF;
+	entry->backoff_start_ms = now;
+	entry->backoff_ms = backoff_ms;
+
+	return 0;
+}
+
+/* It should be called with the lock held. An idle connection to another
+ * endpoint gets evicted to make room when the pool is full. */
+static int reserve_entry(struct l4pool *self,
+		const struct l4_conn_param *param, unsigned long now,
+		struct l4pool_entry **reserved, struct l4 **evicted)
+{
+	struct l4pool_entry *entry = find_by_state(self, param, ENTRY_BACKOFF);
+
+	if (entry && is_backing_off(entry, now)) {
+		return -EAGAIN;
+	}
+
+	if (count_opened(self) >= self->param.max_connections) {
+		struct l4pool_entry *victim = find_oldest(self, ENTRY_IDLE, now);
+		if (!victim) {
+			return -EBUSY;
+		}
+		*evicted = victim->conn;
+		clear_entry(victim);
+	}
+
+	if (!entry && !(entry = find_free(self))) {
+		entry = find_oldest(self, ENTRY_BACKOFF, now);
+		clear_entry(entry);
+	}
+
+	if (entry->state == ENTRY_FREE) {
+		retry_new_static(&entry->retry, &self->param.retry);
+	}
+
+	entry->param = *param;
+	entry->conn = NULL;
+	entry->state = ENTRY_LEASED;
+
+	*reserved = entry;
+
+	return 0;
+}
+
+static int connect_entry(struct l4pool *self, struct l4pool_entry *entry)
+{
+	struct l4 *conn = l4_create_default(&entry->param);
+	int err = -ENOMEM;
+
+	if (conn && (err = l4_connect(conn)) == 0) {
+		pthread_mutex_lock(&self->lock);
+		entry->conn = conn;
+		entry->last_used_ms = board_get_time_since_boot_ms();
+		entry->last_checked_ms = entry->last_used_ms;
+		retry_reset(&entry->retry);
+		pthread_mutex_unlock(&self->lock);
+		return 0;
+	}
+
+	if (conn) {
+		l4_destroy_default(conn);
+	}
+
+	pthread_mutex_lock(&self->lock);
+	const int rc = backoff_entry(entry, board_get_time_since_boot_ms());
+	pthread_mutex_unlock(&self->lock);
+
+	return rc? rc : err;
+}
+
+static bool is_healthy(struct l4pool *self, struct l4pool_entry *entry)
+{
+	if (!self->health_check) {
+		return true;
+	}
+
+	return (*self->health_check)(entry->conn, self->health_check_ctx) == 0;
+}
+
+static bool need_health_check(const struct l4pool *self,
+		const struct l4pool_entry *entry, unsigned long now)
+{
+	return self->health_check && self->param.keepalive_interval_ms &&
+		(now - entry->last_checked_ms) >=
+			self->param.keepalive_interval_ms;
+}
+
+static bool is_expired(const struct l4pool *self,
+		const struct l4pool_entry *entry, unsigned long now)
+{
+	return self->param.idle_timeout_ms &&
+		(now - entry->last_used_ms) >= self->param.idle_timeout_ms;
+}
+
+int l4pool_acquire(struct l4pool *self,
+		const struct l4_conn_param *param, struct l4 **conn)
+{
+	struct l4 *evicted = NULL;
+	struct l4pool_entry *entry = NULL;
+	bool check = false;
+	int err = 0;
+
+	if (!self || !param || !conn) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&self->lock);
+	const unsigned long now = board_get_time_since_boot_ms();
+
+	if ((entry = find_by_state(self, param, ENTRY_IDLE)) != NULL) {
+		entry->state = ENTRY_LEASED;
+		check = need_health_check(self, entry, now);
+	} else {
+		err = reserve_entry(self, param, now, &entry, &evicted);
+	}
+	pthread_mutex_unlock(&self->lock);
+
+	close_connection(evicted);
+
+	if (err) {
+		return err;
+	}
+
+	if (check) {
+		if (is_healthy(self, entry)) {
+			entry->last_checked_ms = now;
+		} else {
+			close_connection(entry->conn);
+			entry->conn = NULL;
+		}
+	}
+
+	if (!entry->conn && (err = connect_entry(self, entry)) != 0) {
+		return err;
+	}
+
+	*conn = entry->conn;
+
+	return 0;
+}
+
+int l4pool_release(struct l4pool *self, struct l4 *conn)
+{
+	int err = -ENOENT;
+
+	pthread_mutex_lock(&self->lock);
+	struct l4pool_entry *entry = find_by_conn(self, conn);
+	if (entry) {
+		entry->state = ENTRY_IDLE;
+		entry->last_used_ms = board_get_time_since_boot_ms();
+		err = 0;
+	}
+	pthread_mutex_unlock(&self->lock);
+
+	return err;
+}
+
+int l4pool_invalidate(struct l4pool *self, struct l4 *conn)
+{
+	pthread_mutex_lock(&self->lock);
+	struct l4pool_entry *entry = find_by_conn(self, conn);
+	if (entry) {
+		backoff_entry(entry, board_get_time_since_boot_ms());
+	}
+	pthread_mutex_unlock(&self->lock);
+
+	if (!entry) {
+		return -ENOENT;
+	}
+
+	close_connection(conn);
+
+	return 0;
+}
+
+void l4pool_step(struct l4pool *self)
+{
+	for (unsigned int i = 0; i < L4POOL_MAX_CONNECTIONS; i++) {
+		struct l4pool_entry *entry = &self->entries[i];
+		struct l4 *expired = NULL;
+		bool check = false;
+
+		pthread_mutex_lock(&self->lock);
+		const unsigned long now = board_get_time_since_boot_ms();
+		if (entry->state == ENTRY_IDLE) {
+			if (is_expired(self, entry, now)) {
+				expired = entry->conn;
+				clear_entry(entry);
+			} else if (need_health_check(self, entry, now)) {
+				entry->state = ENTRY_LEASED;
+				check = true;
+			}
+		}
+		pthread_mutex_unlock(&self->lock);
+
+		if (check && !is_healthy(self, entry)) {
+			expired = entry->conn;
+		}
+
+		close_connection(expired);
+
+		if (check) {
+			pthread_mutex_lock(&self->lock);
+			if (expired) {
+				clear_entry(entry);
+			} else {
+				entry->state = ENTRY_IDLE;
+				entry->last_checked_ms = now;
+			}
+			pthread_mutex_unlock(&self->lock);
+		}
+	}
+}
+
+uint8_t l4pool_count(struct l4pool *self)
+{
+	pthread_mutex_lock(&self->lock);
+	const uint8_t count = count_opened(self);
+	pthread_mutex_unlock(&self->lock);
+
+	return count;
+}
+
+int l4pool_set_health_check(struct l4pool *self,
+		l4pool_health_check_t func, void *ctx)
+{
+	if (!self) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&self->lock);
+	self->health_check = func;
+	self->health_check_ctx = ctx;
+	pthread_mutex_unlock(&self->lock);
+
+	return 0;
+}
+
+struct l4pool *l4pool_create(const struct l4pool_param *param)
+{
+	struct l4pool *self;
+
+	if (!param || param->max_connections == 0 ||
+			param->max_connections > L4POOL_MAX_CONNECTIONS) {
+		return NULL;
+	}
+
+	if ((self = (struct l4pool *)calloc(1, sizeof(*self))) == NULL) {
+		return NULL;
+	}
+
+	self->param = *param;
+	pthread_mutex_init(&self->lock, NULL);
+
+	return self;
+}
+
+void l4pool_destroy(struct l4pool *self)
+{
+	if (!self) {
+		return;
+	}
+
+	for (unsigned int i = 0; i < L4POOL_MAX_CONNECTIONS; i++) {
+		struct l4pool_entry *entry = &self->entries[i];
+		if (is_opened(entry)) {
+			close_connection(entry->conn);
+		}
+	}
+
+	pthread_mutex_destroy(&self->lock);
+	free(self);
+}
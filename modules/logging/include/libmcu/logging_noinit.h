@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_LOGGING_NOINIT_H
+#define LIBMCU_LOGGING_NOINIT_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "libmcu/logging_backend.h"
+
+#if !defined(LOGGING_NOINIT_REPLAY_BUFSIZE)
+/** Records larger than this get dropped on replay */
+#define LOGGING_NOINIT_REPLAY_BUFSIZE	128
+#endif
+
+/**
+ * @brief Initialize the logging backend keeping logs in no-init RAM.
+ *
+ * The records written before a warm reset, e.g. watchdog reset or fault, are
+ * kept when @p buf holds a valid ring validated by its magic and CRC.
+ * Otherwise the ring gets cleared. The oldest records are dropped to make room
+ * when full.
+ *
+ * @note @p buf should be placed in a section not initialized at startup and
+ *       aligned to 4 bytes.
+ *
+ *	LIBMCU_NOINIT static uint8_t blackbox[1024];
+ *	logging_add_backend(logging_noinit_init(blackbox, sizeof(blackbox)));
+ *
+ * @param[in] buf Memory retained across resets.
+ * @param[in] bufsize Size of @p buf in bytes.
+ *
+ * @return The backend on success, NULL if @p buf is too small.
+ */
+const struct logging_backend *logging_noinit_init(void *buf, size_t bufsize);
+
+/**
+ * @brief Get the number of records recovered from the previous boot.
+ *
+ * @return The number of records found valid by @ref logging_noinit_init.
+ */
+size_t logging_noinit_recovered(void);
+
+/**
+ * @brief Move the records into another backend.
+ *
+ * Typically called at boot to persist the records that survived the reset
+ * into a flash backend.
+ *
+ * @param[in] backend The backend to write the records into.
+ *
+ * @return The number of records moved. Records stay in the ring from the one
+ *         that @p backend fails to write.
+ */
+size_t logging_noinit_replay(const struct logging_backend *backend);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_LOGGING_NOINIT_H */
@@ -0,0 +1,309 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/logging_noinit.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "libmcu/crc16.h"
+
+#define NOINIT_MAGIC			0x4c4f4742U /* "LOGB" */
+
+typedef uint16_t record_len_t;
+
+struct header {
+	uint32_t magic;
+	uint32_t capacity;
+	/* offsets in the ring, less than the capacity. The ring is full when
+	 * they are equal with any record in it */
+	uint32_t index;
+	uint32_t outdex;
+	uint32_t count;
+	uint16_t crc;
+	uint16_t reserved;
+};
+
+static size_t noinit_write(const void *data, size_t size);
+static size_t noinit_peek(void *buf, size_t bufsize);
+static size_t noinit_read(void *buf, size_t bufsize);
+static size_t noinit_consume(size_t size);
+static size_t noinit_count(void);
+
+static struct {
+	struct logging_backend ops;
+	pthread_mutex_t lock;
+	struct header *header;
+	uint8_t *ring;
+	size_t recovered;
+} m = {
+	.ops = {
+		.write = noinit_write,
+		.peek = noinit_peek,
+		.read = noinit_read,
+		.consume = noinit_consume,
+		.count = noinit_count,
+	},
+};
+
+static uint16_t compute_crc(const struct header *header)
+{
+	return crc16_modbus(header, offsetof(struct header, crc));
+}
+
+/* The header is updated at once after the ring so that a reset in the middle
+ * of writing a record leaves the previous state valid. */
+static void commit(uint32_t index, uint32_t outdex, uint32_t count)
+{
+	struct header *header = m.header;
+
+	header->index = index;
+	header->outdex = outdex;
+	header->count = count;
+	header->crc = compute_crc(header);
+}
+
+static uint32_t get_length(const struct header *header)
+{
+	if (header->count == 0) {
+		return 0;
+	} else if (header->index > header->outdex) {
+		return header->index - header->outdex;
+	}
+
+	return header->capacity - (header->outdex - header->index);
+}
+
+/* The capacity is not a power of 2, so the offsets are kept reduced instead
+ * of running free, which would jump on the wrap of uint32_t. */
+static uint32_t advance(uint32_t offset, uint32_t n)
+{
+	const uint32_t left = m.header->capacity - offset;
+	return n < left? offset + n : n - left;
+}
+
+static size_t get_contiguous(uint32_t pos, size_t size)
+{
+	const size_t contiguous = m.header->capacity - pos;
+	return size < contiguous? size : contiguous;
+}
+
+static void copy_in(uint32_t offset, const void *data, size_t size)
+{
+	const size_t cut = get_contiguous(offset, size);
+
+	memcpy(&m.ring[offset], data, cut);
+	memcpy(m.ring, (const uint8_t *)data + cut, size - cut);
+}
+
+static void copy_out(uint32_t offset, void *buf, size_t size)
+{
+	const size_t cut = get_contiguous(offset, size);
+
+	memcpy(buf, &m.ring[offset], cut);
+	memcpy((uint8_t *)buf + cut, m.ring, size - cut);
+}
+
+static record_len_t get_record_len(uint32_t offset)
+{
+	record_len_t len;
+	copy_out(offset, &len, sizeof(len));
+	return len;
+}
+
+/* Walk the records to see if they chain up exactly to the write offset. */
+static bool is_ring_valid(const struct header *header, size_t capacity)
+{
+	if (header->magic != NOINIT_MAGIC || header->capacity != capacity ||
+			header->crc != compute_crc(header) ||
+			header->index >= capacity ||
+			header->outdex >= capacity ||
+			(header->count == 0 && header->index != header->outdex)) {
+		return false;
+	}
+
+	uint32_t offset = header->outdex;
+	uint32_t left = get_length(header);
+	uint32_t count = 0;
+
+	while (left > 0) {
+		if (left < sizeof(record_len_t)) {
+			return false;
+		}
+
+		const record_len_t len = get_record_len(offset);
+		const uint32_t size = (uint32_t)(sizeof(record_len_t) + len);
+
+		if (len == 0 || size > left) {
+			return false;
+		}
+
+		offset = advance(offset, size);
+		left -= size;
+		count++;
+	}
+
+	return count == header->count && offset == header->index;
+}
+
+static size_t peek_internal(void *buf, size_t bufsize)
+{
+	if (m.header->count == 0) {
+		return 0;
+	}
+
+	const record_len_t len = get_record_len(m.header->outdex);
+
+	if (len > bufsize) {
+		return 0;
+	}
+
+	copy_out(advance(m.header->outdex, sizeof(len)), buf, len);
+
+	return len;
+}
+
+static size_t consume_internal(void)
+{
+	if (m.header->count == 0) {
+		return 0;
+	}
+
+	const record_len_t len = get_record_len(m.header->outdex);
+
+	commit(m.header->index,
+			advance(m.header->outdex, (uint32_t)(sizeof(len) + len)),
+			m.header->count - 1);
+
+	return len;
+}
+
+static size_t noinit_write(const void *data, size_t size)
+{
+	const record_len_t len = (record_len_t)size;
+	const uint32_t needed = (uint32_t)(sizeof(len) + size);
+
+	if (size == 0 || size > UINT16_MAX || needed > m.header->capacity) {
+		return 0;
+	}
+
+	pthread_mutex_lock(&m.lock);
+
+	while (m.header->capacity - get_length(m.header) < needed) {
+		consume_internal();
+	}
+
+	const uint32_t index = m.header->index;
+	copy_in(index, &len, sizeof(len));
+	copy_in(advance(index, sizeof(len)), data, size);
+	commit(advance(index, needed), m.header->outdex, m.header->count + 1);
+
+	pthread_mutex_unlock(&m.lock);
+
+	return size;
+}
+
+static size_t noinit_peek(void *buf, size_t bufsize)
+{
+	pthread_mutex_lock(&m.lock);
+	const size_t len = peek_internal(buf, bufsize);
+	pthread_mutex_unlock(&m.lock);
+
+	return len;
+}
+
+static size_t noinit_read(void *buf, size_t bufsize)
+{
+	pthread_mutex_lock(&m.lock);
+	const size_t len = peek_internal(buf, bufsize);
+	if (len) {
+		consume_internal();
+	}
+	pthread_mutex_unlock(&m.lock);
+
+	return len;
+}
+
+static size_t noinit_consume(size_t size)
+{
+	(void)size;
+
+	pthread_mutex_lock(&m.lock);
+	const size_t len = consume_internal();
+	pthread_mutex_unlock(&m.lock);
+
+	return len;
+}
+
+static size_t noinit_count(void)
+{
+	pthread_mutex_lock(&m.lock);
+	const size_t count = m.header->count;
+	pthread_mutex_unlock(&m.lock);
+
+	return count;
+}
+
+size_t logging_noinit_replay(const struct logging_backend *backend)
+{
+	uint8_t buf[LOGGING_NOINIT_REPLAY_BUFSIZE];
+	size_t count = 0;
+
+	if (backend == NULL || backend->write == NULL) {
+		return 0;
+	}
+
+	pthread_mutex_lock(&m.lock);
+	while (m.header->count > 0) {
+		const size_t len = peek_internal(buf, sizeof(buf));
+
+		/* a record larger than the buffer gets dropped */
+		if (len > 0 && (*backend->write)(buf, len) != len) {
+			break;
+		}
+
+		consume_internal();
+		count += len > 0;
+	}
+	pthread_mutex_unlock(&m.lock);
+
+	return count;
+}
+
+size_t logging_noinit_recovered(void)
+{
+	return m.recovered;
+}
+
+const struct logging_backend *logging_noinit_init(void *buf, size_t bufsize)
+{
+	if (buf == NULL || bufsize < sizeof(struct header) +
+			sizeof(record_len_t) + 1) {
+		return NULL;
+	}
+
+	const size_t capacity = bufsize - sizeof(struct header);
+
+	m.header = (struct header *)buf;
+	m.ring = (uint8_t *)buf + sizeof(struct header);
+	m.recovered = 0;
+
+	if (is_ring_valid(m.header, capacity)) {
+		m.recovered = m.header->count;
+	} else {
+		m.header->magic = NOINIT_MAGIC;
+		m.header->capacity = (uint32_t)capacity;
+		m.header->reserved = 0;
+		commit(0, 0, 0);
+	}
+
+	pthread_mutex_init(&m.lock, NULL);
+
+	return &m.ops;
+}
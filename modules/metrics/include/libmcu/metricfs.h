@@ -103,7 +103,7 @@ uint16_t metricfs_count(const struct metricfs *fs);
  * @brief Iterates over metrics in the metric file system.
  *
  * This function iterates over the metrics stored in the metric file system and
- * calls the provided callback function for each metric.
+ * calls the provided callback function for each metric, oldest first.
  *
  * @param[in] fs A pointer to the metric file system instance.
  * @param[in] cb The callback function to be called for each metric.
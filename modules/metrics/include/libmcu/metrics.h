@@ -21,14 +21,28 @@ extern "C" {
 
 #define METRICS_VALUE(x)		((metric_value_t)(x))
 
+typedef uint16_t metric_key_t;
+typedef int32_t metric_value_t;
+
+/*
+ * A gauge is defined with `METRICS_DEFINE_GAUGE(key, sampler)` in the
+ * definition file. The sampler is called only when metrics are collected or
+ * iterated, and returns false when no value is available at the moment.
+ */
 enum {
-#define METRICS_DEFINE(key)		key,
+#define METRICS_DEFINE_GAUGE(key, sampler)	key,
+#define METRICS_DEFINE(key)		METRICS_DEFINE_GAUGE(key, )
 #include METRICS_USER_DEFINES
 #undef METRICS_DEFINE
+#undef METRICS_DEFINE_GAUGE
 };
 
-typedef uint16_t metric_key_t;
-typedef int32_t metric_value_t;
+#define METRICS_DEFINE_GAUGE(key, sampler)	\
+	bool sampler(metric_value_t *value);
+#define METRICS_DEFINE(key)
+#include METRICS_USER_DEFINES
+#undef METRICS_DEFINE
+#undef METRICS_DEFINE_GAUGE
 
 /**
  * @brief Sets the value of a specific metric.
@@ -82,6 +96,8 @@ void metrics_set_max_min(const metric_key_t k_max, const metric_key_t k_min,
  * @brief Retrieves the value of a specific metric.
  *
  * This function retrieves the current value of the specified metric key.
+ * For a gauge, it is the value sampled in the last collection without calling
+ * the sampler.
  *
  * @param[in] key The metric key to retrieve the value for.
  *
@@ -131,6 +147,8 @@ bool metrics_is_set(const metric_key_t key);
 /**
  * @brief Traversing all metrics firing callback
  *
+ * Gauges are sampled before traversing.
+ *
  * @param callback_each callback to be fired every metric
  * @param ctx context to be used
  *
@@ -146,7 +164,7 @@ void metrics_iterate(void (*callback_each)(const metric_key_t key,
  *
  * This function collects all current metrics and stores them in the
  * provided buffer. The buffer should be large enough to hold all the
- * metrics data.
+ * metrics data. Gauges are sampled before encoding.
  *
  * @param[out] buf Pointer to the buffer where metrics data will be stored.
  * @param[in] bufsize Size of the buffer in bytes.
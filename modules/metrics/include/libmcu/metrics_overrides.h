@@ -12,6 +12,14 @@ extern "C" {
 #endif
 
 #include "libmcu/metrics.h"
+#include "libmcu/compiler.h"
+
+/** The layout of each metric in the storage. */
+struct metrics_entry {
+	metric_key_t key;
+	metric_value_t value;
+	bool is_set;
+} LIBMCU_PACKED;
 
 void metrics_lock_init(void);
 void metrics_lock(void);
@@ -33,6 +41,20 @@ size_t metrics_encode_header(void *buf, size_t bufsize,
 size_t metrics_encode_each(void *buf, size_t bufsize,
 		metric_key_t key, int32_t value);
 
+/**
+ * @brief Provide the memory to keep the metrics in.
+ *
+ * This function is called in `metrics_init()`. The memory holds an array of
+ * @ref metrics_entry, one for each metric plus one for internal use. The
+ * memory is not cleared unless forced or not initialized yet, the same way as
+ * the internal storage placed in no-init RAM.
+ *
+ * @param[in] size the number of bytes required
+ *
+ * @return memory of @p size bytes or NULL to use the internal storage
+ */
+void *metrics_storage_get(size_t size);
+
 #if defined(__cplusplus)
 }
 #endif
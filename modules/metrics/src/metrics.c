@@ -10,9 +10,11 @@
 #include "libmcu/assert.h"
 
 enum {
-#define METRICS_DEFINE(key)		METRICS_##key,
+#define METRICS_DEFINE_GAUGE(key, sampler)	METRICS_##key,
+#define METRICS_DEFINE(key)		METRICS_DEFINE_GAUGE(key, )
 #include METRICS_USER_DEFINES
 #undef METRICS_DEFINE
+#undef METRICS_DEFINE_GAUGE
 	METRICS_KEY_MAX,
 };
 static_assert(METRICS_KEY_MAX < (1U << sizeof(metric_key_t) * 8),
@@ -22,23 +24,28 @@ static_assert(METRICS_KEY_MAX < (1U << sizeof(metric_key_t) * 8),
 #define MAGIC_KEY			0xffU
 #define MAGIC_VALUE			((int32_t)(intptr_t)metrics)
 
-struct metrics {
-	metric_key_t key;
-	metric_value_t value;
-	bool is_set;
-} LIBMCU_PACKED;
+LIBMCU_NOINIT static struct metrics_entry storage[METRICS_KEY_MAX+1/*magic*/];
+static struct metrics_entry *metrics = storage;
 
-LIBMCU_NOINIT static struct metrics metrics[METRICS_KEY_MAX+1/*magic*/];
+static bool (* const samplers[])(metric_value_t *value) = {
+#define METRICS_DEFINE_GAUGE(key, sampler)	sampler,
+#define METRICS_DEFINE(key)		METRICS_DEFINE_GAUGE(key, NULL)
+#include METRICS_USER_DEFINES
+#undef METRICS_DEFINE
+#undef METRICS_DEFINE_GAUGE
+};
 
 #if !defined(METRICS_NO_KEY_STRING)
 static char const *key_strings[] = {
-#define METRICS_DEFINE(keystr) #keystr,
+#define METRICS_DEFINE_GAUGE(keystr, sampler)	#keystr,
+#define METRICS_DEFINE(keystr)		METRICS_DEFINE_GAUGE(keystr, )
 #include METRICS_USER_DEFINES
 #undef METRICS_DEFINE
+#undef METRICS_DEFINE_GAUGE
 };
 #endif
 
-static struct metrics *get_item_by_index(const metric_key_t index)
+static struct metrics_entry *get_item_by_index(const metric_key_t index)
 {
 	return &metrics[index];
 }
@@ -55,12 +62,12 @@ static metric_key_t get_index_by_key(const metric_key_t key)
 	return 0;
 }
 
-static struct metrics *get_obj_from_key(const metric_key_t key)
+static struct metrics_entry *get_obj_from_key(const metric_key_t key)
 {
 	return get_item_by_index(get_index_by_key(key));
 }
 
-static bool is_metric_set(const struct metrics *p)
+static bool is_metric_set(const struct metrics_entry *p)
 {
 	return p->is_set;
 }
@@ -79,7 +86,7 @@ static metric_value_t get_metric_value(const metric_key_t key)
 static void set_metric_value_if_min(const metric_key_t key,
 		const metric_value_t value)
 {
-	const struct metrics *p = get_obj_from_key(key);
+	const struct metrics_entry *p = get_obj_from_key(key);
 
 	if (is_metric_set(p)) {
 		if (value < p->value) {
@@ -93,7 +100,7 @@ static void set_metric_value_if_min(const metric_key_t key,
 static void set_metric_value_if_max(const metric_key_t key,
 		const metric_value_t value)
 {
-	const struct metrics *p = get_obj_from_key(key);
+	const struct metrics_entry *p = get_obj_from_key(key);
 
 	if (is_metric_set(p)) {
 		if (value > p->value) {
@@ -109,7 +116,7 @@ static void iterate_all(void (*callback_each)(const metric_key_t key,
 		void *ctx)
 {
 	for (metric_key_t i = 0; i < METRICS_KEY_MAX; i++) {
-		struct metrics const *p = get_item_by_index(i);
+		struct metrics_entry const *p = get_item_by_index(i);
 		if (is_metric_set(p)) {
 			callback_each(p->key, p->value, ctx);
 		}
@@ -130,7 +137,7 @@ static uint32_t count_metrics_updated(void)
 	uint32_t nr_updated = 0;
 
 	for (metric_key_t i = 0; i < METRICS_KEY_MAX; i++) {
-		struct metrics const *p = get_item_by_index(i);
+		struct metrics_entry const *p = get_item_by_index(i);
 		if (is_metric_set(p)) {
 			nr_updated++;
 		}
@@ -139,13 +146,37 @@ static uint32_t count_metrics_updated(void)
 	return nr_updated;
 }
 
+/* The value is kept until the next cycle, so reading a gauge in between does
+ * not call the sampler. Samplers are called without the lock held as they may
+ * take a while or read other metrics. */
+static void sample_gauges(void)
+{
+	for (metric_key_t i = 0; i < METRICS_KEY_MAX; i++) {
+		metric_value_t value;
+
+		if (samplers[i] == NULL) {
+			continue;
+		}
+
+		const bool available = (*samplers[i])(&value);
+
+		metrics_lock();
+		if (available) {
+			set_metric_value(i, value);
+		} else {
+			get_obj_from_key(i)->is_set = false;
+		}
+		metrics_unlock();
+	}
+}
+
 static size_t encode_all(uint8_t *buf, const size_t bufsize)
 {
 	size_t written = metrics_encode_header(buf, bufsize,
 			METRICS_KEY_MAX, count_metrics_updated());
 
 	for (metric_key_t i = 0; i < METRICS_KEY_MAX; i++) {
-		struct metrics const *p = get_item_by_index(i);
+		struct metrics_entry const *p = get_item_by_index(i);
 		if (is_metric_set(p)) {
 			written += metrics_encode_each(&buf[written],
 					bufsize - written, p->key, p->value);
@@ -234,6 +265,8 @@ size_t metrics_collect(void *buf, const size_t bufsize)
 {
 	size_t written;
 
+	sample_gauges();
+
 	metrics_lock();
 	written = encode_all((uint8_t *)buf, bufsize);
 	metrics_unlock();
@@ -245,6 +278,7 @@ void metrics_iterate(void (*callback_each)(const metric_key_t key,
 				const metric_value_t value, void *ctx),
 		void *ctx)
 {
+	sample_gauges();
 	iterate_all(callback_each, ctx);
 }
 
@@ -262,7 +296,12 @@ const char *metrics_stringify_key(const metric_key_t key)
 
 void metrics_init(const bool force)
 {
-	struct metrics *p = get_item_by_index(METRICS_KEY_MAGIC);
+	struct metrics_entry *mem = (struct metrics_entry *)
+		metrics_storage_get(sizeof(storage));
+
+	metrics = mem? mem : storage;
+
+	struct metrics_entry *p = get_item_by_index(METRICS_KEY_MAGIC);
 
 	if (force || p->key != MAGIC_KEY || p->value != MAGIC_VALUE) {
 		initialize_metrics();
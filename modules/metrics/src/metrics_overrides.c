@@ -43,3 +43,9 @@ LIBMCU_WEAK size_t metrics_encode_each(void *buf, size_t bufsize,
 
 	return len;
 }
+
+LIBMCU_WEAK void *metrics_storage_get(size_t size)
+{
+	unused(size);
+	return NULL;
+}
@@ -16,6 +16,9 @@ extern "C" {
 #if !defined(PM_CALLBACK_MAXLEN)
 #define PM_CALLBACK_MAXLEN		8U
 #endif
+#if !defined(PM_HISTOGRAM_BUCKETS)
+#define PM_HISTOGRAM_BUCKETS		16U
+#endif
 
 #define pm_init				libmcu_pm_init
 
@@ -30,6 +33,21 @@ typedef enum pm_mode {
 
 typedef void (*pm_callback_t)(void *ctx);
 
+/**
+ * Bucket i of a histogram counts values in [2^(i-1), 2^i), bucket 0 counts
+ * zeros and the last bucket takes all the values beyond.
+ */
+struct pm_stats {
+	uint32_t entries;
+	/** total time spent in the mode */
+	uint64_t residency_ms;
+	/** average entry plus exit latency including the hardware latency
+	 * given by @ref pm_set_latency */
+	uint32_t latency_us;
+	uint32_t residency_hist_ms[PM_HISTOGRAM_BUCKETS];
+	uint32_t latency_hist_us[PM_HISTOGRAM_BUCKETS];
+};
+
 int pm_enter(pm_mode_t mode, uint32_t duration_ms);
 int pm_register_entry_callback(pm_mode_t mode, int8_t priority,
 		pm_callback_t func, void *arg);
@@ -41,6 +59,47 @@ int pm_unregister_exit_callback(pm_mode_t mode, int8_t priority,
 		pm_callback_t func);
 void pm_init(void);
 
+/**
+ * @brief Set the hardware transition latency of a mode.
+ *
+ * The time taken by the entry and exit callbacks is measured on every
+ * transition. The latency of the hardware itself, e.g. oscillator startup
+ * time, is not visible to software and should be given here.
+ *
+ * @param[in] mode The power mode.
+ * @param[in] latency_us Entry plus exit latency of the hardware.
+ *
+ * @return 0 on success, -EINVAL on invalid mode.
+ */
+int pm_set_latency(pm_mode_t mode, uint32_t latency_us);
+
+/**
+ * @brief Pick the deepest sleep mode worth entering for the idle time.
+ *
+ * It is the deepest one of @ref PM_SLEEP and @ref PM_SLEEP_DEEP whose
+ * transition latency fits in @p idle_ms. @ref PM_SLEEP is picked when none
+ * fits.
+ *
+ * @param[in] idle_ms Expected idle time.
+ *
+ * @return The power mode picked.
+ */
+pm_mode_t pm_select(uint32_t idle_ms);
+
+/**
+ * @brief Enter the sleep mode picked for the next deadline.
+ *
+ * The expected idle time is the time left until the earliest deadline
+ * reported by the sources registered with @ref deadline_register.
+ *
+ * @return The return value of @ref pm_port_enter, or -EAGAIN if a deadline is
+ *         already due.
+ */
+int pm_idle(void);
+
+int pm_get_stats(pm_mode_t mode, struct pm_stats *stats);
+void pm_reset_stats(void);
+
 #if defined(__cplusplus)
 }
 #endif
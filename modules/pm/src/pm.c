@@ -12,6 +12,12 @@
 #include <errno.h>
 #include <pthread.h>
 
+#include "libmcu/board.h"
+#include "libmcu/deadline.h"
+
+#define PM_MODE_MAX			(PM_SHUTDOWN + 1)
+#define LATENCY_EWMA_SHIFT		3
+
 struct pm_item {
 	pm_callback_t func;
 	void *ctx;
@@ -20,8 +26,18 @@ struct pm_item {
 	bool on_exit;
 };
 
+struct pm_mode_stats {
+	struct pm_stats stats;
+	uint32_t hw_latency_us;
+	uint32_t sw_latency_us;
+};
+
 static struct pm_item slots[PM_CALLBACK_MAXLEN];
 static pthread_mutex_t slot_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct pm_mode_stats modes[PM_MODE_MAX];
+
+/* in the order of depth, the deepest first */
+static const pm_mode_t idle_modes[] = { PM_SLEEP_DEEP, PM_SLEEP, };
 
 static int count_empty_slots(void)
 {
@@ -191,22 +207,143 @@ int pm_unregister_exit_callback(pm_mode_t mode, int8_t priority,
 	return unregister_callback(mode, priority, func, true);
 }
 
+static bool is_valid_mode(pm_mode_t mode)
+{
+	return (unsigned int)mode < PM_MODE_MAX;
+}
+
+static unsigned int get_bucket(uint64_t value)
+{
+	unsigned int i = 0;
+
+	while (value && i < PM_HISTOGRAM_BUCKETS - 1) {
+		value >>= 1;
+		i++;
+	}
+
+	return i;
+}
+
+static uint32_t get_latency(const struct pm_mode_stats *p)
+{
+	return p->hw_latency_us + p->sw_latency_us;
+}
+
+static void update_stats(pm_mode_t mode, uint64_t latency_us,
+		uint64_t residency_us)
+{
+	struct pm_mode_stats *p = &modes[mode];
+	const uint32_t sample = latency_us > UINT32_MAX?
+		UINT32_MAX : (uint32_t)latency_us;
+	const uint64_t residency_ms = residency_us / 1000;
+
+	if (p->stats.entries++ == 0) {
+		p->sw_latency_us = sample;
+	} else {
+		p->sw_latency_us = (uint32_t)((int64_t)p->sw_latency_us +
+			(((int64_t)sample - p->sw_latency_us)
+				/ (1 << LATENCY_EWMA_SHIFT)));
+	}
+
+	p->stats.residency_ms += residency_ms;
+	p->stats.latency_us = get_latency(p);
+	p->stats.residency_hist_ms[get_bucket(residency_ms)]++;
+	p->stats.latency_hist_us[get_bucket(sample + p->hw_latency_us)]++;
+}
+
 int pm_enter(pm_mode_t mode, uint32_t duration_ms)
 {
 	pthread_mutex_lock(&slot_lock);
+	const uint64_t t0 = board_get_time_since_boot_us();
 	dispatch_entries(mode);
 
+	const uint64_t t1 = board_get_time_since_boot_us();
 	int rc = pm_port_enter(mode, duration_ms);
+	const uint64_t t2 = board_get_time_since_boot_us();
 
 	dispatch_exits(mode);
+	const uint64_t t3 = board_get_time_since_boot_us();
+
+	if (is_valid_mode(mode)) {
+		update_stats(mode, (t1 - t0) + (t3 - t2), t2 - t1);
+	}
 	pthread_mutex_unlock(&slot_lock);
 
 	return rc;
 }
 
+pm_mode_t pm_select(uint32_t idle_ms)
+{
+	const uint64_t idle_us = (uint64_t)idle_ms * 1000;
+	pm_mode_t mode = PM_SLEEP;
+
+	pthread_mutex_lock(&slot_lock);
+	for (unsigned int i = 0; i < sizeof(idle_modes) / sizeof(*idle_modes);
+			i++) {
+		if (get_latency(&modes[idle_modes[i]]) <= idle_us) {
+			mode = idle_modes[i];
+			break;
+		}
+	}
+	pthread_mutex_unlock(&slot_lock);
+
+	return mode;
+}
+
+int pm_idle(void)
+{
+	const uint32_t idle_ms = deadline_next_ms();
+
+	if (idle_ms == 0) {
+		return -EAGAIN;
+	}
+
+	return pm_enter(pm_select(idle_ms), idle_ms);
+}
+
+int pm_set_latency(pm_mode_t mode, uint32_t latency_us)
+{
+	if (!is_valid_mode(mode)) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&slot_lock);
+	modes[mode].hw_latency_us = latency_us;
+	modes[mode].stats.latency_us = get_latency(&modes[mode]);
+	pthread_mutex_unlock(&slot_lock);
+
+	return 0;
+}
+
+int pm_get_stats(pm_mode_t mode, struct pm_stats *stats)
+{
+	if (!is_valid_mode(mode) || !stats) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&slot_lock);
+	*stats = modes[mode].stats;
+	pthread_mutex_unlock(&slot_lock);
+
+	return 0;
+}
+
+void pm_reset_stats(void)
+{
+	pthread_mutex_lock(&slot_lock);
+	for (unsigned int i = 0; i < PM_MODE_MAX; i++) {
+		struct pm_mode_stats *p = &modes[i];
+		memset(&p->stats, 0, sizeof(p->stats));
+		p->sw_latency_us = 0;
+		p->stats.latency_us = get_latency(p);
+	}
+	pthread_mutex_unlock(&slot_lock);
+}
+
 void pm_init(void)
 {
 	pthread_mutex_lock(&slot_lock);
 	memset(slots, 0, sizeof(slots));
+	memset(modes, 0, sizeof(modes));
 	pthread_mutex_init(&slot_lock, NULL);
 }
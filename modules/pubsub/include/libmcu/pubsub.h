@@ -60,6 +60,16 @@ typedef void (*pubsub_callback_t)(void *context, const void *msg, size_t msglen)
  */
 pubsub_error_t pubsub_publish(const char *topic, const void *msg, size_t msglen);
 
+/**
+ * @brief Get the topic being published
+ *
+ * It tells which topic a message was published to in the callback of a
+ * subscription with wildcards.
+ *
+ * @return the topic, or NULL when called out of the callbacks
+ */
+const char *pubsub_topic(void);
+
 /**
  * @note `topic_filter` should be kept in valid memory space even after
  * registered. Because it keeps dereferencing the pointer of `topic_filter`
@@ -13,6 +13,7 @@
 
 #include "libmcu/compiler.h"
 #include "libmcu/assert.h"
+#include "libmcu/lockstat_pthread.h"
 
 #if !defined(PUBSUB_MIN_SUBSCRIPTION_CAPACITY)
 #define PUBSUB_MIN_SUBSCRIPTION_CAPACITY		4
@@ -43,7 +44,11 @@ static struct {
 		uint8_t capacity;
 		uint8_t length;
 	} subscription;
+
+	/* valid only while publishing under the lock */
+	const char *topic;
 } m;
+LOCKSTAT_DEFINE(pubsub_lockstat);
 
 static void get_next_topic_word(const char **s)
 {
@@ -223,12 +228,12 @@ static void publish_internal(const char *topic, const void *msg, size_t msglen)
 
 static void subscriptions_lock(void)
 {
-	pthread_mutex_lock(&m.subscription.lock);
+	LOCKSTAT_MUTEX_LOCK(pubsub_lockstat, &m.subscription.lock);
 }
 
 static void subscriptions_unlock(void)
 {
-	pthread_mutex_unlock(&m.subscription.lock);
+	LOCKSTAT_MUTEX_UNLOCK(pubsub_lockstat, &m.subscription.lock);
 }
 
 static struct subscription *subscribe_core(struct subscription *sub,
@@ -279,13 +284,20 @@ pubsub_error_t pubsub_publish(const char *topic, const void *msg, size_t msglen)
 
 	subscriptions_lock();
 	{
+		m.topic = topic;
 		publish_internal(topic, msg, msglen);
+		m.topic = NULL;
 	}
 	subscriptions_unlock();
 
 	return PUBSUB_SUCCESS;
 }
 
+const char *pubsub_topic(void)
+{
+	return m.topic;
+}
+
 pubsub_subscribe_t pubsub_subscribe_static(pubsub_subscribe_t handle,
 		const char *topic_filter, pubsub_callback_t cb, void *context)
 {
@@ -52,6 +52,10 @@ typedef void (*pubsub_callback_t)(void *context, const void *msg, size_t msglen)
  * subscriptions. You may want some kind of task to make it run in another
  * context, using such a jobqueue.
  *
+ * Static subscribers registered with PUBSUB_STATIC_SUBSCRIBE in
+ * libmcu/pubsub_static.h get the message first, then the ones subscribed at
+ * runtime.
+ *
  * @param topic is where the message gets publshed to
  * @param msg A message to publish
  * @param msglen The length of the message
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_PUBSUB_STATIC_H
+#define LIBMCU_PUBSUB_STATIC_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "libmcu/pubsub.h"
+#include "libmcu/compiler.h"
+
+/*
+ * Build-time subscriptions of pubsub_tiny. Kept out of libmcu/pubsub.h as the
+ * pubsub module exports a header of the same name.
+ */
+
+struct pubsub_static_subscription {
+	const char *topic;
+	pubsub_callback_t callback;
+	void *context;
+};
+
+#if defined(__APPLE__) && defined(__MACH__)
+#define PUBSUB_STATIC_SECTION		"__DATA,pubsub_static"
+#else
+#define PUBSUB_STATIC_SECTION		"pubsub_static"
+#endif
+
+#define PUBSUB_STATIC_NAME(n)		pubsub_static_subscription_ ## n
+#define PUBSUB_STATIC_DEFINE(n, topic, cb, ctx)				\
+	LIBMCU_USED __attribute__((section(PUBSUB_STATIC_SECTION),	\
+			aligned(sizeof(void *))))			\
+	static const struct pubsub_static_subscription			\
+	PUBSUB_STATIC_NAME(n) = { topic, cb, ctx }
+
+/** Subscribe to a topic at build time
+ *
+ * The subscription record is placed in a dedicated linker section, taking no
+ * heap and no registration at boot. All the records are collected in a
+ * contiguous array by the linker. The topic does not need to be created with
+ * @ref pubsub_create for static subscribers to receive messages.
+ *
+ * The subscription cannot be unsubscribed.
+ *
+ * @note `topic` should be a constant address, e.g. a string literal or a
+ *       `const char []` object, matching the pointer given to
+ *       @ref pubsub_publish. Topics are compared by pointer, not by string.
+ *
+ *	extern const char topic_temperature[];
+ *	PUBSUB_STATIC_SUBSCRIBE(topic_temperature, on_temperature, NULL);
+ */
+#define PUBSUB_STATIC_SUBSCRIBE(topic, cb, ctx)				\
+	PUBSUB_STATIC_DEFINE(__COUNTER__, topic, cb, ctx)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_PUBSUB_STATIC_H */
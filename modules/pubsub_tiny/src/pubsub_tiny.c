@@ -5,6 +5,7 @@
  */
 
 #include "libmcu/pubsub.h"
+#include "libmcu/pubsub_static.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -47,6 +48,22 @@ static struct {
 	pthread_mutex_t pubsub_list_lock;
 } m;
 
+/* The section boundaries are provided by the linker. They are weak to resolve
+ * to NULL when no static subscription is there. */
+#if defined(__APPLE__) && defined(__MACH__)
+extern const struct pubsub_static_subscription static_subscriptions_start[]
+	__asm("section$start$__DATA$pubsub_static");
+extern const struct pubsub_static_subscription static_subscriptions_end[]
+	__asm("section$end$__DATA$pubsub_static");
+#else
+extern const struct pubsub_static_subscription __start_pubsub_static[]
+	LIBMCU_WEAK;
+extern const struct pubsub_static_subscription __stop_pubsub_static[]
+	LIBMCU_WEAK;
+#define static_subscriptions_start		__start_pubsub_static
+#define static_subscriptions_end		__stop_pubsub_static
+#endif
+
 static void add_topic(topic_t *topic)
 {
 	list_add(&topic->pubsub_node, &m.pubsub_list);
@@ -104,6 +121,36 @@ static topic_t *find_topic(const char *topic_name)
 	return topic;
 }
 
+static int count_static_subscribers(const char *topic_name)
+{
+	const struct pubsub_static_subscription *p;
+	int count = 0;
+
+	for (p = static_subscriptions_start; p < static_subscriptions_end; p++) {
+		if (p->topic == topic_name) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+static int publish_static(const char *topic_name,
+		const void *msg, size_t msglen)
+{
+	const struct pubsub_static_subscription *p;
+	int count = 0;
+
+	for (p = static_subscriptions_start; p < static_subscriptions_end; p++) {
+		if (p->topic == topic_name) {
+			p->callback(p->context, msg, msglen);
+			count++;
+		}
+	}
+
+	return count;
+}
+
 static void publish_internal(const topic_t *topic,
 		const void *msg, size_t msglen)
 {
@@ -229,6 +276,8 @@ pubsub_error_t pubsub_publish(const char *topic_name,
 		return PUBSUB_INVALID_PARAM;
 	}
 
+	const int nr_static = publish_static(topic_name, msg, msglen);
+
 	pubsub_lock();
 	{
 		if ((topic = find_topic(topic_name)) != NULL) {
@@ -237,11 +286,11 @@ pubsub_error_t pubsub_publish(const char *topic_name,
 	}
 	pubsub_unlock();
 
-	if (topic == NULL) {
+	if (topic == NULL && nr_static == 0) {
 		return PUBSUB_NO_EXIST_TOPIC;
 	}
 
-	PUBSUB_DEBUG("Publish to %s", topic->name);
+	PUBSUB_DEBUG("Publish to %s", topic_name);
 
 	return PUBSUB_SUCCESS;
 }
@@ -303,6 +352,8 @@ int pubsub_count(const char *topic_name)
 		return PUBSUB_INVALID_PARAM;
 	}
 
+	const int nr_static = count_static_subscribers(topic_name);
+
 	pubsub_lock();
 	{
 		if ((topic = find_topic(topic_name)) != NULL) {
@@ -311,11 +362,11 @@ int pubsub_count(const char *topic_name)
 	}
 	pubsub_unlock();
 
-	if (topic == NULL) {
+	if (topic == NULL && nr_static == 0) {
 		return PUBSUB_NO_EXIST_TOPIC;
 	}
 
-	return count;
+	return count + nr_static;
 }
 
 void pubsub_init(void)
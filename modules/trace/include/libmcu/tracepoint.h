@@ -0,0 +1,145 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_TRACEPOINT_H
+#define LIBMCU_TRACEPOINT_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Static tracepoints for application events.
+ *
+ * Events are declared with `TRACEPOINT_DEFINE(id, category)` in the
+ * definition file, the category being a bit position from 0 to 31 to turn a
+ * group of events on and off at runtime. `TRACEPOINT(id, a, b)` records a
+ * fixed-size binary record into a lock-free ring per CPU, overwriting the
+ * oldest, and costs a load and a branch when its category is disabled.
+ *
+ * Dump the records with @ref tracepoint_export and turn them into a timeline
+ * with tools/scripts/tracepoint_decode.py.
+ */
+
+#if !defined(TRACEPOINT_USER_DEFINES)
+#define TRACEPOINT_USER_DEFINES		"tracepoints.def"
+#endif
+#if !defined(TRACEPOINT_BUFFER_LEN) /* records per CPU, power of 2 */
+#define TRACEPOINT_BUFFER_LEN		256U
+#endif
+#if !defined(TRACEPOINT_MAX_CPUS)
+#define TRACEPOINT_MAX_CPUS		1U
+#endif
+#if !defined(TRACEPOINT_DEFAULT_CATEGORIES)
+#define TRACEPOINT_DEFAULT_CATEGORIES	0U
+#endif
+
+#define TRACEPOINT_CATEGORY(n)		(1UL << (n))
+
+enum {
+#define TRACEPOINT_DEFINE(id, category)	id,
+#include TRACEPOINT_USER_DEFINES
+#undef TRACEPOINT_DEFINE
+};
+
+enum {
+#define TRACEPOINT_DEFINE(id, category)	TRACEPOINT_CATEGORY_##id = category,
+#include TRACEPOINT_USER_DEFINES
+#undef TRACEPOINT_DEFINE
+};
+
+#define TRACEPOINT(id, a, b)	do {					\
+	if (tracepoint_categories &					\
+			TRACEPOINT_CATEGORY(TRACEPOINT_CATEGORY_##id)) {\
+		tracepoint_emit(id, (uint32_t)(a), (uint32_t)(b));	\
+	}								\
+} while (0)
+
+/* 20 bytes in the byte order of the target, no padding */
+struct tracepoint_record {
+	uint32_t timestamp;
+	/* lower 32 bits of @ref trace_get_current_thread */
+	uint32_t thread;
+	uint16_t id;
+	uint16_t cpu;
+	uint32_t a;
+	uint32_t b;
+};
+
+typedef void (*tracepoint_callback_t)(const struct tracepoint_record *rec,
+		void *ctx);
+typedef int (*tracepoint_writer_t)(const void *data, size_t datasize,
+		void *ctx);
+
+/* bitmask of the enabled categories. use the functions below to change */
+extern volatile uint32_t tracepoint_categories;
+
+/**
+ * @brief Record an event regardless of its category. Use @ref TRACEPOINT.
+ */
+void tracepoint_emit(uint16_t id, uint32_t a, uint32_t b);
+
+/**
+ * @brief Enable the categories in @p mask, leaving the others as they are.
+ */
+void tracepoint_enable(uint32_t mask);
+
+/**
+ * @brief Disable the categories in @p mask, leaving the others as they are.
+ */
+void tracepoint_disable(uint32_t mask);
+
+/**
+ * @brief Drop the records recorded so far.
+ */
+void tracepoint_clear(void);
+
+/**
+ * @brief Iterate over the records of each CPU, oldest first.
+ *
+ * Records being overwritten while iterating are skipped.
+ *
+ * @return The number of records iterated.
+ */
+size_t tracepoint_iterate(tracepoint_callback_t callback, void *ctx);
+
+/**
+ * @brief Write the records as they are in memory, one after another.
+ *
+ * @return 0 on success, or the negative value the writer returned.
+ */
+int tracepoint_export(tracepoint_writer_t writer, void *ctx);
+
+/**
+ * @brief Get the name of an event.
+ *
+ * @return The name, or NULL if @p id is unknown or TRACEPOINT_NO_NAME_STRING
+ *         is defined.
+ */
+const char *tracepoint_name(uint16_t id);
+
+/**
+ * @brief Timestamp of records.
+ *
+ * The default is the lower 32 bits of @ref board_get_time_since_boot_us.
+ * Override it for a finer resolution, e.g. a cycle counter.
+ */
+uint32_t tracepoint_get_time(void);
+
+/**
+ * @brief Index of the CPU the caller runs on, less than
+ *        @ref TRACEPOINT_MAX_CPUS. The default returns 0.
+ */
+unsigned int tracepoint_get_cpu(void);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_TRACEPOINT_H */
@@ -0,0 +1,205 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/tracepoint.h"
+#include "libmcu/trace.h"
+#include "libmcu/board.h"
+#include "libmcu/compiler.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#define GET_INDEX(i)			((i) & (TRACEPOINT_BUFFER_LEN - 1))
+
+static_assert((TRACEPOINT_BUFFER_LEN & (TRACEPOINT_BUFFER_LEN - 1)) == 0,
+		"TRACEPOINT_BUFFER_LEN must be a power of 2");
+static_assert(sizeof(struct tracepoint_record) == 20, "");
+
+enum {
+#define TRACEPOINT_DEFINE(id, category)	TRACEPOINT_ID_##id,
+#include TRACEPOINT_USER_DEFINES
+#undef TRACEPOINT_DEFINE
+	TRACEPOINT_ID_MAX,
+};
+static_assert(TRACEPOINT_ID_MAX <= UINT16_MAX, "");
+
+#if !defined(TRACEPOINT_NO_NAME_STRING)
+static char const *names[] = {
+#define TRACEPOINT_DEFINE(id, category)	#id,
+#include TRACEPOINT_USER_DEFINES
+#undef TRACEPOINT_DEFINE
+};
+#endif
+
+/* a record is valid only while its seq is the sequence number it was
+ * written at plus 1. 0 while being written */
+struct slot {
+	atomic_uint_least32_t seq;
+	struct tracepoint_record rec;
+};
+
+struct ring {
+	struct slot slots[TRACEPOINT_BUFFER_LEN];
+	atomic_uint_least32_t head;
+	/* the records before it are cleared */
+	atomic_uint_least32_t tail;
+};
+
+static struct ring rings[TRACEPOINT_MAX_CPUS];
+
+volatile uint32_t tracepoint_categories = TRACEPOINT_DEFAULT_CATEGORIES;
+
+LIBMCU_NO_INSTRUMENT
+void tracepoint_emit(uint16_t id, uint32_t a, uint32_t b)
+{
+	const unsigned int cpu = tracepoint_get_cpu();
+	struct ring *ring = &rings[cpu];
+	const uint32_t seq = atomic_fetch_add_explicit(&ring->head, 1,
+			memory_order_relaxed);
+	struct slot *slot = &ring->slots[GET_INDEX(seq)];
+	const void *thread = trace_get_current_thread();
+
+	atomic_store_explicit(&slot->seq, 0, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	slot->rec = (struct tracepoint_record) {
+		.timestamp = tracepoint_get_time(),
+		.thread = (uint32_t)(uintptr_t)thread,
+		.id = id,
+		.cpu = (uint16_t)cpu,
+		.a = a,
+		.b = b,
+	};
+
+	atomic_store_explicit(&slot->seq, seq + 1, memory_order_release);
+}
+
+LIBMCU_NO_INSTRUMENT
+static bool read_slot(struct slot *slot, uint32_t seq,
+		struct tracepoint_record *rec)
+{
+	if (atomic_load_explicit(&slot->seq, memory_order_acquire) != seq + 1) {
+		return false;
+	}
+
+	*rec = slot->rec;
+	atomic_thread_fence(memory_order_acquire);
+
+	return atomic_load_explicit(&slot->seq, memory_order_relaxed)
+		== seq + 1;
+}
+
+LIBMCU_NO_INSTRUMENT
+size_t tracepoint_iterate(tracepoint_callback_t callback, void *ctx)
+{
+	size_t count = 0;
+
+	for (unsigned int i = 0; i < TRACEPOINT_MAX_CPUS; i++) {
+		struct ring *ring = &rings[i];
+		const uint32_t head = atomic_load(&ring->head);
+		uint32_t seq = atomic_load(&ring->tail);
+
+		if (head - seq > TRACEPOINT_BUFFER_LEN) {
+			seq = head - TRACEPOINT_BUFFER_LEN;
+		}
+
+		for (; seq != head; seq++) {
+			struct tracepoint_record rec;
+
+			if (!read_slot(&ring->slots[GET_INDEX(seq)], seq, &rec)) {
+				continue;
+			}
+
+			if (callback) {
+				(*callback)(&rec, ctx);
+			}
+
+			count++;
+		}
+	}
+
+	return count;
+}
+
+struct export_ctx {
+	tracepoint_writer_t writer;
+	void *ctx;
+	int err;
+};
+
+LIBMCU_NO_INSTRUMENT
+static void write_record(const struct tracepoint_record *rec, void *ctx)
+{
+	struct export_ctx *p = (struct export_ctx *)ctx;
+	int err;
+
+	if (p->err < 0) {
+		return;
+	}
+
+	if ((err = (*p->writer)(rec, sizeof(*rec), p->ctx)) < 0) {
+		p->err = err;
+	}
+}
+
+LIBMCU_NO_INSTRUMENT
+int tracepoint_export(tracepoint_writer_t writer, void *ctx)
+{
+	struct export_ctx p = {
+		.writer = writer,
+		.ctx = ctx,
+	};
+
+	tracepoint_iterate(write_record, &p);
+
+	return p.err;
+}
+
+LIBMCU_NO_INSTRUMENT
+void tracepoint_clear(void)
+{
+	for (unsigned int i = 0; i < TRACEPOINT_MAX_CPUS; i++) {
+		atomic_store(&rings[i].tail, atomic_load(&rings[i].head));
+	}
+}
+
+LIBMCU_NO_INSTRUMENT
+void tracepoint_enable(uint32_t mask)
+{
+	__atomic_fetch_or(&tracepoint_categories, mask, __ATOMIC_RELAXED);
+}
+
+LIBMCU_NO_INSTRUMENT
+void tracepoint_disable(uint32_t mask)
+{
+	__atomic_fetch_and(&tracepoint_categories, ~mask, __ATOMIC_RELAXED);
+}
+
+LIBMCU_NO_INSTRUMENT
+const char *tracepoint_name(uint16_t id)
+{
+#if !defined(TRACEPOINT_NO_NAME_STRING)
+	if (id < TRACEPOINT_ID_MAX) {
+		return names[id];
+	}
+#else
+	unused(id);
+#endif
+	return NULL;
+}
+
+LIBMCU_WEAK
+LIBMCU_NO_INSTRUMENT
+uint32_t tracepoint_get_time(void)
+{
+	return (uint32_t)board_get_time_since_boot_us();
+}
+
+LIBMCU_WEAK
+LIBMCU_NO_INSTRUMENT
+unsigned int tracepoint_get_cpu(void)
+{
+	return 0;
+}
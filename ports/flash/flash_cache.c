@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/flash_cache.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(MIN)
+#define MIN(a, b)			((a) > (b)? (b) : (a))
+#endif
+
+struct flash {
+	struct flash_api api;
+	struct flash *flash;
+	size_t page_size;
+
+	uint8_t *cache;
+	uintptr_t cache_page;
+	bool cached;
+
+	/* pending writes at [pending, pending + pending_len) */
+	uint8_t *buf;
+	uintptr_t pending;
+	size_t pending_len;
+};
+
+static uintptr_t get_page(const struct flash *self, uintptr_t offset)
+{
+	return offset - offset % self->page_size;
+}
+
+static bool overlaps(uintptr_t a, size_t a_len, uintptr_t b, size_t b_len)
+{
+	return a < b + b_len && b < a + a_len;
+}
+
+static void invalidate_if_overlapped(struct flash *self,
+		uintptr_t offset, size_t len)
+{
+	if (self->cached &&
+			overlaps(self->cache_page, self->page_size, offset, len)) {
+		self->cached = false;
+	}
+}
+
+static int flush(struct flash *self)
+{
+	if (self->pending_len == 0) {
+		return 0;
+	}
+
+	const int err = flash_write(self->flash,
+			self->pending, self->buf, self->pending_len);
+
+	if (err < 0) {
+		return err;
+	}
+
+	invalidate_if_overlapped(self, self->pending, self->pending_len);
+	self->pending_len = 0;
+
+	return 0;
+}
+
+static int flush_if_overlapped(struct flash *self, uintptr_t offset, size_t len)
+{
+	if (overlaps(self->pending, self->pending_len, offset, len)) {
+		return flush(self);
+	}
+
+	return 0;
+}
+
+static int fill_cache(struct flash *self, uintptr_t page)
+{
+	const size_t size = flash_size(self->flash);
+	const size_t len = MIN(self->page_size, size - page);
+	const int err = flash_read(self->flash, page, self->cache, len);
+
+	if (err < 0) {
+		return err;
+	}
+
+	self->cache_page = page;
+	self->cached = true;
+
+	return 0;
+}
+
+static int do_read(struct flash *self, uintptr_t offset, void *buf, size_t len)
+{
+	uint8_t *p = (uint8_t *)buf;
+	int err;
+
+	if ((err = flush_if_overlapped(self, offset, len)) != 0) {
+		return err;
+	}
+
+	if (len >= self->page_size) {
+		return flash_read(self->flash, offset, buf, len);
+	}
+
+	for (size_t done = 0; done < len;) {
+		const uintptr_t pos = offset + done;
+		const uintptr_t page = get_page(self, pos);
+		const size_t n = MIN(len - done,
+				self->page_size - (pos - page));
+
+		if ((!self->cached || self->cache_page != page) &&
+				(err = fill_cache(self, page)) != 0) {
+			return err;
+		}
+
+		memcpy(&p[done], &self->cache[pos - page], n);
+		done += n;
+	}
+
+	return (int)len;
+}
+
+static int do_write(struct flash *self,
+		uintptr_t offset, const void *data, size_t len)
+{
+	const uint8_t *p = (const uint8_t *)data;
+	int err;
+
+	for (size_t done = 0; done < len;) {
+		const uintptr_t pos = offset + done;
+		const uintptr_t page = get_page(self, pos);
+		const size_t n = MIN(len - done,
+				self->page_size - (pos - page));
+
+		if (self->pending_len &&
+				(get_page(self, self->pending) != page ||
+				 self->pending + self->pending_len != pos) &&
+				(err = flush(self)) != 0) {
+			return err;
+		}
+
+		if (self->pending_len == 0) {
+			self->pending = pos;
+		}
+
+		memcpy(&self->buf[self->pending_len], &p[done], n);
+		self->pending_len += n;
+		done += n;
+	}
+
+	return 0;
+}
+
+static int do_erase(struct flash *self, uintptr_t offset, size_t size)
+{
+	int err;
+
+	if ((err = flush(self)) != 0) {
+		return err;
+	}
+
+	invalidate_if_overlapped(self, offset, size);
+
+	return flash_erase(self->flash, offset, size);
+}
+
+static size_t do_size(struct flash *self)
+{
+	return flash_size(self->flash);
+}
+
+int flash_cache_sync(struct flash *cache)
+{
+	return flush(cache);
+}
+
+struct flash *flash_cache_create(struct flash *flash, size_t page_size)
+{
+	if (flash == NULL || page_size == 0) {
+		return NULL;
+	}
+
+	struct flash *self = (struct flash *)calloc(1,
+			sizeof(*self) + page_size * 2);
+
+	if (self == NULL) {
+		return NULL;
+	}
+
+	self->api = (struct flash_api) {
+		.erase = do_erase,
+		.write = do_write,
+		.read = do_read,
+		.size = do_size,
+	};
+
+	self->flash = flash;
+	self->page_size = page_size;
+	self->cache = (uint8_t *)&self[1];
+	self->buf = &self->cache[page_size];
+
+	return self;
+}
+
+void flash_cache_delete(struct flash *cache)
+{
+	if (cache) {
+		flush(cache);
+		free(cache);
+	}
+}
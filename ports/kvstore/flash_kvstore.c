@@ -18,6 +18,18 @@
 #define FLASH_LINE_ALIGN_BYTES		16
 #endif
 
+/* Values up to INLINE_MAX_BYTES are kept in the meta entry itself, in place
+ * of the offset and the padding, saving a program operation and the data
+ * space. The MSB of len marks them, which is never set by the entries of the
+ * older versions. */
+#define INLINE_FLAG			0x80000000U
+/* With FLASH_KVSTORE_KEY_NAMES, a key gets a name entry on its first write,
+ * pointing to the key string in the data area, to be enumerated. It is kept
+ * apart from the values so that updates cost nothing more. */
+#define NAME_FLAG			0x40000000U
+#define INLINE_MAX_BYTES		\
+	(sizeof(uint32_t) + FLASH_LINE_ALIGN_BYTES - 16)
+
 #if !defined(MIN)
 #define MIN(a, b)			((a) > (b)? (b) : (a))
 #endif
@@ -71,6 +83,43 @@ static bool is_free_entry(struct meta_entry *entry)
 	return false;
 }
 
+static bool is_inline(const struct meta_entry *entry)
+{
+	return (entry->len & INLINE_FLAG) != 0;
+}
+
+static bool is_name(const struct meta_entry *entry)
+{
+	return (entry->len & NAME_FLAG) != 0;
+}
+
+static uint32_t get_len(const struct meta_entry *entry)
+{
+	return entry->len & ~(INLINE_FLAG | NAME_FLAG);
+}
+
+static void set_inline(struct meta_entry *entry, const void *value, size_t size)
+{
+	const size_t n = MIN(size, sizeof(entry->offset));
+
+	entry->offset = 0xffffffff; /* leave the unused bytes erased */
+	memcpy(&entry->offset, value, n);
+#if (FLASH_LINE_ALIGN_BYTES > 16)
+	memcpy(entry->_padding, (const uint8_t *)value + n, size - n);
+#endif
+	entry->len = (uint32_t)size | INLINE_FLAG;
+}
+
+static void get_inline(const struct meta_entry *entry, void *buf, size_t size)
+{
+	const size_t n = MIN(size, sizeof(entry->offset));
+
+	memcpy(buf, &entry->offset, n);
+#if (FLASH_LINE_ALIGN_BYTES > 16)
+	memcpy((uint8_t *)buf + n, entry->_padding, size - n);
+#endif
+}
+
 static int find_key(struct storage *storage, const char *key, struct meta *meta)
 {
 	uint32_t hash_murmur = hash_murmur_32(key);
@@ -91,7 +140,8 @@ static int find_key(struct storage *storage, const char *key, struct meta *meta)
 
 		/* the last one is the latest one */
 		if (hash_murmur == t.entry.hash_murmur &&
-				hash_dbj2 == t.entry.hash_dbj2) {
+				hash_dbj2 == t.entry.hash_dbj2 &&
+				!is_name(&t.entry)) {
 			memcpy(&meta->entry, &t.entry, sizeof(t.entry));
 			meta->offset = offset;
 			keycnt++;
@@ -110,6 +160,7 @@ static int find_meta(struct storage *storage, struct meta *meta)
 	uintptr_t start = storage->offset + storage->meta.offset;
 	uintptr_t end = start + storage->meta.size;
 	uint32_t entry_size = sizeof(struct meta_entry);
+	const bool name = is_name(&meta->entry);
 	int keycnt = 0;
 
 	for (uintptr_t offset = start; offset < end; offset += entry_size) {
@@ -120,9 +171,10 @@ static int find_meta(struct storage *storage, struct meta *meta)
 			return -EIO;
 		}
 
-		/* the last one is the latest one */
+		/* the last one is the latest one, of the same kind */
 		if (meta->entry.hash_murmur == t.entry.hash_murmur &&
-				meta->entry.hash_dbj2 == t.entry.hash_dbj2) {
+				meta->entry.hash_dbj2 == t.entry.hash_dbj2 &&
+				is_name(&t.entry) == name) {
 			memcpy(&meta->entry, &t.entry, sizeof(t.entry));
 			meta->offset = offset;
 			keycnt++;
@@ -136,7 +188,9 @@ static int find_meta(struct storage *storage, struct meta *meta)
 	return -ENOENT;
 }
 
-static int alloc_entry(struct storage *storage, size_t size, struct meta *meta)
+/* @p named is set if a name entry of @p key is found along the way. */
+static int alloc_entry(struct storage *storage, size_t size, struct meta *meta,
+		const struct meta_entry *key, bool *named)
 {
 	uintptr_t start = storage->offset + storage->meta.offset;
 	uintptr_t end = start + storage->meta.size;
@@ -144,6 +198,10 @@ static int alloc_entry(struct storage *storage, size_t size, struct meta *meta)
 	uint32_t new_data_offset = 0;
 	bool allocated = false;
 
+	if (key) {
+		*named = false;
+	}
+
 	for (uintptr_t offset = start; offset < end; offset += entry_size) {
 		if (flash_read(storage->flash,
 				offset, &meta->entry, entry_size) < 0) {
@@ -155,12 +213,18 @@ static int alloc_entry(struct storage *storage, size_t size, struct meta *meta)
 				meta->offset = offset;
 				allocated = true;
 			}
-		} else {
-			uint32_t t = ALIGN(meta->entry.offset + meta->entry.len,
+		} else if (!is_inline(&meta->entry)) {
+			uint32_t t = ALIGN(meta->entry.offset +
+					get_len(&meta->entry),
 					FLASH_LINE_ALIGN_BYTES);
 			if (t > new_data_offset && t < storage->data.size) {
 				new_data_offset = t;
 			}
+			if (key && is_name(&meta->entry) &&
+				meta->entry.hash_murmur == key->hash_murmur &&
+				meta->entry.hash_dbj2 == key->hash_dbj2) {
+				*named = true;
+			}
 		}
 	}
 
@@ -194,14 +258,27 @@ static int write_meta(struct storage *storage, const struct meta *meta)
 static int write_value(struct storage *storage,
 		const void *data, const struct meta *meta)
 {
-	if (!data || meta->entry.len == 0) {
+	if (!data || meta->entry.len == 0 || is_inline(&meta->entry)) {
 		return 0;
 	}
 
 	uintptr_t offset = storage->offset +
 		storage->meta.offset + storage->meta.size +
 		meta->entry.offset;
-	return flash_write(storage->flash, offset, data, meta->entry.len);
+	return flash_write(storage->flash, offset, data, get_len(&meta->entry));
+}
+
+static bool has_value(struct storage *storage, const struct meta_entry *name)
+{
+	struct meta value = {
+		.entry = {
+			.hash_murmur = name->hash_murmur,
+			.hash_dbj2 = name->hash_dbj2,
+			.len = 0,
+		},
+	};
+
+	return find_meta(storage, &value) == 0 && value.entry.len > 0;
 }
 
 static int move_partition(struct storage *from, struct storage *to)
@@ -225,23 +302,38 @@ static int move_partition(struct storage *from, struct storage *to)
 		if (is_free_entry(&meta.entry) ||
 				find_meta(from, &meta) != 0 ||
 				meta.entry.len == 0 ||
-				meta.entry.offset > from->data.size ||
+				(!is_inline(&meta.entry) &&
+					meta.entry.offset > from->data.size) ||
+				(is_name(&meta.entry) &&
+					!has_value(from, &meta.entry)) ||
 				find_meta(to, &meta) == 0) {
 			continue;
 		}
 
-		if (alloc_entry(to, meta.entry.len, &new_meta) < 0) {
+		if (alloc_entry(to, is_inline(&meta.entry)?
+				0 : get_len(&meta.entry), &new_meta,
+				NULL, NULL) < 0) {
 			return -EIO;
 		}
 
-		new_meta.entry.hash_murmur = meta.entry.hash_murmur;
-		new_meta.entry.hash_dbj2 = meta.entry.hash_dbj2;
+		if (is_inline(&meta.entry)) {
+			new_meta.entry = meta.entry;
+		} else {
+			new_meta.entry.hash_murmur = meta.entry.hash_murmur;
+			new_meta.entry.hash_dbj2 = meta.entry.hash_dbj2;
+			new_meta.entry.len = meta.entry.len;
+		}
 
 		if (write_meta(to, &new_meta) < 0) {
 			return -EIO;
 		}
 
-		for (uint32_t i = 0; i < new_meta.entry.len; i += sizeof(buf)) {
+		if (is_inline(&new_meta.entry)) {
+			continue;
+		}
+
+		for (uint32_t i = 0; i < get_len(&new_meta.entry);
+				i += sizeof(buf)) {
                         uintptr_t of = from->offset + from->meta.offset +
 				from->meta.size + meta.entry.offset + i;
                         uintptr_t ot = to->offset + to->meta.offset +
@@ -275,7 +367,8 @@ static int reclaim(struct kvstore *self)
 	}
 
 	/* No space left even after reclaiming. */
-	if (alloc_entry(&self->scratch, FLASH_LINE_ALIGN_BYTES, &meta) != 0) {
+	if (alloc_entry(&self->scratch, FLASH_LINE_ALIGN_BYTES, &meta,
+			NULL, NULL) != 0) {
 		rc = -ENOSPC;
 		goto out;
 	}
@@ -285,20 +378,63 @@ out:
 	return rc;
 }
 
+static int alloc(struct kvstore *self, size_t size, struct meta *meta,
+		const struct meta_entry *key, bool *named)
+{
+	int rc = alloc_entry(&self->storage, size, meta, key, named);
+
+	if (rc == -ENOSPC && (rc = reclaim(self)) == 0) {
+		rc = alloc_entry(&self->storage, size, meta, key, named);
+	}
+
+	return rc;
+}
+
+#if defined(FLASH_KVSTORE_KEY_NAMES)
+static int write_name(struct kvstore *self,
+		const char *key, const struct meta_entry *name)
+{
+	const size_t len = strlen(key);
+	struct meta meta;
+	int rc;
+
+	if (len > KVSTORE_MAX_KEY_LENGTH) { /* left out of the enumeration */
+		return 0;
+	}
+
+	if ((rc = alloc(self, len, &meta, NULL, NULL)) != 0) {
+		return rc;
+	}
+
+	meta.entry.hash_murmur = name->hash_murmur;
+	meta.entry.hash_dbj2 = name->hash_dbj2;
+	meta.entry.len |= NAME_FLAG;
+
+	if (write_meta(&self->storage, &meta) != 0 ||
+			write_value(&self->storage, key, &meta) != 0) {
+		return -EIO;
+	}
+
+	return 0;
+}
+#endif
+
 static int do_write(struct kvstore *self,
 		const char *key, const void *value, size_t size)
 {
+	const bool inlined = value && size > 0 && size <= INLINE_MAX_BYTES;
+	const size_t data_size = inlined? 0 : size;
+	const struct meta_entry name = {
+		.hash_murmur = hash_murmur_32(key),
+		.hash_dbj2 = hash_dbj2_32(key),
+		.len = NAME_FLAG,
+	};
 	struct meta new_meta;
+	bool named;
 	int rc;
 
-	if ((rc = alloc_entry(&self->storage, size, &new_meta)) != 0) {
-		if (rc == -ENOSPC && (rc = reclaim(self)) == 0) {
-			rc = alloc_entry(&self->storage, size, &new_meta);
-		}
-
-		if (rc != 0) {
-			return rc;
-		}
+	if ((rc = alloc(self, data_size, &new_meta, &name, &named)) != 0) {
+		return rc;
 	}
 
 #if defined(FLASH_OVERWRITE)
@@ -308,14 +444,25 @@ static int do_write(struct kvstore *self,
 	}
 #endif
 
-	new_meta.entry.hash_murmur = hash_murmur_32(key);
-	new_meta.entry.hash_dbj2 = hash_dbj2_32(key);
+	new_meta.entry.hash_murmur = name.hash_murmur;
+	new_meta.entry.hash_dbj2 = name.hash_dbj2;
+
+	if (inlined) {
+		set_inline(&new_meta.entry, value, size);
+	}
 
 	if (write_meta(&self->storage, &new_meta) != 0 ||
 			write_value(&self->storage, value, &new_meta) != 0) {
 		return -EIO;
 	}
 
+#if defined(FLASH_KVSTORE_KEY_NAMES)
+	/* written after the value so that a name always has one to survive
+	 * the reclaim */
+	if (!named && size > 0) {
+		return write_name(self, key, &name);
+	}
+#endif
 	return 0;
 }
 
@@ -334,13 +481,66 @@ static int flash_kvstore_read(struct kvstore *self,
 		return -ENOENT;
 	}
 
-	size_t len = MIN(size, meta.entry.len);
+	size_t len = MIN(size, get_len(&meta.entry));
+
+	if (is_inline(&meta.entry)) {
+		get_inline(&meta.entry, buf, len);
+		return (int)len;
+	}
+
 	uintptr_t offset = self->storage.offset +
 		self->storage.meta.offset + self->storage.meta.size +
 		meta.entry.offset;
 	return flash_read(self->storage.flash, offset, buf, len);
 }
 
+#if defined(FLASH_KVSTORE_KEY_NAMES)
+static int flash_kvstore_iterate(struct kvstore *self, const char *prefix,
+		kvstore_iterate_cb_t cb, void *ctx)
+{
+	struct storage *storage = &self->storage;
+	uintptr_t start = storage->offset + storage->meta.offset;
+	uintptr_t end = start + storage->meta.size;
+	uint32_t entry_size = sizeof(struct meta_entry);
+	const size_t prefix_len = prefix? strlen(prefix) : 0;
+
+	for (uintptr_t offset = start; offset < end; offset += entry_size) {
+		char key[KVSTORE_MAX_KEY_LENGTH + 1];
+		struct meta_entry entry;
+		struct meta value;
+
+		if (flash_read(storage->flash, offset, &entry, entry_size) < 0) {
+			return -EIO;
+		}
+
+		const uint32_t len = get_len(&entry);
+
+		if (is_free_entry(&entry) || !is_name(&entry) ||
+				len > KVSTORE_MAX_KEY_LENGTH || len < prefix_len) {
+			continue;
+		}
+
+		if (flash_read(storage->flash, storage->offset +
+				storage->meta.offset + storage->meta.size +
+				entry.offset, key, len) < 0) {
+			return -EIO;
+		}
+		key[len] = '\0';
+
+		if ((prefix_len && strncmp(key, prefix, prefix_len) != 0) ||
+				find_key(storage, key, &value) != 0) {
+			continue;
+		}
+
+		if (!(*cb)(key, get_len(&value.entry), ctx)) {
+			break;
+		}
+	}
+
+	return 0;
+}
+#endif
+
 static int flash_kvstore_erase(struct kvstore *self, const char *key)
 {
 	struct meta meta;
@@ -380,6 +580,9 @@ struct kvstore *flash_kvstore_new(struct flash *flash, struct flash *scratch)
 			.clear = flash_kvstore_erase,
 			.open = flash_kvstore_open,
 			.close = flash_kvstore_close,
+#if defined(FLASH_KVSTORE_KEY_NAMES)
+			.iterate = flash_kvstore_iterate,
+#endif
 		},
 	};
 
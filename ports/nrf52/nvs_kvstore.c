@@ -199,6 +199,7 @@ struct kvstore *nvs_kvstore_new(void)
 	nvs_kvstore->api.clear = nvs_kvstore_delete;
 	nvs_kvstore->api.open = nvs_kvstore_open;
 	nvs_kvstore->api.close = nvs_kvstore_close;
+	nvs_kvstore->api.iterate = NULL;
 
 	return nvs_kvstore;
 }
@@ -5,16 +5,17 @@
  */
 
 #include "libmcu/actor_overrides.h"
-#include <pthread.h>
+#include "libmcu/lockstat_pthread.h"
 
 static pthread_mutex_t fallback_lock = PTHREAD_MUTEX_INITIALIZER;
+LOCKSTAT_DEFINE(actor_lockstat);
 
 void actor_lock(void)
 {
-	pthread_mutex_lock(&fallback_lock);
+	LOCKSTAT_MUTEX_LOCK(actor_lockstat, &fallback_lock);
 }
 
 void actor_unlock(void)
 {
-	pthread_mutex_unlock(&fallback_lock);
+	LOCKSTAT_MUTEX_UNLOCK(actor_lockstat, &fallback_lock);
 }
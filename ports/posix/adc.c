@@ -0,0 +1,291 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* Synthetic ADC for host builds. Each channel generates a 12-bit triangle
+ * wave with a little noise so that the acquisition path can be exercised
+ * without hardware. */
+
+#include "libmcu/adc.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "libmcu/ringbuf.h"
+
+#if !defined(ADC_MAX)
+#define ADC_MAX				2
+#endif
+#if !defined(ADC_SYNTHETIC_PERIOD)
+#define ADC_SYNTHETIC_PERIOD		1000U
+#endif
+#if !defined(ADC_STREAM_TICK_NS)
+#define ADC_STREAM_TICK_NS		1000000L
+#endif
+
+#define RESOLUTION_MAX			4095U
+#define REFERENCE_MV			3300
+#define NR_CHANNELS			32U
+
+struct adc {
+	struct adc_api api;
+
+	uint32_t channels;
+	bool activated;
+
+	/* used by measure() only. The stream thread keeps its own not to
+	 * race with it */
+	uint64_t nr_samples;
+	uint32_t noise;
+	uint16_t measured[NR_CHANNELS];
+
+	struct adc_stream_param stream;
+	uint32_t stream_noise;
+	struct ringbuf *ringbuf;
+	pthread_t thread;
+	atomic_bool streaming;
+};
+
+static uint64_t get_time_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint16_t generate(uint32_t *noise, unsigned int ch, uint64_t n)
+{
+	const uint32_t period = ADC_SYNTHETIC_PERIOD * (ch + 1);
+	const uint32_t phase = (uint32_t)(n % period);
+	const uint32_t half = period / 2;
+	uint32_t value = phase < half? phase : period - phase;
+
+	value = value * RESOLUTION_MAX / (half? half : 1);
+
+	/* xorshift for +-2 LSB of noise */
+	*noise ^= *noise << 13;
+	*noise ^= *noise >> 17;
+	*noise ^= *noise << 5;
+	value += *noise % 5;
+	value = value > 2? value - 2 : 0;
+
+	return (uint16_t)(value > RESOLUTION_MAX? RESOLUTION_MAX : value);
+}
+
+static size_t make_frame(uint32_t channels, uint64_t nr_sample,
+		uint32_t *noise, uint16_t *frame)
+{
+	size_t n = 0;
+
+	for (unsigned int ch = 0; ch < NR_CHANNELS; ch++) {
+		if (channels & (1UL << ch)) {
+			frame[n++] = generate(noise, ch, nr_sample);
+		}
+	}
+
+	return n * sizeof(*frame);
+}
+
+static void *stream_thread(void *arg)
+{
+	struct adc *self = (struct adc *)arg;
+	const struct timespec tick = { .tv_nsec = ADC_STREAM_TICK_NS };
+	const uint64_t start = get_time_ns();
+	uint32_t noise = self->stream_noise;
+	uint64_t nr_frames = 0;
+
+	while (atomic_load(&self->streaming)) {
+		const uint64_t elapsed = get_time_ns() - start;
+		const uint64_t target = elapsed *
+			self->stream.sample_rate_hz / 1000000000ULL;
+
+		for (; nr_frames < target; nr_frames++) {
+			uint16_t frame[NR_CHANNELS];
+			const size_t len = make_frame(
+					(uint32_t)self->stream.channels,
+					nr_frames, &noise, frame);
+
+			/* drop the whole frame rather than a part of it */
+			if (ringbuf_capacity(self->ringbuf) -
+					ringbuf_length(self->ringbuf) < len) {
+				continue;
+			}
+
+			ringbuf_write(self->ringbuf, frame, len);
+		}
+
+		nanosleep(&tick, NULL);
+	}
+
+	return NULL;
+}
+
+static int stream_start(struct adc *self,
+		const struct adc_stream_param *param, struct ringbuf *ringbuf)
+{
+	if (!self || !self->activated) {
+		return -EPIPE;
+	} else if (!param || !ringbuf || !param->channels ||
+			!param->sample_rate_hz) {
+		return -EINVAL;
+	} else if (atomic_load(&self->streaming)) {
+		return -EALREADY;
+	}
+
+	self->stream = *param;
+	self->stream_noise = ~self->noise;
+	self->ringbuf = ringbuf;
+	atomic_store(&self->streaming, true);
+
+	if (pthread_create(&self->thread, NULL, stream_thread, self) != 0) {
+		atomic_store(&self->streaming, false);
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+
+static int stream_stop(struct adc *self)
+{
+	if (!self || !atomic_load(&self->streaming)) {
+		return -EALREADY;
+	}
+
+	atomic_store(&self->streaming, false);
+	pthread_join(self->thread, NULL);
+
+	return 0;
+}
+
+static int convert_to_millivolts(struct adc *self, int value)
+{
+	if (!self || !self->activated) {
+		return -EPIPE;
+	}
+
+	return value * REFERENCE_MV / (int)RESOLUTION_MAX;
+}
+
+static int read_adc(struct adc *self, adc_channel_t channel)
+{
+	if (!self || !self->activated) {
+		return -EPIPE;
+	} else if (!channel || !(self->channels & (uint32_t)channel)) {
+		return -EINVAL;
+	}
+
+	return self->measured[__builtin_ctz((unsigned int)channel)];
+}
+
+static int measure(struct adc *self)
+{
+	if (!self || !self->activated) {
+		return -EPIPE;
+	}
+
+	for (unsigned int ch = 0; ch < NR_CHANNELS; ch++) {
+		if (self->channels & (1UL << ch)) {
+			self->measured[ch] = generate(&self->noise, ch,
+					self->nr_samples);
+		}
+	}
+
+	self->nr_samples++;
+
+	return 0;
+}
+
+static int init_channel(struct adc *self, adc_channel_t channel)
+{
+	if (!self || !self->activated) {
+		return -EPIPE;
+	}
+
+	self->channels |= (uint32_t)channel;
+
+	return 0;
+}
+
+static int calibrate_adc(struct adc *self)
+{
+	if (!self || !self->activated) {
+		return -EPIPE;
+	}
+
+	return 0;
+}
+
+static int enable_adc(struct adc *self)
+{
+	if (!self) {
+		return -EPIPE;
+	} else if (self->activated) {
+		return -EALREADY;
+	}
+
+	self->activated = true;
+	return 0;
+}
+
+static int disable_adc(struct adc *self)
+{
+	if (!self) {
+		return -EPIPE;
+	} else if (!self->activated) {
+		return -EALREADY;
+	}
+
+	if (atomic_load(&self->streaming)) {
+		stream_stop(self);
+	}
+
+	self->activated = false;
+	return 0;
+}
+
+struct adc *adc_create(uint8_t adc_num)
+{
+	static struct adc adc[ADC_MAX];
+
+	if (--adc_num >= ADC_MAX || adc[adc_num].api.enable) {
+		return NULL;
+	}
+
+	adc[adc_num] = (struct adc) {
+		.api = {
+			.enable = enable_adc,
+			.disable = disable_adc,
+			.init_channel = init_channel,
+			.calibrate = calibrate_adc,
+			.measure = measure,
+			.read = read_adc,
+			.convert_to_millivolts = convert_to_millivolts,
+			.stream_start = stream_start,
+			.stream_stop = stream_stop,
+		},
+		.noise = 2463534242UL + adc_num,
+	};
+
+	return &adc[adc_num];
+}
+
+int adc_delete(struct adc *self)
+{
+	if (!self) {
+		return -EINVAL;
+	}
+
+	if (self->activated) {
+		disable_adc(self);
+	}
+
+	memset(self, 0, sizeof(*self));
+
+	return 0;
+}
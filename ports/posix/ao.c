@@ -5,31 +5,33 @@
  */
 
 #include "libmcu/ao_overrides.h"
-#include <pthread.h>
+#include "libmcu/lockstat_pthread.h"
 
 static pthread_mutex_t fallback_lock = PTHREAD_MUTEX_INITIALIZER;
+LOCKSTAT_DEFINE(ao_lockstat);
 static pthread_mutex_t timer_lock;
+LOCKSTAT_DEFINE(ao_timer_lockstat);
 
 void ao_lock(void *ctx)
 {
 	unused(ctx);
-	pthread_mutex_lock(&fallback_lock);
+	LOCKSTAT_MUTEX_LOCK(ao_lockstat, &fallback_lock);
 }
 
 void ao_unlock(void *ctx)
 {
 	unused(ctx);
-	pthread_mutex_unlock(&fallback_lock);
+	LOCKSTAT_MUTEX_UNLOCK(ao_lockstat, &fallback_lock);
 }
 
 void ao_timer_lock(void)
 {
-	pthread_mutex_lock(&timer_lock);
+	LOCKSTAT_MUTEX_LOCK(ao_timer_lockstat, &timer_lock);
 }
 
 void ao_timer_unlock(void)
 {
-	pthread_mutex_unlock(&timer_lock);
+	LOCKSTAT_MUTEX_UNLOCK(ao_timer_lockstat, &timer_lock);
 }
 
 void ao_timer_lock_init(void)
@@ -5,16 +5,17 @@
  */
 
 #include "libmcu/button_overrides.h"
-#include <pthread.h>
+#include "libmcu/lockstat_pthread.h"
 
 static pthread_mutex_t lock_handle = PTHREAD_MUTEX_INITIALIZER;
+LOCKSTAT_DEFINE(button_lockstat);
 
 void button_lock(void)
 {
-	pthread_mutex_lock(&lock_handle);
+	LOCKSTAT_MUTEX_LOCK(button_lockstat, &lock_handle);
 }
 
 void button_unlock(void)
 {
-	pthread_mutex_unlock(&lock_handle);
+	LOCKSTAT_MUTEX_UNLOCK(button_lockstat, &lock_handle);
 }
@@ -0,0 +1,509 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* epoll implementation of the event loop. Timers are timerfd and posted
+ * functions wake up the loop through an eventfd. */
+
+#include "libmcu/evloop.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+#if !defined(EVLOOP_EVENTS_MAXLEN)
+#define EVLOOP_EVENTS_MAXLEN		8U
+#endif
+
+#define WAKEUP_TAG			UINT64_MAX
+
+struct watch {
+	evloop_fd_callback_t cb;
+	void *ctx;
+	int fd;
+	/* bumped on removal not to dispatch stale events to a reused slot */
+	uint32_t generation;
+	bool used;
+};
+
+struct post {
+	evloop_callback_t func;
+	void *ctx;
+};
+
+struct evloop {
+	int epfd;
+	int evfd;
+
+	pthread_mutex_t lock;
+	struct watch watches[EVLOOP_MAX_WATCHES];
+
+	struct post posts[EVLOOP_POST_MAXLEN];
+	uint32_t post_outdex;
+	uint32_t nr_posts;
+
+	bool stopped;
+};
+
+struct evloop_timer {
+	struct evloop *loop;
+	int fd;
+	evloop_callback_t cb;
+	void *ctx;
+};
+
+static uint64_t make_tag(uint32_t index, uint32_t generation)
+{
+	return ((uint64_t)generation << 32) | index;
+}
+
+static uint32_t to_epoll_events(uint32_t events)
+{
+	uint32_t res = 0;
+
+	if (events & EVLOOP_READ) {
+		res |= EPOLLIN;
+	}
+	if (events & EVLOOP_WRITE) {
+		res |= EPOLLOUT;
+	}
+
+	return res;
+}
+
+static uint32_t from_epoll_events(uint32_t events)
+{
+	uint32_t res = 0;
+
+	if (events & (EPOLLIN | EPOLLPRI)) {
+		res |= EVLOOP_READ;
+	}
+	if (events & EPOLLOUT) {
+		res |= EVLOOP_WRITE;
+	}
+	if (events & (EPOLLERR | EPOLLHUP)) {
+		res |= EVLOOP_ERROR;
+	}
+
+	return res;
+}
+
+/* It should be called with the lock held. */
+static struct watch *find_watch(struct evloop *self, int fd)
+{
+	for (unsigned int i = 0; i < EVLOOP_MAX_WATCHES; i++) {
+		struct watch *w = &self->watches[i];
+		if (w->used && w->fd == fd) {
+			return w;
+		}
+	}
+
+	return NULL;
+}
+
+/* It should be called with the lock held. */
+static struct watch *find_free_watch(struct evloop *self)
+{
+	for (unsigned int i = 0; i < EVLOOP_MAX_WATCHES; i++) {
+		if (!self->watches[i].used) {
+			return &self->watches[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void wakeup(struct evloop *self)
+{
+	const uint64_t one = 1;
+	ssize_t rc;
+
+	do {
+		rc = write(self->evfd, &one, sizeof(one));
+	} while (rc < 0 && errno == EINTR);
+}
+
+static void drain_wakeup(struct evloop *self)
+{
+	uint64_t count;
+	ssize_t rc;
+
+	do {
+		rc = read(self->evfd, &count, sizeof(count));
+	} while (rc < 0 && errno == EINTR);
+}
+
+static bool pop_post(struct evloop *self, struct post *post)
+{
+	bool popped = false;
+
+	pthread_mutex_lock(&self->lock);
+	if (self->nr_posts) {
+		*post = self->posts[self->post_outdex];
+		self->post_outdex = (self->post_outdex + 1) % EVLOOP_POST_MAXLEN;
+		self->nr_posts--;
+		popped = true;
+	}
+	pthread_mutex_unlock(&self->lock);
+
+	return popped;
+}
+
+/* Only the ones pending at the moment run, not to starve the other events
+ * when functions keep posting themselves. */
+static int run_posted(struct evloop *self)
+{
+	pthread_mutex_lock(&self->lock);
+	uint32_t n = self->nr_posts;
+	pthread_mutex_unlock(&self->lock);
+
+	int count = 0;
+	struct post post;
+
+	while (n-- && pop_post(self, &post)) {
+		(*post.func)(post.ctx);
+		count++;
+	}
+
+	return count;
+}
+
+static int dispatch(struct evloop *self, const struct epoll_event *ev)
+{
+	const uint32_t index = (uint32_t)(ev->data.u64 & UINT32_MAX);
+	const uint32_t generation = (uint32_t)(ev->data.u64 >> 32);
+
+	if (index >= EVLOOP_MAX_WATCHES) {
+		return 0;
+	}
+
+	pthread_mutex_lock(&self->lock);
+	const struct watch *w = &self->watches[index];
+	const bool valid = w->used && w->generation == generation;
+	const struct watch watch = *w;
+	pthread_mutex_unlock(&self->lock);
+
+	if (!valid) {
+		return 0;
+	}
+
+	(*watch.cb)(self, watch.fd, from_epoll_events(ev->events), watch.ctx);
+
+	return 1;
+}
+
+int evloop_run_once(struct evloop *self, uint32_t timeout_ms)
+{
+	struct epoll_event events[EVLOOP_EVENTS_MAXLEN];
+	const int timeout = timeout_ms == EVLOOP_WAIT_FOREVER? -1 :
+		(timeout_ms > INT_MAX? INT_MAX : (int)timeout_ms);
+	int count = 0;
+
+	const int n = epoll_wait(self->epfd,
+			events, EVLOOP_EVENTS_MAXLEN, timeout);
+
+	if (n < 0) {
+		return errno == EINTR? 0 : -errno;
+	}
+
+	for (int i = 0; i < n; i++) {
+		if (events[i].data.u64 == WAKEUP_TAG) {
+			drain_wakeup(self);
+			count += run_posted(self);
+		} else {
+			count += dispatch(self, &events[i]);
+		}
+	}
+
+	return count;
+}
+
+int evloop_run(struct evloop *self)
+{
+	int err = 0;
+
+	pthread_mutex_lock(&self->lock);
+	self->stopped = false;
+	pthread_mutex_unlock(&self->lock);
+
+	while (err >= 0) {
+		pthread_mutex_lock(&self->lock);
+		const bool stopped = self->stopped;
+		pthread_mutex_unlock(&self->lock);
+
+		if (stopped) {
+			break;
+		}
+
+		err = evloop_run_once(self, EVLOOP_WAIT_FOREVER);
+	}
+
+	return err < 0? err : 0;
+}
+
+int evloop_stop(struct evloop *self)
+{
+	if (!self) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&self->lock);
+	self->stopped = true;
+	pthread_mutex_unlock(&self->lock);
+
+	wakeup(self);
+
+	return 0;
+}
+
+int evloop_post(struct evloop *self, evloop_callback_t func, void *ctx)
+{
+	int err = 0;
+
+	if (!self || !func) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&self->lock);
+	if (self->nr_posts >= EVLOOP_POST_MAXLEN) {
+		err = -ENOSPC;
+	} else {
+		const uint32_t index = (self->post_outdex + self->nr_posts)
+			% EVLOOP_POST_MAXLEN;
+		self->posts[index] = (struct post) { .func = func, .ctx = ctx, };
+		self->nr_posts++;
+	}
+	pthread_mutex_unlock(&self->lock);
+
+	if (!err) {
+		wakeup(self);
+	}
+
+	return err;
+}
+
+int evloop_add_fd(struct evloop *self, int fd, uint32_t events,
+		evloop_fd_callback_t cb, void *ctx)
+{
+	int err = 0;
+
+	if (!self || fd < 0 || !cb) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&self->lock);
+	struct watch *w = NULL;
+
+	if (find_watch(self, fd)) {
+		err = -EEXIST;
+	} else if ((w = find_free_watch(self)) == NULL) {
+		err = -ENOSPC;
+	} else {
+		struct epoll_event ev = {
+			.events = to_epoll_events(events),
+			.data.u64 = make_tag((uint32_t)(w - self->watches),
+					w->generation),
+		};
+
+		if (epoll_ctl(self->epfd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+			err = -errno;
+		} else {
+			w->fd = fd;
+			w->cb = cb;
+			w->ctx = ctx;
+			w->used = true;
+		}
+	}
+	pthread_mutex_unlock(&self->lock);
+
+	return err;
+}
+
+int evloop_modify_fd(struct evloop *self, int fd, uint32_t events)
+{
+	int err = -ENOENT;
+
+	pthread_mutex_lock(&self->lock);
+	const struct watch *w = find_watch(self, fd);
+	if (w) {
+		struct epoll_event ev = {
+			.events = to_epoll_events(events),
+			.data.u64 = make_tag((uint32_t)(w - self->watches),
+					w->generation),
+		};
+		err = epoll_ctl(self->epfd, EPOLL_CTL_MOD, fd, &ev) == 0?
+			0 : -errno;
+	}
+	pthread_mutex_unlock(&self->lock);
+
+	return err;
+}
+
+int evloop_remove_fd(struct evloop *self, int fd)
+{
+	int err = -ENOENT;
+
+	pthread_mutex_lock(&self->lock);
+	struct watch *w = find_watch(self, fd);
+	if (w) {
+		epoll_ctl(self->epfd, EPOLL_CTL_DEL, fd, NULL);
+		w->used = false;
+		w->generation++;
+		err = 0;
+	}
+	pthread_mutex_unlock(&self->lock);
+
+	return err;
+}
+
+static void on_timer(struct evloop *loop, int fd, uint32_t events, void *ctx)
+{
+	struct evloop_timer *timer = (struct evloop_timer *)ctx;
+	uint64_t expirations;
+
+	(void)loop;
+	(void)events;
+
+	/* fails with EAGAIN when stopped or restarted after the expiration */
+	if (read(fd, &expirations, sizeof(expirations)) ==
+			(ssize_t)sizeof(expirations)) {
+		(*timer->cb)(timer->ctx);
+	}
+}
+
+static struct timespec ms_to_timespec(uint32_t ms)
+{
+	return (struct timespec) {
+		.tv_sec = ms / 1000,
+		.tv_nsec = (long)(ms % 1000) * 1000000L,
+	};
+}
+
+int evloop_timer_start(struct evloop_timer *timer,
+		uint32_t timeout_ms, uint32_t interval_ms)
+{
+	if (!timer) {
+		return -EINVAL;
+	}
+
+	struct itimerspec spec = {
+		.it_value = ms_to_timespec(timeout_ms),
+		.it_interval = ms_to_timespec(interval_ms),
+	};
+
+	if (timeout_ms == 0) { /* zero disarms the timer */
+		spec.it_value.tv_nsec = 1;
+	}
+
+	return timerfd_settime(timer->fd, 0, &spec, NULL) == 0? 0 : -errno;
+}
+
+int evloop_timer_stop(struct evloop_timer *timer)
+{
+	const struct itimerspec spec = { 0, };
+
+	if (!timer) {
+		return -EINVAL;
+	}
+
+	return timerfd_settime(timer->fd, 0, &spec, NULL) == 0? 0 : -errno;
+}
+
+struct evloop_timer *evloop_timer_create(struct evloop *self,
+		evloop_callback_t cb, void *ctx)
+{
+	struct evloop_timer *timer;
+
+	if (!self || !cb) {
+		return NULL;
+	}
+
+	if ((timer = (struct evloop_timer *)malloc(sizeof(*timer))) == NULL) {
+		return NULL;
+	}
+
+	*timer = (struct evloop_timer) {
+		.loop = self,
+		.fd = timerfd_create(CLOCK_MONOTONIC,
+				TFD_NONBLOCK | TFD_CLOEXEC),
+		.cb = cb,
+		.ctx = ctx,
+	};
+
+	if (timer->fd < 0 || evloop_add_fd(self, timer->fd,
+			EVLOOP_READ, on_timer, timer) != 0) {
+		if (timer->fd >= 0) {
+			close(timer->fd);
+		}
+		free(timer);
+		return NULL;
+	}
+
+	return timer;
+}
+
+void evloop_timer_destroy(struct evloop_timer *timer)
+{
+	if (!timer) {
+		return;
+	}
+
+	evloop_remove_fd(timer->loop, timer->fd);
+	close(timer->fd);
+	free(timer);
+}
+
+struct evloop *evloop_create(void)
+{
+	struct evloop *self = (struct evloop *)calloc(1, sizeof(*self));
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+		.data.u64 = WAKEUP_TAG,
+	};
+
+	if (self == NULL) {
+		return NULL;
+	}
+
+	self->epfd = epoll_create1(EPOLL_CLOEXEC);
+	self->evfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+	if (self->epfd < 0 || self->evfd < 0 ||
+			epoll_ctl(self->epfd, EPOLL_CTL_ADD,
+					self->evfd, &ev) != 0) {
+		goto out_err;
+	}
+
+	pthread_mutex_init(&self->lock, NULL);
+
+	return self;
+out_err:
+	if (self->epfd >= 0) {
+		close(self->epfd);
+	}
+	if (self->evfd >= 0) {
+		close(self->evfd);
+	}
+	free(self);
+	return NULL;
+}
+
+void evloop_destroy(struct evloop *self)
+{
+	if (!self) {
+		return;
+	}
+
+	close(self->evfd);
+	close(self->epfd);
+	pthread_mutex_destroy(&self->lock);
+	free(self);
+}
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_METRICS_SHM_H
+#define LIBMCU_METRICS_SHM_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Metrics kept in a POSIX shared memory segment.
+ *
+ * Linking metrics_shm.c in place of metrics.c of this port places the metrics
+ * storage in the segment named METRICS_SHM_NAME, created in metrics_init().
+ * Other processes read the values with the functions below, linking
+ * metrics_shm_reader.c only, without taking the writer's lock or going
+ * through metrics_collect().
+ *
+ * The segment is laid out as the header followed by the entries and then the
+ * key strings. Updates are guarded by the sequence number in the header,
+ * which stays odd while being written. A reader retries when the sequence
+ * number is odd or changed while copying.
+ */
+
+#if !defined(METRICS_SHM_NAME)
+#define METRICS_SHM_NAME		"/libmcu_metrics"
+#endif
+#if !defined(METRICS_SHM_KEY_STRING_MAXLEN)
+#define METRICS_SHM_KEY_STRING_MAXLEN	32
+#endif
+#if !defined(METRICS_SHM_READ_RETRY)
+#define METRICS_SHM_READ_RETRY		1000
+#endif
+
+#define METRICS_SHM_MAGIC		0x4d545243U /* "MTRC" */
+#define METRICS_SHM_VERSION		1
+
+/* Layout of an entry in version 1, the same as struct metrics_entry */
+#define METRICS_SHM_ENTRY_KEY_OFFSET	0 /* uint16_t */
+#define METRICS_SHM_ENTRY_VALUE_OFFSET	2 /* int32_t */
+#define METRICS_SHM_ENTRY_ISSET_OFFSET	6 /* uint8_t */
+#define METRICS_SHM_ENTRY_SIZE		7
+
+struct metrics_shm_header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t nr_keys;
+	uint32_t seq;
+	uint16_t entry_size;
+	uint16_t key_string_size;
+	uint32_t entries_offset;
+	uint32_t key_strings_offset;
+};
+
+struct metrics_shm {
+	const uint8_t *base;
+	size_t size;
+};
+
+struct metrics_shm_value {
+	uint16_t key;
+	bool is_set;
+	int32_t value;
+};
+
+/**
+ * @brief Map the segment read-only.
+ *
+ * @param[out] shm handle to be initialized
+ * @param[in] name name of the segment. e.g. @ref METRICS_SHM_NAME
+ *
+ * @return 0 on success, -EPROTO if the layout is unknown or not ready yet,
+ *         otherwise negative errno of shm_open() or mmap().
+ */
+int metrics_shm_open(struct metrics_shm *shm, const char *name);
+void metrics_shm_close(struct metrics_shm *shm);
+
+size_t metrics_shm_count(const struct metrics_shm *shm);
+/**
+ * @return the key string or an empty string if the writer was built without
+ *         key strings.
+ */
+const char *metrics_shm_key_string(const struct metrics_shm *shm, uint16_t key);
+
+/**
+ * @brief Read the value of a metric.
+ *
+ * @return 0 on success, -ENOENT if not set, -ERANGE if @p key is out of range,
+ *         -EAGAIN if the writer kept updating for @ref METRICS_SHM_READ_RETRY
+ *         tries.
+ */
+int metrics_shm_get(const struct metrics_shm *shm, uint16_t key,
+		int32_t *value);
+
+/**
+ * @brief Copy all metrics at a single point in time.
+ *
+ * @param[out] buf buffer of @p n values
+ * @param[in] n the number of values @p buf can hold
+ *
+ * @return the number of values copied, -ENOBUFS if @p n is less than the
+ *         number of metrics or -EAGAIN as @ref metrics_shm_get.
+ */
+int metrics_shm_snapshot(const struct metrics_shm *shm,
+		struct metrics_shm_value *buf, size_t n);
+
+/**
+ * @brief Remove the segment.
+ *
+ * The mappings stay valid until closed.
+ *
+ * @param[in] name name of the segment
+ *
+ * @return 0 on success, otherwise negative errno.
+ */
+int metrics_shm_unlink(const char *name);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_METRICS_SHM_H */
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_MSGQ_SHARED_H
+#define LIBMCU_MSGQ_SHARED_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include "libmcu/msgq.h"
+
+/*
+ * Message queue shared between processes on Linux.
+ *
+ * Messages are framed with @ref msgq_msg_meta_t the same way as @ref msgq,
+ * in a POSIX shared memory segment addressed by offsets so that each process
+ * may map it anywhere. Any number of producers push with atomic reservation
+ * and a single consumer pops, blocking on a futex when empty. No lock
+ * callbacks are involved.
+ *
+ * A producer killed in the middle of a push leaves the queue stuck for the
+ * other producers, as the messages are committed in order.
+ */
+
+#if !defined(MSGQ_SHARED_OPEN_TIMEOUT_MS)
+#define MSGQ_SHARED_OPEN_TIMEOUT_MS		1000
+#endif
+
+struct msgq_shared;
+
+/**
+ * @brief Create or open a message queue shared between processes.
+ *
+ * The queue is created by whichever process comes first and opened by the
+ * others.
+ *
+ * @param[in] name name of the shared memory. e.g. "/samples"
+ * @param[in] capacity_bytes capacity in bytes. It should be a power of 2 and
+ *            the same in all the processes.
+ *
+ * @return A pointer to the queue, or NULL if the creation fails.
+ */
+struct msgq_shared *msgq_create_shared(const char *name,
+		const size_t capacity_bytes);
+
+/**
+ * @brief Unmap the queue in the calling process.
+ *
+ * The queue is kept until removed with @ref msgq_unlink_shared.
+ */
+void msgq_destroy_shared(struct msgq_shared *q);
+
+/**
+ * @brief Remove the queue from the system.
+ *
+ * @return 0 on success, negative errno on failure.
+ */
+int msgq_unlink_shared(const char *name);
+
+/**
+ * @brief Push a message. Safe to call from multiple producers.
+ *
+ * @return 0 on success, -ENOMEM if not enough space.
+ */
+int msgq_push_shared(struct msgq_shared *q,
+		const void *data, const size_t datasize);
+
+/**
+ * @brief Pop a message. Only one consumer is allowed.
+ *
+ * @param[in] timeout_ms time to wait for a message. 0 not to wait and -1 to
+ *            wait forever.
+ *
+ * @return The length of the message on success. -ENOENT if empty with no
+ *         wait, -ETIMEDOUT if no message in time or -ERANGE if @p bufsize is
+ *         smaller than the message.
+ */
+int msgq_pop_shared(struct msgq_shared *q, void *buf, size_t bufsize,
+		int timeout_ms);
+
+size_t msgq_len_shared(const struct msgq_shared *q);
+size_t msgq_cap_shared(const struct msgq_shared *q);
+size_t msgq_next_msg_size_shared(const struct msgq_shared *q);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_MSGQ_SHARED_H */
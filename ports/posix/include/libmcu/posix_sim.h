@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_POSIX_SIM_H
+#define LIBMCU_POSIX_SIM_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Discrete-event virtual clock for host simulation.
+ *
+ * Linking this port replaces board_get_time_since_boot_ms(),
+ * board_get_time_since_boot_us() and time() with the virtual clock. The clock
+ * stands still while any registered thread is running and jumps straight to
+ * the next deadline once all of them are idle in one of the sim_ functions
+ * below. The deadlines are the wake-up times of the idle threads and the ones
+ * reported by the sources registered with deadline_register().
+ *
+ * Threads that block on anything other than the sim_ functions are not seen
+ * as idle and keep the clock from advancing.
+ */
+
+struct sim_event {
+	bool signaled;
+};
+
+/**
+ * @brief Reset the virtual clock.
+ *
+ * It should be called before any thread gets registered.
+ *
+ * @param[in] epoch Seconds since the Epoch that time() returns at boot.
+ */
+void sim_init(uint64_t epoch);
+
+/**
+ * @brief Make the calling thread take part in idle detection.
+ *
+ * @return 0 on success, -EALREADY if already registered.
+ */
+int sim_thread_register(void);
+
+/**
+ * @brief Exclude the calling thread from idle detection.
+ *
+ * @return 0 on success, -ENOENT if not registered.
+ */
+int sim_thread_unregister(void);
+
+uint64_t sim_now_us(void);
+
+/**
+ * @brief Sleep in virtual time.
+ *
+ * @param[in] ms Time to sleep.
+ *
+ * @return 0 on success, -EPERM if the calling thread is not registered.
+ */
+int sim_sleep_ms(uint32_t ms);
+
+/**
+ * @brief Sleep until the earliest deadline of the registered sources.
+ *
+ * A driver thread calls it in a loop, running the timer modules with the time
+ * elapsed, to get through hours of simulated time in no time.
+ *
+ * @param[in] max_ms Upper bound of the sleep.
+ *
+ * @return The time elapsed in milliseconds, or -EPERM if the calling thread is
+ *         not registered.
+ */
+int sim_advance(uint32_t max_ms);
+
+/**
+ * @brief Wait for an event in virtual time.
+ *
+ * The event gets cleared on return.
+ *
+ * @param[in] ev The event to wait for.
+ * @param[in] timeout_ms Time to wait. UINT32_MAX to wait forever.
+ *
+ * @return 0 when signaled, -ETIMEDOUT on timeout, or -EPERM if the calling
+ *         thread is not registered.
+ */
+int sim_event_wait(struct sim_event *ev, uint32_t timeout_ms);
+
+/**
+ * @brief Signal an event, waking up the threads waiting for it.
+ *
+ * It can be called from any thread, registered or not.
+ *
+ * @param[in] ev The event to signal.
+ */
+void sim_event_signal(struct sim_event *ev);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_POSIX_SIM_H */
@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_POSIX_UART_H
+#define LIBMCU_POSIX_UART_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "libmcu/uart.h"
+
+/**
+ * @brief Create a UART instance over a serial device or a pseudo terminal.
+ *
+ * @ref uart_create is the same as giving NULL to @p path.
+ *
+ * @param[in] channel The UART channel number.
+ * @param[in] path Serial device path, e.g. /dev/ttyUSB0. NULL to open a new
+ *            pseudo terminal for a peer to connect to.
+ *
+ * @return Pointer to the created UART instance, or NULL on failure.
+ */
+struct uart *posix_uart_create(uint8_t channel, const char *path);
+
+/**
+ * @brief Get the device path the peer should open.
+ *
+ * @param[in] self The UART instance.
+ *
+ * @return The pseudo terminal slave path, or the serial device path given.
+ */
+const char *posix_uart_name(const struct uart *self);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_POSIX_UART_H */
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_PROFILER_H
+#define LIBMCU_PROFILER_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Sampling profiler for Linux.
+ *
+ * Each registered thread gets a timer on its own CPU time clock, delivering
+ * SIGPROF to the thread. The handler takes the PC and walks a few frame
+ * pointers into a per-thread ring buffer, which @ref profiler_collect drains
+ * into a table of unique stacks. Build with -fno-omit-frame-pointer for the
+ * callers to show up; only the sampled PC is recorded otherwise.
+ *
+ * Threads are named after pthread_getname_np(), or the handle from
+ * @ref trace_get_current_thread when not named.
+ */
+
+#if !defined(PROFILER_MAX_THREADS)
+#define PROFILER_MAX_THREADS		8U
+#endif
+#if !defined(PROFILER_MAX_DEPTH)
+#define PROFILER_MAX_DEPTH		8U
+#endif
+#if !defined(PROFILER_BUFFER_LEN) /* samples per thread, power of 2 */
+#define PROFILER_BUFFER_LEN		256U
+#endif
+#if !defined(PROFILER_MAX_STACKS) /* power of 2 */
+#define PROFILER_MAX_STACKS		1024U
+#endif
+#if !defined(PROFILER_DEFAULT_HZ)
+#define PROFILER_DEFAULT_HZ		997U
+#endif
+
+struct profiler_stack {
+	const char *thread_name;
+	void *thread;
+	uint32_t count;
+	uint8_t depth;
+	/* innermost first */
+	uintptr_t pc[PROFILER_MAX_DEPTH];
+};
+
+typedef void (*profiler_iterate_cb_t)(const struct profiler_stack *stack,
+		void *ctx);
+typedef int (*profiler_writer_t)(const void *data, size_t datasize,
+		void *ctx);
+
+/**
+ * @brief Register the calling thread to be sampled.
+ *
+ * It starts being sampled right away if the profiler is running.
+ *
+ * @return 0 on success, -EALREADY if registered already, -ENOSPC if
+ *         @ref PROFILER_MAX_THREADS are registered already or other negative
+ *         errno on failure.
+ */
+int profiler_register_thread(void);
+
+/**
+ * @brief Unregister the calling thread. Call before the thread exits.
+ *
+ * The samples not collected yet are collected first.
+ */
+int profiler_unregister_thread(void);
+
+/**
+ * @brief Start sampling the registered threads.
+ *
+ * @param[in] hz samples per second of CPU time. 0 for
+ *            @ref PROFILER_DEFAULT_HZ
+ *
+ * @return 0 on success, -EALREADY if running or other negative errno.
+ */
+int profiler_start(unsigned int hz);
+
+/**
+ * @brief Stop sampling and collect the samples left.
+ */
+void profiler_stop(void);
+
+/**
+ * @brief Move the samples from the per-thread buffers into the table.
+ *
+ * Call it while running often enough not to overflow the buffers, i.e.
+ * sooner than @ref PROFILER_BUFFER_LEN samples of a thread.
+ */
+void profiler_collect(void);
+
+/**
+ * @brief Clear the table and the counters.
+ */
+void profiler_reset(void);
+
+/**
+ * @brief Get the number of samples dropped for lack of space.
+ */
+uint32_t profiler_dropped(void);
+
+/**
+ * @brief Iterate over the unique stacks collected.
+ */
+void profiler_iterate(profiler_iterate_cb_t cb, void *ctx);
+
+/**
+ * @brief Write the collected stacks in the folded format of flamegraph.pl.
+ *
+ * One line per stack of `thread;outermost;...;innermost count`, with the
+ * symbol names resolved by dladdr() or the addresses in hex.
+ *
+ * @return 0 on success, or the negative value the writer returned.
+ */
+int profiler_export_folded(profiler_writer_t writer, void *ctx);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_PROFILER_H */
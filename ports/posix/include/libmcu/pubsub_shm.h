@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_PUBSUB_SHM_H
+#define LIBMCU_PUBSUB_SHM_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+/*
+ * Bridge of pubsub between two processes on Linux.
+ *
+ * A bridge has two single-producer single-consumer rings in shared memory,
+ * one for each direction. Messages published locally on the forwarded topics
+ * are copied into the tx ring once. The peer publishes them in its own
+ * process from pubsub_shm_poll(), straight out of the ring without copying,
+ * so subscribers on the peer side should not keep the message pointer after
+ * returning.
+ *
+ * The peer is woken up with a futex on the ring, which costs a syscall only
+ * when the peer is actually waiting.
+ *
+ *	Process A:
+ *		bridge = pubsub_shm_create("/a2b", "/b2a", 4096);
+ *		pubsub_shm_forward(bridge, "sensor/#");
+ *	Process B:
+ *		bridge = pubsub_shm_create("/b2a", "/a2b", 4096);
+ *		pubsub_shm_forward(bridge, "cmd/#");
+ *		while (1) pubsub_shm_poll(bridge, -1);
+ */
+
+#if !defined(PUBSUB_SHM_MAX_FILTERS)
+#define PUBSUB_SHM_MAX_FILTERS			8
+#endif
+#if !defined(PUBSUB_SHM_OPEN_TIMEOUT_MS)
+#define PUBSUB_SHM_OPEN_TIMEOUT_MS		1000
+#endif
+
+struct pubsub_shm;
+
+/**
+ * @brief Create a bridge to the peer process.
+ *
+ * A ring is created by whichever process comes first and opened by the
+ * other, so the peer may create its bridge either before or after.
+ *
+ * @param[in] tx_name name of the shared memory to send to the peer
+ * @param[in] rx_name name of the shared memory to receive from the peer
+ * @param[in] capacity ring size in bytes. It should be a power of 2 and the
+ *            same on both sides. A message larger than a half of it is not
+ *            forwarded.
+ *
+ * @return the bridge on success, NULL otherwise.
+ */
+struct pubsub_shm *pubsub_shm_create(const char *tx_name, const char *rx_name,
+		size_t capacity);
+void pubsub_shm_delete(struct pubsub_shm *bridge);
+
+/**
+ * @brief Forward the messages published on @p topic_filter to the peer.
+ *
+ * A message is dropped when the tx ring is full, rather than blocking the
+ * publisher.
+ *
+ * @note @p topic_filter should be kept valid as in pubsub_subscribe().
+ *
+ * @return 0 on success, -ENOSPC if @ref PUBSUB_SHM_MAX_FILTERS already added,
+ *         -ENOMEM if failed to subscribe.
+ */
+int pubsub_shm_forward(struct pubsub_shm *bridge, const char *topic_filter);
+
+/**
+ * @brief Publish the messages received from the peer.
+ *
+ * Messages received here are not forwarded back to the peer even if they
+ * match the filters of this bridge.
+ *
+ * @param[in] timeout_ms time to wait for a message. -1 to wait forever.
+ *
+ * @return the number of messages published, 0 on timeout.
+ */
+int pubsub_shm_poll(struct pubsub_shm *bridge, int timeout_ms);
+
+/**
+ * @return the number of messages not forwarded as the tx ring was full or the
+ *         message was too large.
+ */
+size_t pubsub_shm_dropped(const struct pubsub_shm *bridge);
+
+/**
+ * @brief Remove a ring from the system.
+ *
+ * @return 0 on success, otherwise negative errno.
+ */
+int pubsub_shm_unlink(const char *name);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_PUBSUB_SHM_H */
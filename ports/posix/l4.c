@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* Plain TCP implementation of L4 for host builds. TLS parameters are ignored
+ * so that a local TCP server can stand in for the real endpoint. */
+
+#include "libmcu/port/l4.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+#if !defined(L4_ENDPOINT_MAXLEN)
+#define L4_ENDPOINT_MAXLEN		128
+#endif
+
+struct l4 {
+	struct l4_conn_param param;
+	int fd;
+};
+
+static bool is_connected(const struct l4 *self)
+{
+	return self->fd >= 0;
+}
+
+static void set_timeout(int fd, uint16_t timeout_ms)
+{
+	const struct timeval tv = {
+		.tv_sec = timeout_ms / 1000,
+		.tv_usec = (timeout_ms % 1000) * 1000,
+	};
+
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+	setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+}
+
+static int connect_internal(struct l4 *self)
+{
+	char host[L4_ENDPOINT_MAXLEN];
+	char port[6];
+	struct addrinfo hints = {
+		.ai_family = AF_UNSPEC,
+		.ai_socktype = SOCK_STREAM,
+	};
+	struct addrinfo *res;
+	int rc = -ECONNREFUSED;
+
+	if (self->param.endpoint_len >= sizeof(host)) {
+		return -ENAMETOOLONG;
+	}
+
+	memcpy(host, self->param.endpoint, self->param.endpoint_len);
+	host[self->param.endpoint_len] = '\0';
+	snprintf(port, sizeof(port), "%u", self->param.port);
+
+	if (getaddrinfo(host, port, &hints, &res) != 0) {
+		return -EHOSTUNREACH;
+	}
+
+	for (struct addrinfo *p = res; p; p = p->ai_next) {
+		int fd = socket(p->ai_family, p->ai_socktype, p->ai_protocol);
+
+		if (fd < 0) {
+			continue;
+		}
+
+		if (self->param.timeout_ms) {
+			set_timeout(fd, self->param.timeout_ms);
+		}
+
+		if (connect(fd, p->ai_addr, p->ai_addrlen) == 0) {
+			self->fd = fd;
+			rc = 0;
+			break;
+		}
+
+		rc = -errno;
+		close(fd);
+	}
+
+	freeaddrinfo(res);
+
+	return rc;
+}
+
+int l4_port_write(struct l4 *self, const void *data, size_t data_len)
+{
+	const uint8_t *p = (const uint8_t *)data;
+	size_t bytes_sent = 0;
+
+	if (!is_connected(self)) {
+		return -ENOTCONN;
+	}
+
+	while (bytes_sent < data_len) {
+		const ssize_t rc = send(self->fd, &p[bytes_sent],
+				data_len - bytes_sent, MSG_NOSIGNAL);
+
+		if (rc < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return -errno;
+		}
+
+		bytes_sent += (size_t)rc;
+	}
+
+	return (int)bytes_sent;
+}
+
+int l4_port_read(struct l4 *self, void *buf, size_t bufsize)
+{
+	if (!is_connected(self)) {
+		return -ENOTCONN;
+	}
+
+	const ssize_t rc = recv(self->fd, buf, bufsize, 0);
+
+	if (rc == 0) {
+		return -ECONNRESET;
+	} else if (rc < 0) {
+		if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+			return 0;
+		}
+		return -errno;
+	}
+
+	return (int)rc;
+}
+
+int l4_port_connect(struct l4 *self)
+{
+	if (is_connected(self)) {
+		return -EISCONN;
+	}
+
+	return connect_internal(self);
+}
+
+int l4_port_disconnect(struct l4 *self)
+{
+	if (!is_connected(self)) {
+		return -ENOTCONN;
+	}
+
+	close(self->fd);
+	self->fd = -1;
+
+	return 0;
+}
+
+struct l4 *tls_port_create(const struct l4_conn_param *param)
+{
+	struct l4 *self = (struct l4 *)calloc(1, sizeof(*self));
+
+	if (self == NULL) {
+		return NULL;
+	}
+
+	memcpy(&self->param, param, sizeof(*param));
+	self->fd = -1;
+
+	return self;
+}
+
+void tls_port_destroy(struct l4 *self)
+{
+	if (self && is_connected(self)) {
+		close(self->fd);
+	}
+
+	free(self);
+}
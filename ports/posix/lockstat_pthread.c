@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/lockstat_pthread.h"
+#include <errno.h>
+#include <time.h>
+
+int lockstat_mutex_lock(struct lockstat *stat, pthread_mutex_t *mutex,
+		const void *caller)
+{
+	int err = pthread_mutex_trylock(mutex);
+
+	if (err == 0) {
+		lockstat_acquired(stat, 0, false, caller);
+	} else if (err == EBUSY) {
+		const uint64_t t0 = lockstat_get_time_ns();
+
+		if ((err = pthread_mutex_lock(mutex)) == 0) {
+			lockstat_acquired(stat, lockstat_get_time_ns() - t0,
+					true, caller);
+		}
+	}
+
+	return err;
+}
+
+int lockstat_mutex_unlock(struct lockstat *stat, pthread_mutex_t *mutex)
+{
+	lockstat_released(stat);
+	return pthread_mutex_unlock(mutex);
+}
+
+uint64_t lockstat_get_time_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000U + (uint64_t)ts.tv_nsec;
+}
@@ -5,9 +5,10 @@
  */
 
 #include "libmcu/logging.h"
-#include <pthread.h>
+#include "libmcu/lockstat_pthread.h"
 
 static pthread_mutex_t lock;
+LOCKSTAT_DEFINE(logging_lockstat);
 
 void logging_lock_init(void)
 {
@@ -16,10 +17,10 @@ void logging_lock_init(void)
 
 void logging_lock(void)
 {
-	pthread_mutex_lock(&lock);
+	LOCKSTAT_MUTEX_LOCK(logging_lockstat, &lock);
 }
 
 void logging_unlock(void)
 {
-	pthread_mutex_unlock(&lock);
+	LOCKSTAT_MUTEX_UNLOCK(logging_lockstat, &lock);
 }
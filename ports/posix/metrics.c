@@ -5,16 +5,17 @@
  */
 
 #include "libmcu/metrics.h"
-#include <pthread.h>
+#include "libmcu/lockstat_pthread.h"
 
 static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+LOCKSTAT_DEFINE(metrics_lockstat);
 
 void metrics_lock(void)
 {
-	pthread_mutex_lock(&lock);
+	LOCKSTAT_MUTEX_LOCK(metrics_lockstat, &lock);
 }
 
 void metrics_unlock(void)
 {
-	pthread_mutex_unlock(&lock);
+	LOCKSTAT_MUTEX_UNLOCK(metrics_lockstat, &lock);
 }
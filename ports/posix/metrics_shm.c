@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/metrics_shm.h"
+#include "libmcu/metrics_overrides.h"
+#include "libmcu/lockstat_pthread.h"
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+static_assert(offsetof(struct metrics_entry, key)
+		== METRICS_SHM_ENTRY_KEY_OFFSET, "entry layout changed");
+static_assert(offsetof(struct metrics_entry, value)
+		== METRICS_SHM_ENTRY_VALUE_OFFSET, "entry layout changed");
+static_assert(offsetof(struct metrics_entry, is_set)
+		== METRICS_SHM_ENTRY_ISSET_OFFSET, "entry layout changed");
+static_assert(sizeof(struct metrics_entry) == METRICS_SHM_ENTRY_SIZE,
+		"entry layout changed");
+
+static struct {
+	pthread_mutex_t lock;
+	struct metrics_shm_header *header;
+} m = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+};
+LOCKSTAT_DEFINE(metrics_lockstat);
+
+void metrics_lock(void)
+{
+	LOCKSTAT_MUTEX_LOCK(metrics_lockstat, &m.lock);
+
+	if (m.header) {
+		__atomic_store_n(&m.header->seq, m.header->seq + 1,
+				__ATOMIC_RELAXED);
+		/* keep the entries from being written before the odd seq */
+		__atomic_thread_fence(__ATOMIC_RELEASE);
+	}
+}
+
+void metrics_unlock(void)
+{
+	if (m.header) {
+		__atomic_store_n(&m.header->seq, m.header->seq + 1,
+				__ATOMIC_RELEASE);
+	}
+
+	LOCKSTAT_MUTEX_UNLOCK(metrics_lockstat, &m.lock);
+}
+
+static void fill_key_strings(struct metrics_shm_header *header)
+{
+	char *p = (char *)header + header->key_strings_offset;
+
+	memset(p, 0, (size_t)header->nr_keys * header->key_string_size);
+
+#if !defined(METRICS_NO_KEY_STRING)
+	for (metric_key_t i = 0; i < header->nr_keys; i++) {
+		strncpy(&p[i * header->key_string_size],
+				metrics_stringify_key(i),
+				header->key_string_size - 1U);
+	}
+#endif
+}
+
+static struct metrics_shm_header *create(size_t entries_size)
+{
+	const size_t nr_keys = metrics_count();
+	const size_t entries_offset =
+		ALIGN(sizeof(struct metrics_shm_header), sizeof(uint64_t));
+	const size_t key_strings_offset = entries_offset + entries_size;
+	const size_t total = key_strings_offset +
+		nr_keys * METRICS_SHM_KEY_STRING_MAXLEN;
+
+	const int fd = shm_open(METRICS_SHM_NAME, O_CREAT | O_RDWR, 0644);
+
+	if (fd < 0) {
+		return NULL;
+	}
+
+	void *p = MAP_FAILED;
+
+	if (ftruncate(fd, (off_t)total) == 0) {
+		p = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	}
+
+	close(fd);
+
+	if (p == MAP_FAILED) {
+		return NULL;
+	}
+
+	struct metrics_shm_header *header = (struct metrics_shm_header *)p;
+
+	/* readers see the segment not ready until the magic is stored */
+	__atomic_store_n(&header->magic, 0, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	header->version = METRICS_SHM_VERSION;
+	header->nr_keys = (uint16_t)nr_keys;
+	header->seq = 0;
+	header->entry_size = METRICS_SHM_ENTRY_SIZE;
+	header->key_string_size = METRICS_SHM_KEY_STRING_MAXLEN;
+	header->entries_offset = (uint32_t)entries_offset;
+	header->key_strings_offset = (uint32_t)key_strings_offset;
+
+	fill_key_strings(header);
+
+	__atomic_store_n(&header->magic, METRICS_SHM_MAGIC, __ATOMIC_RELEASE);
+
+	return header;
+}
+
+void *metrics_storage_get(size_t size)
+{
+	if (m.header == NULL) {
+		m.header = create(size);
+	}
+
+	if (m.header == NULL) {
+		return NULL;
+	}
+
+	return (uint8_t *)m.header + m.header->entries_offset;
+}
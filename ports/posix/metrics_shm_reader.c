@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/metrics_shm.h"
+
+#include <errno.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+static const struct metrics_shm_header *get_header(const struct metrics_shm *shm)
+{
+	return (const struct metrics_shm_header *)(const void *)shm->base;
+}
+
+static bool is_layout_valid(const struct metrics_shm_header *header,
+		size_t size)
+{
+	if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE)
+			!= METRICS_SHM_MAGIC) {
+		return false;
+	}
+
+	const size_t entries_end = (size_t)header->entries_offset +
+		(size_t)header->nr_keys * header->entry_size;
+	const size_t key_strings_end = (size_t)header->key_strings_offset +
+		(size_t)header->nr_keys * header->key_string_size;
+
+	return header->version == METRICS_SHM_VERSION &&
+		header->entry_size == METRICS_SHM_ENTRY_SIZE &&
+		header->key_string_size > 0 &&
+		header->entries_offset >= sizeof(*header) &&
+		entries_end <= header->key_strings_offset &&
+		key_strings_end <= size;
+}
+
+static uint32_t read_begin(const struct metrics_shm_header *header)
+{
+	return __atomic_load_n(&header->seq, __ATOMIC_ACQUIRE);
+}
+
+static bool read_retry(const struct metrics_shm_header *header, uint32_t seq)
+{
+	/* keep the entries from being read after the seq */
+	__atomic_thread_fence(__ATOMIC_ACQUIRE);
+	return (seq & 1) || __atomic_load_n(&header->seq, __ATOMIC_RELAXED) != seq;
+}
+
+static void copy_entry(const struct metrics_shm *shm, uint16_t key,
+		struct metrics_shm_value *value)
+{
+	const struct metrics_shm_header *header = get_header(shm);
+	const uint8_t *p = &shm->base[header->entries_offset +
+		(size_t)key * header->entry_size];
+	uint8_t is_set;
+
+	memcpy(&value->key, &p[METRICS_SHM_ENTRY_KEY_OFFSET],
+			sizeof(value->key));
+	memcpy(&value->value, &p[METRICS_SHM_ENTRY_VALUE_OFFSET],
+			sizeof(value->value));
+	memcpy(&is_set, &p[METRICS_SHM_ENTRY_ISSET_OFFSET], sizeof(is_set));
+	value->is_set = is_set != 0;
+}
+
+int metrics_shm_get(const struct metrics_shm *shm, uint16_t key,
+		int32_t *value)
+{
+	const struct metrics_shm_header *header = get_header(shm);
+	struct metrics_shm_value v;
+
+	if (key >= header->nr_keys) {
+		return -ERANGE;
+	}
+
+	for (int i = 0; i < METRICS_SHM_READ_RETRY; i++) {
+		const uint32_t seq = read_begin(header);
+
+		copy_entry(shm, key, &v);
+
+		if (!read_retry(header, seq)) {
+			if (!v.is_set) {
+				return -ENOENT;
+			}
+			*value = v.value;
+			return 0;
+		}
+	}
+
+	return -EAGAIN;
+}
+
+int metrics_shm_snapshot(const struct metrics_shm *shm,
+		struct metrics_shm_value *buf, size_t n)
+{
+	const struct metrics_shm_header *header = get_header(shm);
+
+	if (n < header->nr_keys) {
+		return -ENOBUFS;
+	}
+
+	for (int i = 0; i < METRICS_SHM_READ_RETRY; i++) {
+		const uint32_t seq = read_begin(header);
+
+		for (uint16_t key = 0; key < header->nr_keys; key++) {
+			copy_entry(shm, key, &buf[key]);
+		}
+
+		if (!read_retry(header, seq)) {
+			return (int)header->nr_keys;
+		}
+	}
+
+	return -EAGAIN;
+}
+
+size_t metrics_shm_count(const struct metrics_shm *shm)
+{
+	return get_header(shm)->nr_keys;
+}
+
+const char *metrics_shm_key_string(const struct metrics_shm *shm, uint16_t key)
+{
+	const struct metrics_shm_header *header = get_header(shm);
+	const char *p = (const char *)&shm->base[header->key_strings_offset];
+
+	if (key >= header->nr_keys) {
+		return "";
+	}
+
+	return &p[(size_t)key * header->key_string_size];
+}
+
+int metrics_shm_open(struct metrics_shm *shm, const char *name)
+{
+	struct stat st;
+	const int fd = shm_open(name, O_RDONLY, 0);
+
+	if (fd < 0) {
+		return -errno;
+	}
+
+	if (fstat(fd, &st) != 0) {
+		const int err = -errno;
+		close(fd);
+		return err;
+	} else if ((size_t)st.st_size < sizeof(struct metrics_shm_header)) {
+		close(fd);
+		return -EPROTO;
+	}
+
+	void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	const int err = -errno;
+
+	close(fd);
+
+	if (p == MAP_FAILED) {
+		return err;
+	}
+
+	shm->base = (const uint8_t *)p;
+	shm->size = (size_t)st.st_size;
+
+	if (!is_layout_valid(get_header(shm), shm->size)) {
+		metrics_shm_close(shm);
+		return -EPROTO;
+	}
+
+	return 0;
+}
+
+void metrics_shm_close(struct metrics_shm *shm)
+{
+	if (shm->base) {
+		munmap((void *)(uintptr_t)shm->base, shm->size);
+	}
+
+	shm->base = NULL;
+	shm->size = 0;
+}
+
+int metrics_shm_unlink(const char *name)
+{
+	return shm_unlink(name) == 0? 0 : -errno;
+}
@@ -0,0 +1,370 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* Producers reserve space by advancing `reserve` and then publish in the
+ * order of reservation by advancing `head`, which the consumer waits on as a
+ * futex word. */
+
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "libmcu/msgq_shared.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#define QUEUE_MAGIC			0x4d534751U /* "MSGQ" */
+#define QUEUE_VERSION			1U
+#define CACHE_LINE			64
+#define SPIN_COUNT			128
+
+struct queue {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t capacity;
+	uint32_t meta_size;
+
+	/* written by the producers */
+	uint32_t reserve __attribute__((aligned(CACHE_LINE)));
+	uint32_t head __attribute__((aligned(CACHE_LINE)));
+
+	/* written by the consumer */
+	uint32_t tail __attribute__((aligned(CACHE_LINE)));
+	uint32_t waiting;
+
+	uint8_t data[] __attribute__((aligned(CACHE_LINE)));
+};
+
+struct msgq_shared {
+	struct queue *queue;
+	size_t capacity;
+};
+
+static void futex_wait(uint32_t *addr, uint32_t val,
+		const struct timespec *timeout)
+{
+	syscall(SYS_futex, addr, FUTEX_WAIT, val, timeout, NULL, 0);
+}
+
+static void futex_wake(uint32_t *addr)
+{
+	syscall(SYS_futex, addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+static int64_t get_time_ms(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static void sleep_ms(long ms)
+{
+	const struct timespec ts = {
+		.tv_sec = ms / 1000,
+		.tv_nsec = (ms % 1000) * 1000000L,
+	};
+	nanosleep(&ts, NULL);
+}
+
+static void copy_in(struct queue *q, uint32_t offset,
+		const void *data, size_t size)
+{
+	const uint32_t pos = offset & (q->capacity - 1);
+	const size_t contiguous = q->capacity - pos;
+	const size_t cut = size < contiguous? size : contiguous;
+
+	memcpy(&q->data[pos], data, cut);
+	memcpy(q->data, (const uint8_t *)data + cut, size - cut);
+}
+
+static void copy_out(const struct queue *q, uint32_t offset,
+		void *buf, size_t size)
+{
+	const uint32_t pos = offset & (q->capacity - 1);
+	const size_t contiguous = q->capacity - pos;
+	const size_t cut = size < contiguous? size : contiguous;
+
+	memcpy(buf, &q->data[pos], cut);
+	memcpy((uint8_t *)buf + cut, q->data, size - cut);
+}
+
+static uint32_t get_head(const struct queue *q)
+{
+	return __atomic_load_n(&q->head, __ATOMIC_ACQUIRE);
+}
+
+static bool wait_for_creator(int fd, size_t size)
+{
+	struct stat st;
+
+	for (int i = 0; i < MSGQ_SHARED_OPEN_TIMEOUT_MS; i++) {
+		if (fstat(fd, &st) != 0) {
+			return false;
+		} else if ((size_t)st.st_size >= size) {
+			return true;
+		}
+		sleep_ms(1);
+	}
+
+	return false;
+}
+
+static bool wait_for_queue(const struct queue *q, size_t capacity)
+{
+	for (int i = 0; i < MSGQ_SHARED_OPEN_TIMEOUT_MS; i++) {
+		if (__atomic_load_n(&q->magic, __ATOMIC_ACQUIRE)
+				== QUEUE_MAGIC) {
+			return q->version == QUEUE_VERSION &&
+				q->capacity == capacity &&
+				q->meta_size == sizeof(msgq_msg_meta_t);
+		}
+		sleep_ms(1);
+	}
+
+	return false;
+}
+
+static struct queue *open_queue(const char *name, size_t capacity)
+{
+	const size_t size = sizeof(struct queue) + capacity;
+	bool created = true;
+	int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+
+	if (fd < 0 && errno == EEXIST) {
+		created = false;
+		fd = shm_open(name, O_RDWR, 0);
+	}
+	if (fd < 0) {
+		return NULL;
+	}
+
+	void *p = MAP_FAILED;
+
+	if ((created && ftruncate(fd, (off_t)size) == 0) ||
+			(!created && wait_for_creator(fd, size))) {
+		p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	}
+
+	close(fd);
+
+	if (p == MAP_FAILED) {
+		return NULL;
+	}
+
+	struct queue *q = (struct queue *)p;
+
+	if (created) {
+		q->version = QUEUE_VERSION;
+		q->capacity = (uint32_t)capacity;
+		q->meta_size = sizeof(msgq_msg_meta_t);
+		q->reserve = q->head = q->tail = q->waiting = 0;
+		__atomic_store_n(&q->magic, QUEUE_MAGIC, __ATOMIC_RELEASE);
+	} else if (!wait_for_queue(q, capacity)) {
+		munmap(p, size);
+		return NULL;
+	}
+
+	return q;
+}
+
+static bool reserve(struct queue *q, uint32_t size, uint32_t *start)
+{
+	uint32_t offset = __atomic_load_n(&q->reserve, __ATOMIC_RELAXED);
+
+	do {
+		const uint32_t tail = __atomic_load_n(&q->tail,
+				__ATOMIC_ACQUIRE);
+		if (q->capacity - (offset - tail) < size) {
+			return false;
+		}
+	} while (!__atomic_compare_exchange_n(&q->reserve, &offset,
+			offset + size, true,
+			__ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+	*start = offset;
+	return true;
+}
+
+static void commit(struct queue *q, uint32_t start, uint32_t size)
+{
+	/* wait for the producers reserved earlier to publish theirs */
+	for (int i = 0; get_head(q) != start; i++) {
+		if (i >= SPIN_COUNT) {
+			sched_yield();
+		}
+	}
+
+	__atomic_store_n(&q->head, start + size, __ATOMIC_SEQ_CST);
+
+	/* cleared here so that only the first push after the consumer went to
+	 * sleep pays for the syscall */
+	if (__atomic_load_n(&q->waiting, __ATOMIC_SEQ_CST) &&
+			__atomic_exchange_n(&q->waiting, 0, __ATOMIC_SEQ_CST)) {
+		futex_wake(&q->head);
+	}
+}
+
+int msgq_push_shared(struct msgq_shared *q,
+		const void *data, const size_t datasize)
+{
+	const msgq_msg_meta_t meta = {
+		.size = datasize,
+	};
+	uint32_t start;
+
+	if (datasize > q->capacity - sizeof(meta) ||
+			!reserve(q->queue, (uint32_t)(sizeof(meta) + datasize),
+					&start)) {
+		return -ENOMEM;
+	}
+
+	copy_in(q->queue, start, &meta, sizeof(meta));
+	copy_in(q->queue, start + (uint32_t)sizeof(meta), data, datasize);
+
+	commit(q->queue, start, (uint32_t)(sizeof(meta) + datasize));
+
+	return 0;
+}
+
+static bool wait_for_message(struct queue *q, int timeout_ms)
+{
+	const int64_t deadline = get_time_ms() + timeout_ms;
+
+	/* spin a while first as a futex round trip costs a few microseconds,
+	 * far more than a message takes at high rates */
+	for (int i = 0; i < SPIN_COUNT && get_head(q) == q->tail; i++) {
+		sched_yield();
+	}
+
+	while (get_head(q) == q->tail) {
+		struct timespec ts;
+		const struct timespec *timeout = NULL;
+
+		if (timeout_ms >= 0) {
+			const int64_t left = deadline - get_time_ms();
+			if (left <= 0) {
+				return false;
+			}
+			ts.tv_sec = (time_t)(left / 1000);
+			ts.tv_nsec = (long)(left % 1000) * 1000000L;
+			timeout = &ts;
+		}
+
+		__atomic_store_n(&q->waiting, 1, __ATOMIC_SEQ_CST);
+		const uint32_t head = __atomic_load_n(&q->head,
+				__ATOMIC_SEQ_CST);
+		if (head == q->tail) {
+			futex_wait(&q->head, head, timeout);
+		}
+	}
+
+	return true;
+}
+
+int msgq_pop_shared(struct msgq_shared *q, void *buf, size_t bufsize,
+		int timeout_ms)
+{
+	struct queue *queue = q->queue;
+	msgq_msg_meta_t meta;
+
+	if (get_head(queue) == queue->tail) {
+		if (timeout_ms == 0) {
+			return -ENOENT;
+		} else if (!wait_for_message(queue, timeout_ms)) {
+			return -ETIMEDOUT;
+		}
+	}
+
+	copy_out(queue, queue->tail, &meta, sizeof(meta));
+
+	if (meta.size > bufsize) {
+		return -ERANGE;
+	}
+
+	copy_out(queue, queue->tail + (uint32_t)sizeof(meta), buf, meta.size);
+
+	__atomic_store_n(&queue->tail,
+			queue->tail + (uint32_t)(sizeof(meta) + meta.size),
+			__ATOMIC_RELEASE);
+
+	return (int)meta.size;
+}
+
+size_t msgq_next_msg_size_shared(const struct msgq_shared *q)
+{
+	msgq_msg_meta_t meta;
+
+	if (get_head(q->queue) == q->queue->tail) {
+		return 0;
+	}
+
+	copy_out(q->queue, q->queue->tail, &meta, sizeof(meta));
+
+	return meta.size;
+}
+
+size_t msgq_len_shared(const struct msgq_shared *q)
+{
+	return get_head(q->queue) -
+		__atomic_load_n(&q->queue->tail, __ATOMIC_ACQUIRE);
+}
+
+size_t msgq_cap_shared(const struct msgq_shared *q)
+{
+	return q->capacity;
+}
+
+struct msgq_shared *msgq_create_shared(const char *name,
+		const size_t capacity_bytes)
+{
+	if (name == NULL || capacity_bytes <= sizeof(msgq_msg_meta_t) ||
+			capacity_bytes > UINT32_MAX / 2 ||
+			(capacity_bytes & (capacity_bytes - 1)) != 0) {
+		return NULL;
+	}
+
+	struct msgq_shared *q = (struct msgq_shared *)malloc(sizeof(*q));
+
+	if (q == NULL) {
+		return NULL;
+	}
+
+	if ((q->queue = open_queue(name, capacity_bytes)) == NULL) {
+		free(q);
+		return NULL;
+	}
+
+	q->capacity = capacity_bytes;
+
+	return q;
+}
+
+void msgq_destroy_shared(struct msgq_shared *q)
+{
+	if (q) {
+		munmap(q->queue, sizeof(*q->queue) + q->capacity);
+		free(q);
+	}
+}
+
+int msgq_unlink_shared(const char *name)
+{
+	return shm_unlink(name) == 0? 0 : -errno;
+}
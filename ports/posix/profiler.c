@@ -0,0 +1,556 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* The signal handler is the only producer of its thread's ring buffer and
+ * touches nothing else but the ring, so no lock is taken in signal context.
+ * Everything else runs under the lock. */
+
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "libmcu/profiler.h"
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include "libmcu/compiler.h"
+#include "libmcu/trace.h"
+
+#if !defined(sigev_notify_thread_id)
+#define sigev_notify_thread_id		_sigev_un._tid
+#endif
+
+#define THREAD_NAME_MAXLEN		16
+#define LINE_MAXLEN			(PROFILER_MAX_DEPTH * 64 + 64)
+
+static_assert((PROFILER_BUFFER_LEN & (PROFILER_BUFFER_LEN - 1)) == 0,
+		"PROFILER_BUFFER_LEN must be a power of 2");
+static_assert((PROFILER_MAX_STACKS & (PROFILER_MAX_STACKS - 1)) == 0,
+		"PROFILER_MAX_STACKS must be a power of 2");
+
+struct sample {
+	uint8_t depth;
+	uintptr_t pc[PROFILER_MAX_DEPTH];
+};
+
+struct thread_slot {
+	bool used;
+	timer_t timer;
+	void *thread;
+	char name[THREAD_NAME_MAXLEN];
+
+	uintptr_t stack_lo;
+	uintptr_t stack_hi;
+
+	uint32_t head; /* written by the signal handler */
+	uint32_t tail; /* written by the collector */
+	uint32_t dropped;
+	struct sample samples[PROFILER_BUFFER_LEN];
+};
+
+struct entry {
+	bool used;
+	char name[THREAD_NAME_MAXLEN];
+	struct profiler_stack stack;
+};
+
+static struct {
+	pthread_mutex_t lock;
+
+	struct thread_slot threads[PROFILER_MAX_THREADS];
+	struct entry table[PROFILER_MAX_STACKS];
+	uint32_t dropped;
+
+	unsigned int hz;
+	bool running;
+	bool handler_installed;
+} m = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static __thread struct thread_slot *current;
+
+static bool is_frame(const struct thread_slot *slot, uintptr_t fp)
+{
+	return fp >= slot->stack_lo && fp < slot->stack_hi &&
+		slot->stack_hi - fp >= 2 * sizeof(uintptr_t) &&
+		(fp & (sizeof(uintptr_t) - 1)) == 0;
+}
+
+static uint8_t unwind(const ucontext_t *uc, const struct thread_slot *slot,
+		uintptr_t *pc)
+{
+	uintptr_t ip;
+	uintptr_t fp;
+	uint8_t depth = 0;
+
+#if defined(__x86_64__)
+	ip = (uintptr_t)uc->uc_mcontext.gregs[REG_RIP];
+	fp = (uintptr_t)uc->uc_mcontext.gregs[REG_RBP];
+#elif defined(__aarch64__)
+	ip = (uintptr_t)uc->uc_mcontext.pc;
+	fp = (uintptr_t)uc->uc_mcontext.regs[29];
+#else
+	(void)uc;
+	(void)slot;
+	(void)pc;
+	return 0;
+#endif
+
+	pc[depth++] = ip;
+
+	/* both have the previous frame pointer and the return address at the
+	 * bottom of a frame */
+	while (depth < PROFILER_MAX_DEPTH && is_frame(slot, fp)) {
+		const uintptr_t *frame = (const uintptr_t *)fp;
+		const uintptr_t next = frame[0];
+
+		if (frame[1] == 0) {
+			break;
+		}
+
+		pc[depth++] = frame[1];
+
+		if (next <= fp) { /* the stack grows down */
+			break;
+		}
+
+		fp = next;
+	}
+
+	return depth;
+}
+
+static void on_sigprof(int signo, siginfo_t *info, void *ucontext)
+{
+	struct thread_slot *slot = current;
+
+	(void)signo;
+	(void)info;
+
+	if (!slot) {
+		return;
+	}
+
+	const uint32_t head = __atomic_load_n(&slot->head, __ATOMIC_RELAXED);
+	const uint32_t tail = __atomic_load_n(&slot->tail, __ATOMIC_ACQUIRE);
+
+	if (head - tail >= PROFILER_BUFFER_LEN) {
+		__atomic_fetch_add(&slot->dropped, 1, __ATOMIC_RELAXED);
+		return;
+	}
+
+	struct sample *sample = &slot->samples[head & (PROFILER_BUFFER_LEN - 1)];
+	sample->depth = unwind((const ucontext_t *)ucontext, slot, sample->pc);
+
+	__atomic_store_n(&slot->head, head + 1, __ATOMIC_RELEASE);
+}
+
+static uint32_t hash_sample(const struct thread_slot *slot,
+		const struct sample *sample)
+{
+	uint32_t hash = 2166136261U; /* FNV-1a */
+	const uint8_t *p = (const uint8_t *)sample->pc;
+	const size_t len = sample->depth * sizeof(sample->pc[0]);
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ p[i]) * 16777619U;
+	}
+
+	return hash ^ (uint32_t)(uintptr_t)slot->thread;
+}
+
+static bool is_same(const struct entry *entry, const struct thread_slot *slot,
+		const struct sample *sample)
+{
+	return entry->stack.thread == slot->thread &&
+		entry->stack.depth == sample->depth &&
+		strcmp(entry->name, slot->name) == 0 &&
+		memcmp(entry->stack.pc, sample->pc,
+				sample->depth * sizeof(sample->pc[0])) == 0;
+}
+
+static void add_sample(const struct thread_slot *slot,
+		const struct sample *sample)
+{
+	uint32_t index = hash_sample(slot, sample);
+
+	for (uint32_t i = 0; i < PROFILER_MAX_STACKS; i++, index++) {
+		struct entry *entry = &m.table[index & (PROFILER_MAX_STACKS - 1)];
+
+		if (!entry->used) {
+			entry->used = true;
+			memcpy(entry->name, slot->name, sizeof(entry->name));
+			entry->stack = (struct profiler_stack) {
+				.thread_name = entry->name,
+				.thread = slot->thread,
+				.count = 1,
+				.depth = sample->depth,
+			};
+			memcpy(entry->stack.pc, sample->pc,
+					sample->depth * sizeof(sample->pc[0]));
+			return;
+		} else if (is_same(entry, slot, sample)) {
+			entry->stack.count++;
+			return;
+		}
+	}
+
+	m.dropped++;
+}
+
+static void collect_slot(struct thread_slot *slot)
+{
+	const uint32_t head = __atomic_load_n(&slot->head, __ATOMIC_ACQUIRE);
+	uint32_t tail = slot->tail;
+
+	for (; tail != head; tail++) {
+		add_sample(slot,
+			&slot->samples[tail & (PROFILER_BUFFER_LEN - 1)]);
+	}
+
+	__atomic_store_n(&slot->tail, tail, __ATOMIC_RELEASE);
+}
+
+static void collect(void)
+{
+	for (unsigned int i = 0; i < PROFILER_MAX_THREADS; i++) {
+		if (m.threads[i].used) {
+			collect_slot(&m.threads[i]);
+		}
+	}
+}
+
+static int arm(struct thread_slot *slot, unsigned int hz)
+{
+	const long period_ns = hz? 1000000000L / (long)hz : 0;
+	const struct timespec period = {
+		.tv_sec = period_ns / 1000000000L,
+		.tv_nsec = period_ns % 1000000000L,
+	};
+	const struct itimerspec its = {
+		.it_interval = period,
+		.it_value = period,
+	};
+
+	return timer_settime(slot->timer, 0, &its, NULL) == 0? 0 : -errno;
+}
+
+static int install_handler(void)
+{
+	struct sigaction sa = {
+		.sa_sigaction = on_sigprof,
+		.sa_flags = SA_SIGINFO | SA_RESTART,
+	};
+
+	if (m.handler_installed) {
+		return 0;
+	}
+
+	sigemptyset(&sa.sa_mask);
+
+	if (sigaction(SIGPROF, &sa, NULL) != 0) {
+		return -errno;
+	}
+
+	m.handler_installed = true;
+
+	return 0;
+}
+
+static void get_stack(struct thread_slot *slot)
+{
+	pthread_attr_t attr;
+	void *addr;
+	size_t size;
+
+	slot->stack_lo = slot->stack_hi = 0;
+
+	if (pthread_getattr_np(pthread_self(), &attr) != 0) {
+		return;
+	}
+
+	if (pthread_attr_getstack(&attr, &addr, &size) == 0) {
+		slot->stack_lo = (uintptr_t)addr;
+		slot->stack_hi = (uintptr_t)addr + size;
+	}
+
+	pthread_attr_destroy(&attr);
+}
+
+static struct thread_slot *alloc_slot(void)
+{
+	for (unsigned int i = 0; i < PROFILER_MAX_THREADS; i++) {
+		if (!m.threads[i].used) {
+			return &m.threads[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int create_timer(struct thread_slot *slot)
+{
+	struct sigevent sev = {
+		.sigev_notify = SIGEV_THREAD_ID,
+		.sigev_signo = SIGPROF,
+	};
+	clockid_t clock;
+	int err;
+
+	sev.sigev_notify_thread_id = (pid_t)syscall(SYS_gettid);
+
+	if ((err = pthread_getcpuclockid(pthread_self(), &clock)) != 0) {
+		return -err;
+	}
+
+	return timer_create(clock, &sev, &slot->timer) == 0? 0 : -errno;
+}
+
+int profiler_register_thread(void)
+{
+	struct thread_slot *slot;
+	int err = 0;
+
+	if (current) {
+		return -EALREADY;
+	}
+
+	pthread_mutex_lock(&m.lock);
+
+	if ((slot = alloc_slot()) == NULL) {
+		err = -ENOSPC;
+		goto out;
+	}
+
+	if ((err = create_timer(slot)) != 0) {
+		goto out;
+	}
+
+	slot->thread = trace_get_current_thread();
+	if (pthread_getname_np(pthread_self(),
+			slot->name, sizeof(slot->name)) != 0 || !slot->name[0]) {
+		snprintf(slot->name, sizeof(slot->name), "%p", slot->thread);
+	}
+	get_stack(slot);
+	slot->head = slot->tail = 0;
+	slot->used = true;
+
+	current = slot;
+
+	if (m.running) {
+		err = arm(slot, m.hz);
+	}
+out:
+	pthread_mutex_unlock(&m.lock);
+
+	return err;
+}
+
+int profiler_unregister_thread(void)
+{
+	struct thread_slot *slot = current;
+
+	if (!slot) {
+		return -ENOENT;
+	}
+
+	pthread_mutex_lock(&m.lock);
+
+	arm(slot, 0);
+	current = NULL;
+	collect_slot(slot);
+	timer_delete(slot->timer);
+	slot->used = false;
+
+	pthread_mutex_unlock(&m.lock);
+
+	return 0;
+}
+
+int profiler_start(unsigned int hz)
+{
+	int err = 0;
+
+	if (hz == 0) {
+		hz = PROFILER_DEFAULT_HZ;
+	} else if (hz > 1000000) {
+		return -EINVAL;
+	}
+
+	pthread_mutex_lock(&m.lock);
+
+	if (m.running) {
+		err = -EALREADY;
+		goto out;
+	}
+
+	if ((err = install_handler()) != 0) {
+		goto out;
+	}
+
+	for (unsigned int i = 0; i < PROFILER_MAX_THREADS && !err; i++) {
+		if (m.threads[i].used) {
+			err = arm(&m.threads[i], hz);
+		}
+	}
+
+	if (err) {
+		for (unsigned int i = 0; i < PROFILER_MAX_THREADS; i++) {
+			if (m.threads[i].used) {
+				arm(&m.threads[i], 0);
+			}
+		}
+		goto out;
+	}
+
+	m.hz = hz;
+	m.running = true;
+out:
+	pthread_mutex_unlock(&m.lock);
+
+	return err;
+}
+
+void profiler_stop(void)
+{
+	pthread_mutex_lock(&m.lock);
+
+	for (unsigned int i = 0; i < PROFILER_MAX_THREADS; i++) {
+		if (m.threads[i].used) {
+			arm(&m.threads[i], 0);
+		}
+	}
+
+	m.running = false;
+	collect();
+
+	pthread_mutex_unlock(&m.lock);
+}
+
+void profiler_collect(void)
+{
+	pthread_mutex_lock(&m.lock);
+	collect();
+	pthread_mutex_unlock(&m.lock);
+}
+
+void profiler_reset(void)
+{
+	pthread_mutex_lock(&m.lock);
+
+	collect();
+	memset(m.table, 0, sizeof(m.table));
+	m.dropped = 0;
+
+	for (unsigned int i = 0; i < PROFILER_MAX_THREADS; i++) {
+		__atomic_store_n(&m.threads[i].dropped, 0, __ATOMIC_RELAXED);
+	}
+
+	pthread_mutex_unlock(&m.lock);
+}
+
+uint32_t profiler_dropped(void)
+{
+	pthread_mutex_lock(&m.lock);
+
+	uint32_t dropped = m.dropped;
+
+	for (unsigned int i = 0; i < PROFILER_MAX_THREADS; i++) {
+		dropped += __atomic_load_n(&m.threads[i].dropped,
+				__ATOMIC_RELAXED);
+	}
+
+	pthread_mutex_unlock(&m.lock);
+
+	return dropped;
+}
+
+void profiler_iterate(profiler_iterate_cb_t cb, void *ctx)
+{
+	pthread_mutex_lock(&m.lock);
+
+	for (unsigned int i = 0; i < PROFILER_MAX_STACKS; i++) {
+		if (m.table[i].used) {
+			(*cb)(&m.table[i].stack, ctx);
+		}
+	}
+
+	pthread_mutex_unlock(&m.lock);
+}
+
+static int print_frame(char *buf, size_t bufsize, uintptr_t pc)
+{
+	Dl_info info;
+
+	if (dladdr((void *)pc, &info) == 0) {
+		return snprintf(buf, bufsize, ";0x%lx", (unsigned long)pc);
+	} else if (info.dli_sname) {
+		return snprintf(buf, bufsize, ";%s", info.dli_sname);
+	} else if (info.dli_fname) {
+		const char *base = strrchr(info.dli_fname, '/');
+		return snprintf(buf, bufsize, ";%s+0x%lx",
+				base? base + 1 : info.dli_fname,
+				(unsigned long)(pc - (uintptr_t)info.dli_fbase));
+	}
+
+	return snprintf(buf, bufsize, ";0x%lx", (unsigned long)pc);
+}
+
+static size_t format_stack(char *buf, size_t bufsize,
+		const struct profiler_stack *stack)
+{
+	size_t len = (size_t)snprintf(buf, bufsize, "%s", stack->thread_name);
+
+	for (unsigned int i = stack->depth; i > 0 && len < bufsize; i--) {
+		/* return addresses point to the instruction after the call,
+		 * which may belong to the next function already */
+		const uintptr_t pc = stack->pc[i - 1] - (i > 1? 1 : 0);
+		const int n = print_frame(&buf[len], bufsize - len, pc);
+
+		if (n > 0) {
+			len += (size_t)n;
+		}
+	}
+
+	if (len < bufsize) {
+		const int n = snprintf(&buf[len], bufsize - len, " %u\n",
+				(unsigned int)stack->count);
+		len += n > 0? (size_t)n : 0;
+	}
+
+	return len < bufsize? len : bufsize - 1;
+}
+
+int profiler_export_folded(profiler_writer_t writer, void *ctx)
+{
+	static char buf[LINE_MAXLEN]; /* used under the lock */
+	int err = 0;
+
+	pthread_mutex_lock(&m.lock);
+
+	for (unsigned int i = 0; i < PROFILER_MAX_STACKS && err >= 0; i++) {
+		if (m.table[i].used) {
+			const size_t len = format_stack(buf, sizeof(buf),
+					&m.table[i].stack);
+			err = (*writer)(buf, len, ctx);
+		}
+	}
+
+	pthread_mutex_unlock(&m.lock);
+
+	return err < 0? err : 0;
+}
@@ -0,0 +1,382 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* Each ring is a byte ring of variable length records. A record never wraps
+ * around the end of the ring, leaving a padding record instead, so that the
+ * consumer can hand the topic and the message over to pubsub_publish() in
+ * place. */
+
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "libmcu/pubsub_shm.h"
+#include "libmcu/pubsub.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#define RING_MAGIC			0x50535242U /* "PSRB" */
+#define RING_VERSION			1U
+#define RECORD_ALIGN			16U
+#define CACHE_LINE			64
+
+struct ring {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t capacity;
+
+	/* written by the producer */
+	uint32_t head __attribute__((aligned(CACHE_LINE)));
+	uint32_t seq; /* futex word bumped on every record */
+
+	/* written by the consumer */
+	uint32_t tail __attribute__((aligned(CACHE_LINE)));
+	uint32_t waiters;
+
+	uint8_t data[] __attribute__((aligned(CACHE_LINE)));
+};
+
+/* topic_len is 0 for a padding record */
+struct record {
+	uint32_t size;
+	uint32_t topic_len;
+	uint32_t msglen;
+	uint32_t reserved;
+};
+
+struct pubsub_shm {
+	struct ring *tx;
+	struct ring *rx;
+	size_t capacity;
+
+	pthread_mutex_t tx_lock;
+	size_t dropped;
+
+	/* not to forward back what is being published from the rx ring */
+	pthread_t rx_thread;
+	bool dispatching;
+
+	pubsub_subscribe_static_t subs[PUBSUB_SHM_MAX_FILTERS];
+	size_t nr_subs;
+};
+
+static uint32_t align_record(size_t size)
+{
+	const size_t mask = RECORD_ALIGN - 1;
+	return (uint32_t)((size + mask) & ~mask);
+}
+
+static void futex_wait(uint32_t *addr, uint32_t val, int timeout_ms)
+{
+	struct timespec ts = {
+		.tv_sec = timeout_ms / 1000,
+		.tv_nsec = (long)(timeout_ms % 1000) * 1000000L,
+	};
+
+	syscall(SYS_futex, addr, FUTEX_WAIT, val,
+			timeout_ms < 0? NULL : &ts, NULL, 0);
+}
+
+static void futex_wake(uint32_t *addr)
+{
+	syscall(SYS_futex, addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+static void sleep_ms(long ms)
+{
+	const struct timespec ts = {
+		.tv_sec = ms / 1000,
+		.tv_nsec = (ms % 1000) * 1000000L,
+	};
+	nanosleep(&ts, NULL);
+}
+
+static bool wait_for_peer(int fd, size_t size)
+{
+	struct stat st;
+
+	for (int i = 0; i < PUBSUB_SHM_OPEN_TIMEOUT_MS; i++) {
+		if (fstat(fd, &st) != 0) {
+			return false;
+		} else if ((size_t)st.st_size >= size) {
+			return true;
+		}
+		sleep_ms(1);
+	}
+
+	return false;
+}
+
+static bool wait_for_ring(const struct ring *ring, size_t capacity)
+{
+	for (int i = 0; i < PUBSUB_SHM_OPEN_TIMEOUT_MS; i++) {
+		if (__atomic_load_n(&ring->magic, __ATOMIC_ACQUIRE)
+				== RING_MAGIC) {
+			return ring->version == RING_VERSION &&
+				ring->capacity == capacity;
+		}
+		sleep_ms(1);
+	}
+
+	return false;
+}
+
+static struct ring *open_ring(const char *name, size_t capacity)
+{
+	const size_t size = sizeof(struct ring) + capacity;
+	bool created = true;
+	int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+
+	if (fd < 0 && errno == EEXIST) {
+		created = false;
+		fd = shm_open(name, O_RDWR, 0);
+	}
+	if (fd < 0) {
+		return NULL;
+	}
+
+	void *p = MAP_FAILED;
+
+	if ((created && ftruncate(fd, (off_t)size) == 0) ||
+			(!created && wait_for_peer(fd, size))) {
+		p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	}
+
+	close(fd);
+
+	if (p == MAP_FAILED) {
+		return NULL;
+	}
+
+	struct ring *ring = (struct ring *)p;
+
+	if (created) {
+		ring->version = RING_VERSION;
+		ring->capacity = (uint32_t)capacity;
+		ring->head = ring->tail = ring->seq = ring->waiters = 0;
+		__atomic_store_n(&ring->magic, RING_MAGIC, __ATOMIC_RELEASE);
+	} else if (!wait_for_ring(ring, capacity)) {
+		munmap(p, size);
+		return NULL;
+	}
+
+	return ring;
+}
+
+static void close_ring(struct ring *ring, size_t capacity)
+{
+	if (ring) {
+		munmap(ring, sizeof(*ring) + capacity);
+	}
+}
+
+static bool write_record(struct ring *ring, const char *topic,
+		const void *msg, size_t msglen)
+{
+	const size_t topic_len = strlen(topic) + 1;
+	const uint32_t payload_offset =
+		align_record(sizeof(struct record) + topic_len);
+	const uint64_t needed = (uint64_t)payload_offset + msglen;
+
+	if (needed > ring->capacity / 2) {
+		return false;
+	}
+
+	const uint32_t size = align_record((size_t)needed);
+	const uint32_t head = ring->head;
+	const uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+	const uint32_t pos = head & (ring->capacity - 1);
+	const uint32_t contiguous = ring->capacity - pos;
+	const uint32_t padding = contiguous < size? contiguous : 0;
+
+	if (ring->capacity - (head - tail) < padding + size) {
+		return false;
+	}
+
+	if (padding) {
+		const struct record pad = { .size = padding, };
+		memcpy(&ring->data[pos], &pad, sizeof(pad));
+	}
+
+	uint8_t *p = &ring->data[padding? 0 : pos];
+	const struct record rec = {
+		.size = size,
+		.topic_len = (uint32_t)topic_len,
+		.msglen = (uint32_t)msglen,
+	};
+
+	memcpy(p, &rec, sizeof(rec));
+	memcpy(&p[sizeof(rec)], topic, topic_len);
+	if (msglen) {
+		memcpy(&p[payload_offset], msg, msglen);
+	}
+
+	__atomic_store_n(&ring->head, head + padding + size, __ATOMIC_SEQ_CST);
+	__atomic_add_fetch(&ring->seq, 1, __ATOMIC_SEQ_CST);
+
+	if (__atomic_load_n(&ring->waiters, __ATOMIC_SEQ_CST)) {
+		futex_wake(&ring->seq);
+	}
+
+	return true;
+}
+
+static bool is_ring_empty(const struct ring *ring)
+{
+	return __atomic_load_n(&ring->head, __ATOMIC_SEQ_CST) == ring->tail;
+}
+
+static int dispatch(struct pubsub_shm *bridge)
+{
+	struct ring *ring = bridge->rx;
+	const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+	uint32_t tail = ring->tail;
+	int count = 0;
+
+	bridge->rx_thread = pthread_self();
+	__atomic_store_n(&bridge->dispatching, true, __ATOMIC_RELEASE);
+
+	while (tail != head) {
+		const uint8_t *p = &ring->data[tail & (ring->capacity - 1)];
+		struct record rec;
+
+		memcpy(&rec, p, sizeof(rec));
+
+		if (rec.topic_len) {
+			pubsub_publish((const char *)&p[sizeof(rec)],
+					&p[align_record(sizeof(rec) +
+							rec.topic_len)],
+					rec.msglen);
+			count++;
+		}
+
+		/* released only after publishing as the message is in use */
+		tail += rec.size;
+		__atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+	}
+
+	__atomic_store_n(&bridge->dispatching, false, __ATOMIC_RELEASE);
+
+	return count;
+}
+
+static void forward(void *context, const void *msg, size_t msglen)
+{
+	struct pubsub_shm *bridge = (struct pubsub_shm *)context;
+
+	if (__atomic_load_n(&bridge->dispatching, __ATOMIC_ACQUIRE) &&
+			pthread_equal(bridge->rx_thread, pthread_self())) {
+		return;
+	}
+
+	pthread_mutex_lock(&bridge->tx_lock);
+	if (!write_record(bridge->tx, pubsub_topic(), msg, msglen)) {
+		bridge->dropped++;
+	}
+	pthread_mutex_unlock(&bridge->tx_lock);
+}
+
+int pubsub_shm_forward(struct pubsub_shm *bridge, const char *topic_filter)
+{
+	if (bridge->nr_subs >= PUBSUB_SHM_MAX_FILTERS) {
+		return -ENOSPC;
+	}
+
+	if (pubsub_subscribe_static(&bridge->subs[bridge->nr_subs],
+			topic_filter, forward, bridge) == NULL) {
+		return -ENOMEM;
+	}
+
+	bridge->nr_subs++;
+
+	return 0;
+}
+
+int pubsub_shm_poll(struct pubsub_shm *bridge, int timeout_ms)
+{
+	struct ring *ring = bridge->rx;
+
+	if (is_ring_empty(ring) && timeout_ms != 0) {
+		__atomic_add_fetch(&ring->waiters, 1, __ATOMIC_SEQ_CST);
+		const uint32_t seq = __atomic_load_n(&ring->seq,
+				__ATOMIC_SEQ_CST);
+		if (is_ring_empty(ring)) {
+			futex_wait(&ring->seq, seq, timeout_ms);
+		}
+		__atomic_sub_fetch(&ring->waiters, 1, __ATOMIC_SEQ_CST);
+	}
+
+	return dispatch(bridge);
+}
+
+size_t pubsub_shm_dropped(const struct pubsub_shm *bridge)
+{
+	return bridge->dropped;
+}
+
+struct pubsub_shm *pubsub_shm_create(const char *tx_name, const char *rx_name,
+		size_t capacity)
+{
+	if (tx_name == NULL || rx_name == NULL || capacity < RECORD_ALIGN * 2 ||
+			capacity > UINT32_MAX / 2 ||
+			(capacity & (capacity - 1)) != 0) {
+		return NULL;
+	}
+
+	struct pubsub_shm *bridge = (struct pubsub_shm *)
+		calloc(1, sizeof(*bridge));
+
+	if (bridge == NULL) {
+		return NULL;
+	}
+
+	bridge->capacity = capacity;
+	bridge->tx = open_ring(tx_name, capacity);
+	bridge->rx = open_ring(rx_name, capacity);
+
+	if (bridge->tx == NULL || bridge->rx == NULL) {
+		pubsub_shm_delete(bridge);
+		return NULL;
+	}
+
+	pthread_mutex_init(&bridge->tx_lock, NULL);
+
+	return bridge;
+}
+
+void pubsub_shm_delete(struct pubsub_shm *bridge)
+{
+	if (bridge == NULL) {
+		return;
+	}
+
+	for (size_t i = 0; i < bridge->nr_subs; i++) {
+		pubsub_unsubscribe(&bridge->subs[i]);
+	}
+
+	close_ring(bridge->tx, bridge->capacity);
+	close_ring(bridge->rx, bridge->capacity);
+
+	free(bridge);
+}
+
+int pubsub_shm_unlink(const char *name)
+{
+	return shm_unlink(name) == 0? 0 : -errno;
+}
@@ -0,0 +1,298 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "libmcu/posix_sim.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "libmcu/board.h"
+#include "libmcu/deadline.h"
+
+#define NO_TIMEOUT			UINT64_MAX
+
+struct waiter {
+	struct waiter *next;
+	uint64_t wake_us;
+	const struct sim_event *ev;
+	bool wake_on_deadline;
+	bool runnable;
+	bool signaled;
+};
+
+static struct {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+
+	/* accessed atomically as the board time functions may get called
+	 * from the deadline sources while the lock is held */
+	uint64_t now_us;
+	uint64_t epoch;
+
+	unsigned int nr_threads;
+	unsigned int nr_idle;
+	struct waiter *waiters;
+} m = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.cond = PTHREAD_COND_INITIALIZER,
+};
+
+static __thread bool registered;
+
+static uint64_t get_now(void)
+{
+	return __atomic_load_n(&m.now_us, __ATOMIC_ACQUIRE);
+}
+
+static void set_now(uint64_t now_us)
+{
+	__atomic_store_n(&m.now_us, now_us, __ATOMIC_RELEASE);
+}
+
+static uint64_t add_ms(uint64_t base_us, uint32_t ms)
+{
+	return ms == UINT32_MAX? NO_TIMEOUT : base_us + (uint64_t)ms * 1000;
+}
+
+static void wake(struct waiter *w)
+{
+	w->runnable = true;
+	m.nr_idle--;
+}
+
+static uint64_t get_earliest_wake(void)
+{
+	uint64_t earliest = NO_TIMEOUT;
+
+	for (struct waiter *w = m.waiters; w; w = w->next) {
+		if (!w->runnable && w->wake_us < earliest) {
+			earliest = w->wake_us;
+		}
+	}
+
+	return earliest;
+}
+
+static unsigned int wake_due(bool deadline_reached)
+{
+	const uint64_t now = get_now();
+	unsigned int woken = 0;
+
+	for (struct waiter *w = m.waiters; w; w = w->next) {
+		if (!w->runnable && (w->wake_us <= now ||
+				(deadline_reached && w->wake_on_deadline))) {
+			wake(w);
+			woken++;
+		}
+	}
+
+	return woken;
+}
+
+/* It should be called with the lock held. The clock moves only when every
+ * registered thread is idle, straight to the next deadline. */
+static void advance_if_all_idle(void)
+{
+	while (m.nr_threads && m.nr_idle == m.nr_threads) {
+		uint64_t next = get_earliest_wake();
+		const uint32_t deadline = deadline_next_ms();
+		bool deadline_reached = false;
+
+		if (deadline != DEADLINE_NONE) {
+			const uint64_t t = add_ms(get_now(), deadline);
+			if (t <= next) {
+				next = t;
+				deadline_reached = true;
+			}
+		}
+
+		if (next == NO_TIMEOUT) {
+			/* nothing to happen until signaled from outside */
+			break;
+		}
+
+		if (next > get_now()) {
+			set_now(next);
+		}
+
+		if (wake_due(deadline_reached) == 0) {
+			/* a deadline is due but nobody is there to process */
+			break;
+		}
+
+		pthread_cond_broadcast(&m.cond);
+	}
+}
+
+static void unlink_waiter(struct waiter *w)
+{
+	for (struct waiter **p = &m.waiters; *p; p = &(*p)->next) {
+		if (*p == w) {
+			*p = w->next;
+			break;
+		}
+	}
+}
+
+/* It should be called with the lock held. */
+static void wait_internal(struct waiter *w)
+{
+	w->next = m.waiters;
+	m.waiters = w;
+	m.nr_idle++;
+
+	advance_if_all_idle();
+
+	while (!w->runnable) {
+		pthread_cond_wait(&m.cond, &m.lock);
+	}
+
+	unlink_waiter(w);
+}
+
+int sim_sleep_ms(uint32_t ms)
+{
+	if (!registered) {
+		return -EPERM;
+	}
+
+	pthread_mutex_lock(&m.lock);
+	struct waiter w = { .wake_us = add_ms(get_now(), ms), };
+	wait_internal(&w);
+	pthread_mutex_unlock(&m.lock);
+
+	return 0;
+}
+
+int sim_advance(uint32_t max_ms)
+{
+	if (!registered) {
+		return -EPERM;
+	}
+
+	pthread_mutex_lock(&m.lock);
+	const uint64_t start = get_now();
+
+	if (deadline_next_ms() != 0) {
+		struct waiter w = {
+			.wake_us = add_ms(start, max_ms),
+			.wake_on_deadline = true,
+		};
+		wait_internal(&w);
+	}
+
+	const uint64_t elapsed_ms = (get_now() - start) / 1000;
+	pthread_mutex_unlock(&m.lock);
+
+	return elapsed_ms > INT32_MAX? INT32_MAX : (int)elapsed_ms;
+}
+
+int sim_event_wait(struct sim_event *ev, uint32_t timeout_ms)
+{
+	int err = 0;
+
+	if (!registered) {
+		return -EPERM;
+	}
+
+	pthread_mutex_lock(&m.lock);
+	if (!ev->signaled) {
+		struct waiter w = {
+			.wake_us = add_ms(get_now(), timeout_ms),
+			.ev = ev,
+		};
+		wait_internal(&w);
+		err = w.signaled? 0 : -ETIMEDOUT;
+	}
+	ev->signaled = false;
+	pthread_mutex_unlock(&m.lock);
+
+	return err;
+}
+
+void sim_event_signal(struct sim_event *ev)
+{
+	pthread_mutex_lock(&m.lock);
+	ev->signaled = true;
+
+	for (struct waiter *w = m.waiters; w; w = w->next) {
+		if (!w->runnable && w->ev == ev) {
+			w->signaled = true;
+			wake(w);
+		}
+	}
+
+	pthread_cond_broadcast(&m.cond);
+	pthread_mutex_unlock(&m.lock);
+}
+
+int sim_thread_register(void)
+{
+	if (registered) {
+		return -EALREADY;
+	}
+
+	pthread_mutex_lock(&m.lock);
+	m.nr_threads++;
+	registered = true;
+	pthread_mutex_unlock(&m.lock);
+
+	return 0;
+}
+
+int sim_thread_unregister(void)
+{
+	if (!registered) {
+		return -ENOENT;
+	}
+
+	pthread_mutex_lock(&m.lock);
+	m.nr_threads--;
+	registered = false;
+	/* the rest may have been waiting for this one to get idle */
+	advance_if_all_idle();
+	pthread_mutex_unlock(&m.lock);
+
+	return 0;
+}
+
+uint64_t sim_now_us(void)
+{
+	return get_now();
+}
+
+void sim_init(uint64_t epoch)
+{
+	pthread_mutex_lock(&m.lock);
+	set_now(0);
+	m.epoch = epoch;
+	m.nr_threads = 0;
+	m.nr_idle = 0;
+	m.waiters = NULL;
+	pthread_mutex_unlock(&m.lock);
+}
+
+unsigned long board_get_time_since_boot_ms(void)
+{
+	return (unsigned long)(get_now() / 1000);
+}
+
+uint64_t board_get_time_since_boot_us(void)
+{
+	return get_now();
+}
+
+time_t time(time_t *tloc)
+{
+	const time_t t = (time_t)(m.epoch + get_now() / 1000000);
+
+	if (tloc) {
+		*tloc = t;
+	}
+
+	return t;
+}
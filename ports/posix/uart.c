@@ -0,0 +1,505 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* UART over a serial device or a pseudo terminal for host builds. A reader
+ * thread waits on epoll and feeds the common RX ring so that protocol stacks
+ * can be load tested against a peer process at high baudrates. */
+
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "libmcu/posix_uart.h"
+#include "libmcu/uart_rx.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#if !defined(UART_RX_BUFSIZE)
+#define UART_RX_BUFSIZE				65536U
+#endif
+#if !defined(UART_READ_CHUNK_SIZE)
+#define UART_READ_CHUNK_SIZE			4096U
+#endif
+#if !defined(UART_NAME_MAXLEN)
+#define UART_NAME_MAXLEN			64U
+#endif
+
+struct uart {
+	struct uart_config config;
+	struct uart_rx rx;
+	uint8_t rxbuf[UART_RX_BUFSIZE];
+	uint8_t chunk[UART_READ_CHUNK_SIZE];
+
+	char name[UART_NAME_MAXLEN];
+	int fd;
+	int peer_fd; /* pty slave held open to avoid EIO without a peer */
+	int epfd;
+	int evfd;
+
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+
+	uart_rx_callback_t cb;
+	void *cb_ctx;
+
+	uint8_t channel;
+	bool pty;
+	bool activated;
+};
+
+static speed_t baudrate_to_speed(uint32_t baudrate)
+{
+	switch (baudrate) {
+	case 9600: return B9600;
+	case 19200: return B19200;
+	case 38400: return B38400;
+	case 57600: return B57600;
+	case 115200: return B115200;
+	case 230400: return B230400;
+	case 460800: return B460800;
+	case 921600: return B921600;
+	case 1000000: return B1000000;
+	case 2000000: return B2000000;
+	case 3000000: return B3000000;
+	case 4000000: return B4000000;
+	default: return B0;
+	}
+}
+
+static int apply_termios(struct uart *self)
+{
+	const struct uart_config *config = &self->config;
+	const speed_t speed = baudrate_to_speed(config->baudrate);
+	struct termios tio;
+
+	if (tcgetattr(self->fd, &tio) != 0) {
+		return -errno;
+	}
+
+	cfmakeraw(&tio);
+	tio.c_cflag |= CLOCAL | CREAD;
+	tio.c_cflag &= (tcflag_t)~(CSIZE | PARENB | PARODD | CSTOPB | CRTSCTS);
+
+	switch (config->databit) {
+	case 5: tio.c_cflag |= CS5; break;
+	case 6: tio.c_cflag |= CS6; break;
+	case 7: tio.c_cflag |= CS7; break;
+	default: tio.c_cflag |= CS8; break;
+	}
+
+	if (config->parity == UART_PARITY_EVEN) {
+		tio.c_cflag |= PARENB;
+	} else if (config->parity == UART_PARITY_ODD) {
+		tio.c_cflag |= PARENB | PARODD;
+	}
+
+	if (config->stopbit != UART_STOPBIT_1) {
+		tio.c_cflag |= CSTOPB;
+	}
+
+	if (config->flowctrl != UART_FLOWCTRL_NONE) {
+		tio.c_cflag |= CRTSCTS;
+	}
+
+	if (speed != B0) {
+		cfsetispeed(&tio, speed);
+		cfsetospeed(&tio, speed);
+	}
+
+	if (tcsetattr(self->fd, TCSANOW, &tio) != 0) {
+		return -errno;
+	}
+
+	return 0;
+}
+
+static void notify(struct uart *self)
+{
+	pthread_mutex_lock(&self->lock);
+	pthread_cond_broadcast(&self->cond);
+	pthread_mutex_unlock(&self->lock);
+
+	if (self->cb) {
+		(*self->cb)(self, self->cb_ctx);
+	}
+}
+
+/* Returns false when the device is gone. */
+static bool drain_fd(struct uart *self)
+{
+	while (1) {
+		const ssize_t n = read(self->fd, self->chunk, sizeof(self->chunk));
+
+		if (n > 0) {
+			uart_rx_push(&self->rx, self->chunk, (size_t)n);
+			continue;
+		} else if (n < 0 && (errno == EAGAIN || errno == EINTR)) {
+			return true;
+		}
+
+		return false;
+	}
+}
+
+static void *rx_thread(void *arg)
+{
+	struct uart *self = (struct uart *)arg;
+	const struct timespec backoff = { .tv_nsec = 10000000L };
+	bool idle_pending = false;
+
+	while (1) {
+		struct epoll_event events[2];
+		const uint32_t gap = self->rx.param.idle_gap_ms;
+		const int timeout = idle_pending && gap? (int)gap : -1;
+		const int n = epoll_wait(self->epfd, events, 2, timeout);
+		bool received = false;
+
+		if (n < 0) {
+			continue;
+		} else if (n == 0) {
+			/* let the consumer pick up the frame ended by idle */
+			idle_pending = false;
+			notify(self);
+			continue;
+		}
+
+		for (int i = 0; i < n; i++) {
+			if (events[i].data.fd == self->evfd) {
+				return NULL;
+			}
+			if (!drain_fd(self)) {
+				nanosleep(&backoff, NULL);
+			}
+			received = true;
+		}
+
+		if (received) {
+			idle_pending = true;
+			notify(self);
+		}
+	}
+
+	return NULL;
+}
+
+static int open_pty(struct uart *self)
+{
+	int fd = posix_openpt(O_RDWR | O_NOCTTY);
+
+	if (fd < 0) {
+		return -errno;
+	}
+
+	if (grantpt(fd) != 0 || unlockpt(fd) != 0 ||
+			ptsname_r(fd, self->name, sizeof(self->name)) != 0) {
+		close(fd);
+		return -ENODEV;
+	}
+
+	if ((self->peer_fd = open(self->name, O_RDWR | O_NOCTTY)) < 0) {
+		close(fd);
+		return -ENODEV;
+	}
+
+	self->fd = fd;
+
+	/* the line discipline applies to the slave side */
+	struct termios tio;
+	tcgetattr(self->peer_fd, &tio);
+	cfmakeraw(&tio);
+	tcsetattr(self->peer_fd, TCSANOW, &tio);
+
+	return 0;
+}
+
+static int open_device(struct uart *self)
+{
+	if (self->pty) {
+		return open_pty(self);
+	}
+
+	if ((self->fd = open(self->name, O_RDWR | O_NOCTTY)) < 0) {
+		return -errno;
+	}
+
+	return 0;
+}
+
+static int start_rx_thread(struct uart *self)
+{
+	struct epoll_event ev = { .events = EPOLLIN, };
+
+	if ((self->epfd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+		return -errno;
+	}
+	if ((self->evfd = eventfd(0, EFD_CLOEXEC)) < 0) {
+		close(self->epfd);
+		return -errno;
+	}
+
+	ev.data.fd = self->fd;
+	epoll_ctl(self->epfd, EPOLL_CTL_ADD, self->fd, &ev);
+	ev.data.fd = self->evfd;
+	epoll_ctl(self->epfd, EPOLL_CTL_ADD, self->evfd, &ev);
+
+	if (pthread_create(&self->thread, NULL, rx_thread, self) != 0) {
+		close(self->evfd);
+		close(self->epfd);
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+
+static void stop_rx_thread(struct uart *self)
+{
+	const uint64_t val = 1;
+
+	if (write(self->evfd, &val, sizeof(val)) == sizeof(val)) {
+		pthread_join(self->thread, NULL);
+	}
+
+	close(self->evfd);
+	close(self->epfd);
+}
+
+static int wait_for_data(struct uart *self, uint32_t timeout_ms)
+{
+	struct timespec ts;
+	int err = 0;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	ts.tv_sec += timeout_ms / 1000;
+	ts.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+	if (ts.tv_nsec >= 1000000000L) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
+	}
+
+	pthread_mutex_lock(&self->lock);
+	while (uart_rx_length(&self->rx) == 0 && err == 0) {
+		err = pthread_cond_timedwait(&self->cond, &self->lock, &ts);
+	}
+	pthread_mutex_unlock(&self->lock);
+
+	return err? -ETIMEDOUT : 0;
+}
+
+int uart_read(struct uart *self, void *buf, size_t bufsize)
+{
+	if (!self || !self->activated) {
+		return -EPIPE;
+	}
+
+	if (uart_rx_length(&self->rx) == 0 && self->config.rx_timeout_ms &&
+			wait_for_data(self, self->config.rx_timeout_ms) != 0) {
+		return 0;
+	}
+
+	return (int)uart_rx_read(&self->rx, buf, bufsize);
+}
+
+int uart_write(struct uart *self, const void *data, size_t data_len)
+{
+	const uint8_t *p = (const uint8_t *)data;
+	size_t written = 0;
+
+	if (!self || !self->activated) {
+		return -EPIPE;
+	}
+
+	while (written < data_len) {
+		const ssize_t n = write(self->fd, &p[written], data_len - written);
+
+		if (n >= 0) {
+			written += (size_t)n;
+		} else if (errno == EAGAIN) {
+			struct pollfd pfd = { .fd = self->fd, .events = POLLOUT, };
+			poll(&pfd, 1, -1);
+		} else if (errno != EINTR) {
+			return written? (int)written : -errno;
+		}
+	}
+
+	return (int)written;
+}
+
+int uart_register_rx_callback(struct uart *self,
+		uart_rx_callback_t cb, void *cb_ctx)
+{
+	if (!self) {
+		return -EINVAL;
+	}
+
+	self->cb = cb;
+	self->cb_ctx = cb_ctx;
+
+	return 0;
+}
+
+int uart_configure(struct uart *self, const struct uart_config *config)
+{
+	if (!self || !config) {
+		return -EINVAL;
+	}
+
+	self->config = *config;
+
+	if (self->activated) {
+		return apply_termios(self);
+	}
+
+	return 0;
+}
+
+int uart_flush(struct uart *self)
+{
+	if (!self || !self->activated) {
+		return -EPIPE;
+	}
+
+	return tcdrain(self->fd) == 0? 0 : -errno;
+}
+
+int uart_clear(struct uart *self)
+{
+	if (!self || !self->activated) {
+		return -EPIPE;
+	}
+
+	tcflush(self->fd, TCIFLUSH);
+	uart_rx_clear(&self->rx);
+
+	return 0;
+}
+
+int uart_enable(struct uart *self, uint32_t baudrate)
+{
+	int err;
+
+	if (!self) {
+		return -EINVAL;
+	} else if (self->activated) {
+		return -EALREADY;
+	}
+
+	self->config.baudrate = baudrate;
+
+	if ((err = open_device(self)) != 0) {
+		return err;
+	}
+
+	fcntl(self->fd, F_SETFL, fcntl(self->fd, F_GETFL) | O_NONBLOCK);
+
+	if ((err = apply_termios(self)) != 0 ||
+			(err = start_rx_thread(self)) != 0) {
+		goto out_err;
+	}
+
+	self->activated = true;
+
+	return 0;
+out_err:
+	close(self->fd);
+	if (self->peer_fd >= 0) {
+		close(self->peer_fd);
+		self->peer_fd = -1;
+	}
+	return err;
+}
+
+int uart_disable(struct uart *self)
+{
+	if (!self || !self->activated) {
+		return -EALREADY;
+	}
+
+	stop_rx_thread(self);
+	close(self->fd);
+	if (self->peer_fd >= 0) {
+		close(self->peer_fd);
+		self->peer_fd = -1;
+	}
+
+	self->activated = false;
+
+	return 0;
+}
+
+struct uart_rx *uart_rx_get(struct uart *uart)
+{
+	return uart? &uart->rx : NULL;
+}
+
+const char *posix_uart_name(const struct uart *self)
+{
+	return self->name;
+}
+
+struct uart *posix_uart_create(uint8_t channel, const char *path)
+{
+	struct uart *self = (struct uart *)calloc(1, sizeof(*self));
+
+	if (self == NULL) {
+		return NULL;
+	}
+
+	if (path) {
+		strncpy(self->name, path, sizeof(self->name) - 1);
+	} else {
+		self->pty = true;
+	}
+
+	self->channel = channel;
+	self->fd = -1;
+	self->peer_fd = -1;
+	self->config = (struct uart_config) {
+		.baudrate = 115200,
+		.databit = 8,
+		.parity = UART_PARITY_NONE,
+		.stopbit = UART_STOPBIT_1,
+		.flowctrl = UART_FLOWCTRL_NONE,
+	};
+
+	uart_rx_init(&self->rx, self->rxbuf, sizeof(self->rxbuf), NULL);
+	pthread_mutex_init(&self->lock, NULL);
+	pthread_cond_init(&self->cond, NULL);
+
+	return self;
+}
+
+struct uart *uart_create(uint8_t channel, const struct uart_pin *pin)
+{
+	(void)pin;
+	return posix_uart_create(channel, NULL);
+}
+
+void uart_delete(struct uart *self)
+{
+	if (!self) {
+		return;
+	}
+
+	if (self->activated) {
+		uart_disable(self);
+	}
+
+	pthread_cond_destroy(&self->cond);
+	pthread_mutex_destroy(&self->lock);
+	free(self);
+}
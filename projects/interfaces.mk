@@ -4,7 +4,10 @@ ifneq ($(LIBMCU_ROOT),)
 libmcu-basedir := $(LIBMCU_ROOT)/
 endif
 
-LIBMCU_INTERFACES ?= adc apptmr ble flash gpio i2c kvstore l4 pwm spi uart wdt wifi
+LIBMCU_INTERFACES ?= adc apptmr ble evloop flash gpio i2c kvstore l4 pwm spi uart wdt wifi
 
+LIBMCU_INTERFACES_SRCS := $(foreach d, \
+	$(addprefix $(libmcu-basedir)interfaces/, $(LIBMCU_INTERFACES)), \
+	$(shell find $(d)/src -maxdepth 1 -type f -regex ".*\.c" 2>/dev/null))
 LIBMCU_INTERFACES_INCS := $(foreach d, $(LIBMCU_INTERFACES), \
 	$(addprefix $(libmcu-basedir)interfaces/, $(d))/include)
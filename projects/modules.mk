@@ -6,7 +6,7 @@ endif
 
 LIBMCU_MODULES ?= actor ao apptimer bitmap button buzzer cleanup cli common \
 		  dfu jobqueue logging metrics pubsub ratelim retry runner pm \
-		  fsm
+		  fsm l4pool coro
 
 ifeq ($(filter common, $(LIBMCU_MODULES)),)
 LIBMCU_MODULES += common
@@ -0,0 +1,126 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+
+static uint64_t get_time_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+	const double x = *(const double *)a;
+	const double y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+/* nearest-rank percentile of sorted samples */
+static double get_percentile(const double *sorted, uint32_t n, unsigned int pct)
+{
+	uint32_t rank = (uint32_t)(((uint64_t)pct * n + 99) / 100);
+	return sorted[rank? rank - 1 : 0];
+}
+
+int bench_run(const struct bench *bench, const struct bench_param *param,
+		struct bench_result *result)
+{
+	double samples[BENCH_MAX_REPETITIONS];
+	void *ctx = NULL;
+	uint64_t total_ns = 0;
+	int err;
+
+	if (!bench || !bench->run || !param || !result ||
+			param->repetitions == 0 || param->batch == 0 ||
+			param->repetitions > BENCH_MAX_REPETITIONS) {
+		return -EINVAL;
+	}
+
+	if (bench->setup && (err = (*bench->setup)(&ctx)) != 0) {
+		return err;
+	}
+
+	for (uint32_t i = 0; i < param->warmup; i++) {
+		(*bench->run)(ctx, param->batch);
+	}
+
+	bench_alloc_reset();
+
+	for (uint32_t i = 0; i < param->repetitions; i++) {
+		const uint64_t t0 = get_time_ns();
+		(*bench->run)(ctx, param->batch);
+		const uint64_t elapsed = get_time_ns() - t0;
+
+		total_ns += elapsed;
+		samples[i] = (double)elapsed / param->batch;
+	}
+
+	const uint64_t allocs = bench_alloc_count();
+	const uint64_t alloc_bytes = bench_alloc_bytes();
+
+	if (bench->teardown) {
+		(*bench->teardown)(ctx);
+	}
+
+	qsort(samples, param->repetitions, sizeof(*samples), compare_double);
+
+	*result = (struct bench_result) {
+		.name = bench->name,
+		.ops = (uint64_t)param->repetitions * param->batch,
+		.min_ns = samples[0],
+		.p50_ns = get_percentile(samples, param->repetitions, 50),
+		.p90_ns = get_percentile(samples, param->repetitions, 90),
+		.p99_ns = get_percentile(samples, param->repetitions, 99),
+		.max_ns = samples[param->repetitions - 1],
+	};
+
+	result->ns_per_op = (double)total_ns / (double)result->ops;
+	result->ops_per_sec = total_ns? 1e9 / result->ns_per_op : 0;
+	result->allocs_per_op = (double)allocs / (double)result->ops;
+	result->alloc_bytes_per_op = (double)alloc_bytes / (double)result->ops;
+
+	return 0;
+}
+
+void bench_print(FILE *fp, const struct bench_result *r)
+{
+	fprintf(fp, "%-32s %10.1f ns/op %12.0f ops/s "
+			"p50 %8.1f p99 %8.1f allocs/op %.2f\n",
+			r->name, r->ns_per_op, r->ops_per_sec,
+			r->p50_ns, r->p99_ns, r->allocs_per_op);
+}
+
+void bench_print_json(FILE *fp, const struct bench_param *param,
+		const struct bench_result *results, size_t n)
+{
+	fprintf(fp, "{\n  \"warmup\": %u,\n  \"repetitions\": %u,\n"
+			"  \"batch\": %u,\n  \"benchmarks\": [",
+			param->warmup, param->repetitions, param->batch);
+
+	for (size_t i = 0; i < n; i++) {
+		const struct bench_result *r = &results[i];
+		fprintf(fp, "%s\n    {\"name\": \"%s\", \"ops\": %llu, "
+				"\"ns_per_op\": %.3f, \"ops_per_sec\": %.1f, "
+				"\"min_ns\": %.3f, \"p50_ns\": %.3f, "
+				"\"p90_ns\": %.3f, \"p99_ns\": %.3f, "
+				"\"max_ns\": %.3f, \"allocs_per_op\": %.4f, "
+				"\"alloc_bytes_per_op\": %.2f}",
+				i? "," : "", r->name,
+				(unsigned long long)r->ops,
+				r->ns_per_op, r->ops_per_sec,
+				r->min_ns, r->p50_ns, r->p90_ns, r->p99_ns,
+				r->max_ns, r->allocs_per_op,
+				r->alloc_bytes_per_op);
+	}
+
+	fprintf(fp, "\n  ]\n}\n");
+}
@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef LIBMCU_BENCH_H
+#define LIBMCU_BENCH_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#if !defined(BENCH_MAX_REPETITIONS)
+#define BENCH_MAX_REPETITIONS		1000U
+#endif
+
+/**
+ * Run @p n operations. A repetition is timed as a whole so that the clock
+ * overhead gets amortized over the batch.
+ */
+typedef void (*bench_func_t)(void *ctx, uint32_t n);
+
+struct bench {
+	const char *name;
+	bench_func_t run;
+	/** optional. allocations made here are not counted */
+	int (*setup)(void **ctx);
+	/** optional */
+	void (*teardown)(void *ctx);
+};
+
+struct bench_param {
+	/** repetitions run before measurement to warm up caches */
+	uint32_t warmup;
+	/** timed repetitions, up to @ref BENCH_MAX_REPETITIONS */
+	uint32_t repetitions;
+	/** operations per repetition */
+	uint32_t batch;
+};
+
+struct bench_result {
+	const char *name;
+	uint64_t ops;
+	double ns_per_op;
+	double ops_per_sec;
+	/** percentiles of per-op latency over the repetitions */
+	double min_ns;
+	double p50_ns;
+	double p90_ns;
+	double p99_ns;
+	double max_ns;
+	double allocs_per_op;
+	double alloc_bytes_per_op;
+};
+
+int bench_run(const struct bench *bench, const struct bench_param *param,
+		struct bench_result *result);
+
+void bench_print(FILE *fp, const struct bench_result *result);
+void bench_print_json(FILE *fp, const struct bench_param *param,
+		const struct bench_result *results, size_t n);
+
+void bench_alloc_reset(void);
+uint64_t bench_alloc_count(void);
+uint64_t bench_alloc_bytes(void);
+
+/* Keep the compiler from optimizing away the computation producing @p p. */
+static inline void bench_keep(const void *p)
+{
+	__asm__ volatile("" : : "g"(p) : "memory");
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* LIBMCU_BENCH_H */
@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* Allocation counting by symbol wrapping. The bench binary gets linked with
+ * -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc so every heap allocation
+ * made by the code under test goes through here. */
+
+#include "bench.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void *__wrap_malloc(size_t size);
+void *__wrap_calloc(size_t nmemb, size_t size);
+void *__wrap_realloc(void *ptr, size_t size);
+
+static atomic_ullong count;
+static atomic_ullong bytes;
+
+static void account(size_t size)
+{
+	atomic_fetch_add_explicit(&count, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&bytes, size, memory_order_relaxed);
+}
+
+void *__wrap_malloc(size_t size)
+{
+	account(size);
+	return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+	account(nmemb * size);
+	return __real_calloc(nmemb, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+	account(size);
+	return __real_realloc(ptr, size);
+}
+
+void bench_alloc_reset(void)
+{
+	atomic_store(&count, 0);
+	atomic_store(&bytes, 0);
+}
+
+uint64_t bench_alloc_count(void)
+{
+	return atomic_load(&count);
+}
+
+uint64_t bench_alloc_bytes(void)
+{
+	return atomic_load(&bytes);
+}
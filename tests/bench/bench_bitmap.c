@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+#include "libmcu/bitmap.h"
+
+#define BITMAP_BITS		1000
+
+static DEFINE_BITMAP(bitmap, BITMAP_BITS);
+
+static void set_get_clear(void *ctx, uint32_t n)
+{
+	(void)ctx;
+
+	for (uint32_t i = 0; i < n; i++) {
+		const int pos = (int)(i % BITMAP_BITS);
+		bitmap_set(bitmap, pos);
+		bench_keep((const void *)(uintptr_t)bitmap_get(bitmap, pos));
+		bitmap_clear(bitmap, pos);
+	}
+}
+
+static void count(void *ctx, uint32_t n)
+{
+	(void)ctx;
+
+	bitmap_create_static(bitmap, BITMAP_BITS, true);
+
+	for (uint32_t i = 0; i < n; i++) {
+		bench_keep((const void *)(uintptr_t)
+				bitmap_count(bitmap, BITMAP_BITS));
+	}
+}
+
+const struct bench bench_bitmap[] = {
+	{ "bitmap/set_get_clear", set_get_clear, NULL, NULL },
+	{ "bitmap/count_1000", count, NULL, NULL },
+	{ NULL, NULL, NULL, NULL },
+};
@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+#include "libmcu/flash_kvstore.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define FLASH_SIZE		16384U
+#define NR_KEYS			16U
+
+struct flash {
+	struct flash_api api;
+	uint8_t mem[FLASH_SIZE];
+};
+
+static struct flash storage;
+static struct flash scratch;
+static char keys[NR_KEYS][8];
+
+static int ram_erase(struct flash *self, uintptr_t offset, size_t size)
+{
+	memset(&self->mem[offset], 0xff, size);
+	return 0;
+}
+
+static int ram_write(struct flash *self,
+		uintptr_t offset, const void *data, size_t len)
+{
+	memcpy(&self->mem[offset], data, len);
+	return 0;
+}
+
+static int ram_read(struct flash *self, uintptr_t offset, void *buf, size_t len)
+{
+	memcpy(buf, &self->mem[offset], len);
+	return (int)len;
+}
+
+static size_t ram_size(struct flash *self)
+{
+	return sizeof(self->mem);
+}
+
+static void init_flash(struct flash *flash)
+{
+	flash->api = (struct flash_api) {
+		.erase = ram_erase,
+		.write = ram_write,
+		.read = ram_read,
+		.size = ram_size,
+	};
+	ram_erase(flash, 0, sizeof(flash->mem));
+}
+
+static int setup(void **ctx)
+{
+	uint32_t value = 0;
+
+	init_flash(&storage);
+	init_flash(&scratch);
+
+	struct kvstore *kvs = flash_kvstore_new(&storage, &scratch);
+
+	for (unsigned int i = 0; i < NR_KEYS; i++) {
+		snprintf(keys[i], sizeof(keys[i]), "key%u", i);
+		if (kvstore_write(kvs, keys[i], &value, sizeof(value)) != 0) {
+			return -1;
+		}
+	}
+
+	*ctx = kvs;
+
+	return 0;
+}
+
+static void read_u32(void *ctx, uint32_t n)
+{
+	struct kvstore *kvs = (struct kvstore *)ctx;
+	uint32_t value;
+
+	for (uint32_t i = 0; i < n; i++) {
+		kvstore_read(kvs, keys[i % NR_KEYS], &value, sizeof(value));
+		bench_keep(&value);
+	}
+}
+
+/* includes the amortized cost of reclaiming */
+static void write_u32(void *ctx, uint32_t n)
+{
+	struct kvstore *kvs = (struct kvstore *)ctx;
+
+	for (uint32_t i = 0; i < n; i++) {
+		kvstore_write(kvs, keys[i % NR_KEYS], &i, sizeof(i));
+	}
+}
+
+const struct bench bench_kvstore[] = {
+	{ "kvstore/flash_read_u32", read_u32, setup, NULL },
+	{ "kvstore/flash_write_u32", write_u32, setup, NULL },
+	{ NULL, NULL, NULL, NULL },
+};
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+#include "libmcu/logging.h"
+#include "libmcu/ringbuf.h"
+
+#define LOGBUF_SIZE		8192U
+
+static struct ringbuf *logbuf;
+
+static size_t backend_write(const void *data, size_t size)
+{
+	const uint16_t len = (uint16_t)size;
+
+	/* drop the oldest ones to make room as a circular log storage */
+	while (ringbuf_capacity(logbuf) - ringbuf_length(logbuf) <
+			sizeof(len) + size) {
+		uint16_t oldest;
+		if (ringbuf_peek(logbuf, 0, &oldest, sizeof(oldest))
+				!= sizeof(oldest) ||
+				!ringbuf_consume(logbuf,
+					sizeof(oldest) + oldest)) {
+			return 0;
+		}
+	}
+
+	ringbuf_write(logbuf, &len, sizeof(len));
+	return ringbuf_write(logbuf, data, size);
+}
+
+static const struct logging_backend backend = {
+	.write = backend_write,
+};
+
+static unsigned long get_time(void)
+{
+	return 0;
+}
+
+static int setup(void **ctx)
+{
+	(void)ctx;
+
+	if ((logbuf = ringbuf_create(LOGBUF_SIZE)) == NULL) {
+		return -1;
+	}
+
+	logging_init(get_time);
+	logging_add_backend(&backend);
+	logging_set_level_global(LOGGING_TYPE_DEBUG);
+
+	return 0;
+}
+
+static void teardown(void *ctx)
+{
+	(void)ctx;
+	logging_remove_backend(&backend);
+	ringbuf_destroy(logbuf);
+}
+
+static void write_formatted(void *ctx, uint32_t n)
+{
+	(void)ctx;
+
+	for (uint32_t i = 0; i < n; i++) {
+		info("sensor %u reads %d at %s", i, -42, "bench");
+	}
+}
+
+static void write_filtered(void *ctx, uint32_t n)
+{
+	(void)ctx;
+
+	logging_set_level_global(LOGGING_TYPE_ERROR);
+	for (uint32_t i = 0; i < n; i++) {
+		debug("sensor %u reads %d at %s", i, -42, "bench");
+	}
+	logging_set_level_global(LOGGING_TYPE_DEBUG);
+}
+
+const struct bench bench_logging[] = {
+	{ "logging/write_formatted", write_formatted, setup, teardown },
+	{ "logging/write_filtered", write_filtered, setup, teardown },
+	{ NULL, NULL, NULL, NULL },
+};
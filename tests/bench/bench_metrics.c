@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+#include "libmcu/metrics.h"
+
+static int setup(void **ctx)
+{
+	(void)ctx;
+	metrics_init(true);
+	return 0;
+}
+
+static void increase(void *ctx, uint32_t n)
+{
+	(void)ctx;
+
+	for (uint32_t i = 0; i < n; i++) {
+		metrics_increase(Resets);
+	}
+}
+
+static void set_if_max(void *ctx, uint32_t n)
+{
+	(void)ctx;
+
+	for (uint32_t i = 0; i < n; i++) {
+		metrics_set_if_max(CPULoad, (metric_value_t)(i & 0xff));
+	}
+}
+
+static void collect(void *ctx, uint32_t n)
+{
+	uint8_t buf[512];
+	(void)ctx;
+
+	for (uint32_t i = 0; i < n; i++) {
+		bench_keep(buf);
+		metrics_collect(buf, sizeof(buf));
+	}
+}
+
+const struct bench bench_metrics[] = {
+	{ "metrics/increase", increase, setup, NULL },
+	{ "metrics/set_if_max", set_if_max, setup, NULL },
+	{ "metrics/collect", collect, setup, NULL },
+	{ NULL, NULL, NULL, NULL },
+};
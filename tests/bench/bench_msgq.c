@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+#include "libmcu/msgq.h"
+
+#define MSGQ_SIZE		4096U
+
+static uint8_t data[128];
+
+static int setup(void **ctx)
+{
+	return (*ctx = msgq_create(MSGQ_SIZE)) == NULL? -1 : 0;
+}
+
+static void teardown(void *ctx)
+{
+	msgq_destroy((struct msgq *)ctx);
+}
+
+static void push_pop(struct msgq *q, size_t len, uint32_t n)
+{
+	uint8_t buf[sizeof(data)];
+
+	for (uint32_t i = 0; i < n; i++) {
+		msgq_push(q, data, len);
+		msgq_pop(q, buf, sizeof(buf));
+		bench_keep(buf);
+	}
+}
+
+static void push_pop_8(void *ctx, uint32_t n)
+{
+	push_pop((struct msgq *)ctx, 8, n);
+}
+
+static void push_pop_128(void *ctx, uint32_t n)
+{
+	push_pop((struct msgq *)ctx, 128, n);
+}
+
+/* fill up to a half and drain to see the cost with messages queued */
+static void burst_16(void *ctx, uint32_t n)
+{
+	struct msgq *q = (struct msgq *)ctx;
+	uint8_t buf[16];
+	uint32_t i = 0;
+
+	while (i < n) {
+		uint32_t queued = 0;
+		for (; i < n && msgq_available(q) > MSGQ_SIZE / 2; i++) {
+			msgq_push(q, data, sizeof(buf));
+			queued++;
+		}
+		while (queued--) {
+			msgq_pop(q, buf, sizeof(buf));
+		}
+		bench_keep(buf);
+	}
+}
+
+const struct bench bench_msgq[] = {
+	{ "msgq/push_pop_8", push_pop_8, setup, teardown },
+	{ "msgq/push_pop_128", push_pop_128, setup, teardown },
+	{ "msgq/burst_16", burst_16, setup, teardown },
+	{ NULL, NULL, NULL, NULL },
+};
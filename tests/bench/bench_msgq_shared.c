@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+#include "libmcu/msgq_shared.h"
+
+#include <sched.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#define MSGQ_NAME		"/libmcu_bench_msgq"
+#define MSGQ_SIZE		65536U
+
+struct ctx {
+	struct msgq_shared *q;
+	pid_t consumer;
+};
+
+static uint8_t data[64];
+
+/* pops until an empty message comes in */
+static void consume(void)
+{
+	struct msgq_shared *q = msgq_create_shared(MSGQ_NAME, MSGQ_SIZE);
+	uint8_t buf[sizeof(data)];
+
+	while (q && msgq_pop_shared(q, buf, sizeof(buf), -1) != 0) {
+		bench_keep(buf);
+	}
+
+	_exit(q == NULL);
+}
+
+static int setup_local(void **ctx)
+{
+	struct ctx *p = (struct ctx *)calloc(1, sizeof(*p));
+
+	msgq_unlink_shared(MSGQ_NAME);
+
+	if (p == NULL || (p->q = msgq_create_shared(MSGQ_NAME, MSGQ_SIZE))
+			== NULL) {
+		free(p);
+		return -1;
+	}
+
+	*ctx = p;
+	return 0;
+}
+
+static int setup_remote(void **ctx)
+{
+	if (setup_local(ctx) != 0) {
+		return -1;
+	}
+
+	struct ctx *p = (struct ctx *)*ctx;
+
+	if ((p->consumer = fork()) == 0) {
+		consume();
+	}
+
+	return p->consumer < 0? -1 : 0;
+}
+
+static void teardown(void *ctx)
+{
+	struct ctx *p = (struct ctx *)ctx;
+
+	if (p->consumer > 0) {
+		while (msgq_push_shared(p->q, NULL, 0) != 0) {
+			sched_yield();
+		}
+		waitpid(p->consumer, NULL, 0);
+	}
+
+	msgq_destroy_shared(p->q);
+	msgq_unlink_shared(MSGQ_NAME);
+	free(p);
+}
+
+static void push_pop_8(void *ctx, uint32_t n)
+{
+	struct msgq_shared *q = ((struct ctx *)ctx)->q;
+	uint8_t buf[sizeof(data)];
+
+	for (uint32_t i = 0; i < n; i++) {
+		msgq_push_shared(q, data, 8);
+		msgq_pop_shared(q, buf, sizeof(buf), 0);
+		bench_keep(buf);
+	}
+}
+
+/* messages per second streamed to the consumer process */
+static void stream_64(void *ctx, uint32_t n)
+{
+	struct msgq_shared *q = ((struct ctx *)ctx)->q;
+
+	for (uint32_t i = 0; i < n; i++) {
+		while (msgq_push_shared(q, data, sizeof(data)) != 0) {
+			sched_yield();
+		}
+	}
+}
+
+const struct bench bench_msgq_shared[] = {
+	{ "msgq_shared/push_pop_8", push_pop_8, setup_local, teardown },
+	{ "msgq_shared/stream_64_xproc", stream_64, setup_remote, teardown },
+	{ NULL, NULL, NULL, NULL },
+};
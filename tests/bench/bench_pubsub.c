@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+#include "libmcu/pubsub.h"
+
+#define NR_SUBSCRIBERS		8
+
+static pubsub_subscribe_static_t subs[NR_SUBSCRIBERS];
+static unsigned int received;
+
+static void callback(void *context, const void *msg, size_t msglen)
+{
+	(void)context;
+	(void)msg;
+	(void)msglen;
+	received++;
+}
+
+static int setup_subscribers(unsigned int n, const char *filter)
+{
+	pubsub_init();
+
+	for (unsigned int i = 0; i < n; i++) {
+		if (!pubsub_subscribe_static(&subs[i], filter, callback, NULL)) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static int setup_1(void **ctx)
+{
+	(void)ctx;
+	return setup_subscribers(1, "bench/topic");
+}
+
+static int setup_8_wildcard(void **ctx)
+{
+	(void)ctx;
+	return setup_subscribers(NR_SUBSCRIBERS, "bench/#");
+}
+
+static int setup_none(void **ctx)
+{
+	(void)ctx;
+	pubsub_init();
+	return 0;
+}
+
+static void teardown(void *ctx)
+{
+	(void)ctx;
+	pubsub_deinit();
+}
+
+static void publish(void *ctx, uint32_t n)
+{
+	const uint32_t msg = 0xdeadbeef;
+	(void)ctx;
+
+	for (uint32_t i = 0; i < n; i++) {
+		pubsub_publish("bench/topic", &msg, sizeof(msg));
+	}
+	bench_keep(&received);
+}
+
+static void subscribe_unsubscribe(void *ctx, uint32_t n)
+{
+	(void)ctx;
+
+	for (uint32_t i = 0; i < n; i++) {
+		pubsub_subscribe_t sub =
+			pubsub_subscribe("bench/topic", callback, NULL);
+		pubsub_unsubscribe(sub);
+	}
+}
+
+const struct bench bench_pubsub[] = {
+	{ "pubsub/publish_1", publish, setup_1, teardown },
+	{ "pubsub/publish_8_wildcard", publish, setup_8_wildcard, teardown },
+	{ "pubsub/subscribe_unsubscribe", subscribe_unsubscribe,
+		setup_none, teardown },
+	{ NULL, NULL, NULL, NULL },
+};
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+#include "libmcu/ringbuf.h"
+
+#define RINGBUF_SIZE		4096U
+
+static uint8_t data[256];
+
+static int setup(void **ctx)
+{
+	return (*ctx = ringbuf_create(RINGBUF_SIZE)) == NULL? -1 : 0;
+}
+
+static void teardown(void *ctx)
+{
+	ringbuf_destroy((struct ringbuf *)ctx);
+}
+
+static void write_read(struct ringbuf *rb, size_t len, uint32_t n)
+{
+	uint8_t buf[sizeof(data)];
+
+	for (uint32_t i = 0; i < n; i++) {
+		ringbuf_write(rb, data, len);
+		ringbuf_read(rb, 0, buf, len);
+		bench_keep(buf);
+	}
+}
+
+static void write_read_16(void *ctx, uint32_t n)
+{
+	write_read((struct ringbuf *)ctx, 16, n);
+}
+
+static void write_read_256(void *ctx, uint32_t n)
+{
+	write_read((struct ringbuf *)ctx, 256, n);
+}
+
+static void peek_pointer_consume(void *ctx, uint32_t n)
+{
+	struct ringbuf *rb = (struct ringbuf *)ctx;
+
+	for (uint32_t i = 0; i < n; i++) {
+		size_t contiguous;
+		ringbuf_write(rb, data, 64);
+		const void *p = ringbuf_peek_pointer(rb, 0, &contiguous);
+		bench_keep(p);
+		ringbuf_consume(rb, 64);
+	}
+}
+
+const struct bench bench_ringbuf[] = {
+	{ "ringbuf/write_read_16", write_read_16, setup, teardown },
+	{ "ringbuf/write_read_256", write_read_256, setup, teardown },
+	{ "ringbuf/peek_pointer_consume", peek_pointer_consume,
+		setup, teardown },
+	{ NULL, NULL, NULL, NULL },
+};
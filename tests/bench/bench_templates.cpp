@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* Counterparts of bench_ringbuf.c, bench_msgq.c and bench_bitmap.c for the
+ * C++ templates. The same workloads are used for side by side comparison. */
+
+#include "bench.h"
+
+#include <new>
+
+#include "libmcu/ringbuf.hpp"
+#include "libmcu/msgq.hpp"
+#include "libmcu/bitmap.hpp"
+
+namespace {
+
+typedef libmcu::RingBuffer<uint8_t, 4096> ring_t;
+typedef libmcu::MsgQueue<4096> queue_t;
+typedef libmcu::Bitmap<1000> bits_t;
+
+uint8_t data[256];
+
+template <typename T>
+int create(void **ctx)
+{
+	return (*ctx = new (std::nothrow) T()) == nullptr? -1 : 0;
+}
+
+template <typename T>
+void destroy(void *ctx)
+{
+	delete static_cast<T *>(ctx);
+}
+
+void write_read(ring_t *rb, size_t len, uint32_t n)
+{
+	uint8_t buf[sizeof(data)];
+
+	for (uint32_t i = 0; i < n; i++) {
+		rb->write(data, len);
+		rb->read(buf, len);
+		bench_keep(buf);
+	}
+}
+
+void write_read_16(void *ctx, uint32_t n)
+{
+	write_read(static_cast<ring_t *>(ctx), 16, n);
+}
+
+void write_read_256(void *ctx, uint32_t n)
+{
+	write_read(static_cast<ring_t *>(ctx), 256, n);
+}
+
+void peek_pointer_consume(void *ctx, uint32_t n)
+{
+	ring_t *rb = static_cast<ring_t *>(ctx);
+
+	for (uint32_t i = 0; i < n; i++) {
+		size_t contiguous;
+		rb->write(data, 64);
+		bench_keep(rb->peek_pointer(0, &contiguous));
+		rb->consume(64);
+	}
+}
+
+template <size_t LEN>
+void push_pop(void *ctx, uint32_t n)
+{
+	queue_t *q = static_cast<queue_t *>(ctx);
+	uint8_t buf[128];
+
+	for (uint32_t i = 0; i < n; i++) {
+		q->push(data, LEN);
+		q->pop(buf, sizeof(buf));
+		bench_keep(buf);
+	}
+}
+
+void burst_16(void *ctx, uint32_t n)
+{
+	queue_t *q = static_cast<queue_t *>(ctx);
+	uint8_t buf[16];
+	uint32_t i = 0;
+
+	while (i < n) {
+		uint32_t queued = 0;
+		for (; i < n && q->available() > queue_t::capacity() / 2; i++) {
+			q->push(data, sizeof(buf));
+			queued++;
+		}
+		while (queued--) {
+			q->pop(buf, sizeof(buf));
+		}
+		bench_keep(buf);
+	}
+}
+
+void set_get_clear(void *ctx, uint32_t n)
+{
+	bits_t *bitmap = static_cast<bits_t *>(ctx);
+
+	for (uint32_t i = 0; i < n; i++) {
+		const size_t pos = i % bits_t::size();
+		bitmap->set(pos);
+		bench_keep(reinterpret_cast<const void *>(
+				static_cast<uintptr_t>(bitmap->get(pos))));
+		bitmap->clear(pos);
+	}
+}
+
+void count(void *ctx, uint32_t n)
+{
+	bits_t *bitmap = static_cast<bits_t *>(ctx);
+
+	bitmap->fill(true);
+
+	for (uint32_t i = 0; i < n; i++) {
+		bench_keep(reinterpret_cast<const void *>(bitmap->count()));
+	}
+}
+
+} /* namespace */
+
+extern "C" const struct bench bench_templates[] = {
+	{ "ringbuf_cxx/write_read_16", write_read_16,
+		create<ring_t>, destroy<ring_t> },
+	{ "ringbuf_cxx/write_read_256", write_read_256,
+		create<ring_t>, destroy<ring_t> },
+	{ "ringbuf_cxx/peek_pointer_consume", peek_pointer_consume,
+		create<ring_t>, destroy<ring_t> },
+	{ "msgq_cxx/push_pop_8", push_pop<8>,
+		create<queue_t>, destroy<queue_t> },
+	{ "msgq_cxx/push_pop_128", push_pop<128>,
+		create<queue_t>, destroy<queue_t> },
+	{ "msgq_cxx/burst_16", burst_16, create<queue_t>, destroy<queue_t> },
+	{ "bitmap_cxx/set_get_clear", set_get_clear,
+		create<bits_t>, destroy<bits_t> },
+	{ "bitmap_cxx/count_1000", count,
+		create<bits_t>, destroy<bits_t> },
+	{ nullptr, nullptr, nullptr, nullptr },
+};
@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+#include <pthread.h>
+#include <time.h>
+#include "libmcu/tracepoint.h"
+#include "libmcu/trace.h"
+#include "libmcu/board.h"
+
+uint64_t board_get_time_since_boot_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U;
+}
+
+void *trace_get_current_thread(void)
+{
+	return (void *)pthread_self();
+}
+
+static int setup_enabled(void **ctx)
+{
+	(void)ctx;
+	tracepoint_enable(TRACEPOINT_CATEGORY(0));
+	return 0;
+}
+
+static void teardown(void *ctx)
+{
+	(void)ctx;
+	tracepoint_disable(TRACEPOINT_CATEGORY(0));
+}
+
+static void emit(void *ctx, uint32_t n)
+{
+	(void)ctx;
+
+	for (uint32_t i = 0; i < n; i++) {
+		TRACEPOINT(TracepointMarker, i, n);
+	}
+}
+
+const struct bench bench_tracepoint[] = {
+	{ "tracepoint/disabled", emit, NULL, NULL },
+	{ "tracepoint/enabled", emit, setup_enabled, teardown },
+	{ NULL, NULL, NULL, NULL },
+};
@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if !defined(BENCH_MAX_RESULTS)
+#define BENCH_MAX_RESULTS		64U
+#endif
+
+extern const struct bench bench_ringbuf[];
+extern const struct bench bench_msgq[];
+extern const struct bench bench_msgq_shared[];
+extern const struct bench bench_pubsub[];
+extern const struct bench bench_logging[];
+extern const struct bench bench_metrics[];
+extern const struct bench bench_kvstore[];
+extern const struct bench bench_bitmap[];
+extern const struct bench bench_templates[];
+extern const struct bench bench_tracepoint[];
+
+static const struct bench *suites[] = {
+	bench_ringbuf,
+	bench_msgq,
+	bench_msgq_shared,
+	bench_pubsub,
+	bench_logging,
+	bench_metrics,
+	bench_kvstore,
+	bench_bitmap,
+	bench_templates,
+	bench_tracepoint,
+};
+
+static struct bench_result results[BENCH_MAX_RESULTS];
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-w warmup] [-r repetitions] [-n batch] "
+			"[-f filter] [-o output.json]\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+	struct bench_param param = {
+		.warmup = 10,
+		.repetitions = 100,
+		.batch = 1000,
+	};
+	const char *filter = NULL;
+	const char *output = NULL;
+	size_t n = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "w:r:n:f:o:h")) != -1) {
+		switch (opt) {
+		case 'w': param.warmup = (uint32_t)strtoul(optarg, NULL, 0); break;
+		case 'r': param.repetitions = (uint32_t)strtoul(optarg, NULL, 0); break;
+		case 'n': param.batch = (uint32_t)strtoul(optarg, NULL, 0); break;
+		case 'f': filter = optarg; break;
+		case 'o': output = optarg; break;
+		default:
+			usage(argv[0]);
+			return opt == 'h'? 0 : 1;
+		}
+	}
+
+	for (size_t i = 0; i < sizeof(suites) / sizeof(*suites); i++) {
+		for (const struct bench *b = suites[i]; b->name; b++) {
+			if (filter && !strstr(b->name, filter)) {
+				continue;
+			}
+			if (n >= BENCH_MAX_RESULTS) {
+				fprintf(stderr, "too many benchmarks\n");
+				return 1;
+			}
+
+			int err = bench_run(b, &param, &results[n]);
+			if (err) {
+				fprintf(stderr, "%s: failed %d\n", b->name, err);
+				return 1;
+			}
+
+			bench_print(stdout, &results[n++]);
+		}
+	}
+
+	if (output) {
+		FILE *fp = fopen(output, "w");
+		if (!fp) {
+			perror(output);
+			return 1;
+		}
+		bench_print_json(fp, &param, results, n);
+		fclose(fp);
+	}
+
+	return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "fake_i2c.h"
+#include <errno.h>
+#include <string.h>
+
+struct i2c_device {
+	struct i2c_device_api api;
+	uint8_t regs[FAKE_I2C_NR_REGS];
+	struct fake_i2c_stats stats;
+	int error;
+};
+
+static struct i2c_device fake_dev;
+
+static int take_error(struct i2c_device *dev)
+{
+	const int err = dev->error;
+	dev->error = 0;
+	return err;
+}
+
+static int read_reg(struct i2c_device *dev,
+		uint32_t reg_addr, uint8_t reg_addr_bits,
+		void *buf, size_t bufsize, uint32_t timeout_ms)
+{
+	const int err = take_error(dev);
+
+	(void)reg_addr_bits;
+	(void)timeout_ms;
+
+	if (err) {
+		return err;
+	}
+	if (reg_addr + bufsize > FAKE_I2C_NR_REGS) {
+		return -EINVAL;
+	}
+
+	memcpy(buf, &dev->regs[reg_addr], bufsize);
+	dev->stats.nr_reads++;
+	dev->stats.bytes_read += bufsize;
+
+	return (int)bufsize;
+}
+
+static int write_reg(struct i2c_device *dev,
+		uint32_t reg_addr, uint8_t reg_addr_bits,
+		const void *data, size_t data_len, uint32_t timeout_ms)
+{
+	const int err = take_error(dev);
+
+	(void)reg_addr_bits;
+	(void)timeout_ms;
+
+	if (err) {
+		return err;
+	}
+	if (reg_addr + data_len > FAKE_I2C_NR_REGS) {
+		return -EINVAL;
+	}
+
+	memcpy(&dev->regs[reg_addr], data, data_len);
+	dev->stats.nr_writes++;
+	dev->stats.bytes_written += data_len;
+
+	return (int)data_len;
+}
+
+struct i2c_device *fake_i2c_create_device(void)
+{
+	memset(&fake_dev, 0, sizeof(fake_dev));
+	fake_dev.api.read_reg = read_reg;
+	fake_dev.api.write_reg = write_reg;
+	return &fake_dev;
+}
+
+uint8_t *fake_i2c_regs(struct i2c_device *dev)
+{
+	return dev->regs;
+}
+
+const struct fake_i2c_stats *fake_i2c_stats(struct i2c_device *dev)
+{
+	return &dev->stats;
+}
+
+void fake_i2c_reset_stats(struct i2c_device *dev)
+{
+	memset(&dev->stats, 0, sizeof(dev->stats));
+}
+
+void fake_i2c_inject_error(struct i2c_device *dev, int err)
+{
+	dev->error = err;
+}
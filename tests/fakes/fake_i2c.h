@@ -0,0 +1,37 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef FAKE_I2C_H
+#define FAKE_I2C_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "libmcu/i2c.h"
+
+#define FAKE_I2C_NR_REGS		256
+
+struct fake_i2c_stats {
+	unsigned int nr_reads;
+	unsigned int nr_writes;
+	size_t bytes_read;
+	size_t bytes_written;
+};
+
+/* An auto-incrementing 8-bit register file on a fake bus. */
+struct i2c_device *fake_i2c_create_device(void);
+uint8_t *fake_i2c_regs(struct i2c_device *dev);
+const struct fake_i2c_stats *fake_i2c_stats(struct i2c_device *dev);
+void fake_i2c_reset_stats(struct i2c_device *dev);
+/* The next transaction fails with the error given. */
+void fake_i2c_inject_error(struct i2c_device *dev, int err);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FAKE_I2C_H */
@@ -1,66 +1,73 @@
 #include "CppUTestExt/MockSupport.h"
 #include "libmcu/spi.h"
-#include "bytearray.h"
 
 struct spi {
-	struct spi_api api;
+	uint8_t channel;
 };
 
-static int enable_spi(struct spi *self) {
-	return mock().actualCall("spi_enable").withParameter("self", self)
-		.returnIntValue();
+struct spi_device {
+	struct spi *bus;
+};
+
+struct spi *spi_create(uint8_t channel, const struct spi_pin *pin) {
+	(void)pin;
+	static struct spi spi;
+	spi.channel = channel;
+	return &spi;
 }
 
-static int disable_spi(struct spi *self) {
-	return mock().actualCall("spi_disable").withParameter("self", self)
-		.returnIntValue();
+void spi_delete(struct spi *self) {
+	mock().actualCall(__func__).withPointerParameter("self", self);
 }
 
-static int write_spi(struct spi *self, const void *data, size_t data_len) {
-	return mock().actualCall("spi_write")
-		.withParameter("self", self)
-		.withParameter("data", data)
-		.withParameter("data_len", data_len)
-		.returnIntValue();
+struct spi_device *spi_create_device(struct spi *self,
+		spi_mode_t mode, uint32_t freq_hz, int pin_cs) {
+	(void)mode;
+	(void)freq_hz;
+	(void)pin_cs;
+	static struct spi_device dev;
+	dev.bus = self;
+	return &dev;
 }
 
-static int read_spi(struct spi *self, void *buf, size_t bufsize) {
-	return mock().actualCall("spi_read")
-		.withParameter("self", self)
-		.withParameter("buf", buf)
-		.withParameter("bufsize", bufsize)
-		.returnIntValue();
+int spi_delete_device(struct spi_device *dev) {
+	return mock().actualCall(__func__).withPointerParameter("dev", dev)
+		.returnIntValueOrDefault(0);
 }
 
-static int writeread(struct spi *self, const void *txdata, size_t txdata_len,
-		void *rxbuf, size_t rxbuf_len) {
-	ByteArray txPtrLen = {
-		txdata, txdata_len
-	};
-	return mock().actualCall("spi_writeread")
-		.withParameter("self", self)
-		.withParameterOfType("ByteArray", "ptrlen", &txPtrLen)
-		.withOutputParameter("rxbuf", rxbuf)
-		.withParameter("rxbuf_len", rxbuf_len)
-		.returnIntValue();
+int spi_enable(struct spi_device *dev) {
+	return mock().actualCall(__func__).withPointerParameter("dev", dev)
+		.returnIntValueOrDefault(0);
 }
 
-struct spi *spi_create(uint8_t channel) {
-	(void)channel;
+int spi_disable(struct spi_device *dev) {
+	return mock().actualCall(__func__).withPointerParameter("dev", dev)
+		.returnIntValueOrDefault(0);
+}
 
-	static struct spi spi = {
-		.api = {
-			.enable = enable_spi,
-			.disable = disable_spi,
-			.write = write_spi,
-			.read = read_spi,
-			.writeread = writeread,
-		},
-	};
+int spi_write(struct spi_device *self, const void *data, size_t data_len) {
+	return mock().actualCall(__func__)
+		.withPointerParameter("self", self)
+		.withMemoryBufferParameter("data",
+				(const unsigned char *)data, data_len)
+		.returnIntValueOrDefault((int)data_len);
+}
 
-	return &spi;
+int spi_read(struct spi_device *self, void *buf, size_t rx_len) {
+	return mock().actualCall(__func__)
+		.withPointerParameter("self", self)
+		.withOutputParameter("buf", buf)
+		.withUnsignedIntParameter("rx_len", (unsigned int)rx_len)
+		.returnIntValueOrDefault((int)rx_len);
 }
 
-void spi_delete(struct spi *self) {
-	mock().actualCall(__func__).withParameter("self", self);
+int spi_writeread(struct spi_device *self, const void *txdata,
+		size_t txdata_len, void *rxbuf, size_t rxbuf_len) {
+	return mock().actualCall(__func__)
+		.withPointerParameter("self", self)
+		.withMemoryBufferParameter("txdata",
+				(const unsigned char *)txdata, txdata_len)
+		.withOutputParameter("rxbuf", rxbuf)
+		.withUnsignedIntParameter("rxbuf_len", (unsigned int)rxbuf_len)
+		.returnIntValueOrDefault((int)rxbuf_len);
 }
@@ -0,0 +1,22 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = adc_pipeline
+
+SRC_FILES = \
+	stubs/bitops.c \
+	../modules/common/src/ringbuf.c \
+	../interfaces/adc/src/adc_pipeline.c \
+
+TEST_SRC_FILES = \
+	src/adc/adc_pipeline_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../interfaces/adc/include \
+	../modules/common/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS =
+
+include runners/MakefileRunner
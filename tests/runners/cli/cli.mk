@@ -3,7 +3,8 @@
 COMPONENT_NAME = cli
 
 SRC_FILES = \
-	../modules/cli/src/cli.c
+	../modules/cli/src/cli.c \
+	../modules/common/src/arena.c \
 
 TEST_SRC_FILES = \
 	src/cli/cli_test.cpp \
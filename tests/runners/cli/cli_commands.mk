@@ -5,7 +5,11 @@ COMPONENT_NAME = cli_commands
 SRC_FILES = \
 	../examples/cli/cmd_exit.c \
 	../examples/cli/cmd_info.c \
-	../examples/cli/cmd_memdump.c
+	../examples/cli/cmd_memdump.c \
+	../examples/cli/cmd_lockstat.c \
+	../modules/common/src/lockstat.c \
+	../examples/cli/cmd_prof.c \
+	../ports/posix/profiler.c \
 
 TEST_SRC_FILES = \
 	src/cli/cli_commands_test.cpp \
@@ -16,9 +20,12 @@ INCLUDE_DIRS = \
 	../examples/cli \
 	../modules/cli/include \
 	../modules/common/include \
+	../modules/trace/include \
+	../ports/posix/include \
 	$(CPPUTEST_HOME)/include \
 
 MOCKS_SRC_DIRS =
 CPPUTEST_CPPFLAGS =
+CPPUTEST_LDFLAGS = -lpthread -lrt -ldl
 
 include runners/MakefileRunner
@@ -0,0 +1,23 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = flash_cache
+
+SRC_FILES = \
+	../ports/flash/flash_cache.c \
+	../ports/kvstore/flash_kvstore.c \
+	../modules/common/src/hash.c \
+
+TEST_SRC_FILES = \
+	src/common/flash_cache_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/common/include \
+	../interfaces/flash/include \
+	../interfaces/kvstore/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS =
+
+include runners/MakefileRunner
@@ -8,7 +8,7 @@ SRC_FILES = \
 
 TEST_SRC_FILES = \
 	src/common/flash_kvstore_test.cpp \
-	stubs/logging.cpp \
+	stubs/logging.c \
 	src/test_all.cpp \
 
 INCLUDE_DIRS = \
@@ -0,0 +1,22 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = flash_kvstore_names
+
+SRC_FILES = \
+	../ports/kvstore/flash_kvstore.c \
+	../modules/common/src/hash.c
+
+TEST_SRC_FILES = \
+	src/common/flash_kvstore_names_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/common/include \
+	../interfaces/flash/include \
+	../interfaces/kvstore/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS = -DFLASH_KVSTORE_KEY_NAMES
+
+include runners/MakefileRunner
@@ -0,0 +1,19 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = lockstat
+
+SRC_FILES = \
+	../modules/common/src/lockstat.c \
+
+TEST_SRC_FILES = \
+	src/common/lockstat_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/common/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS = -DLOCKSTAT_ENABLED
+
+include runners/MakefileRunner
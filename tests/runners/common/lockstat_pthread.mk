@@ -0,0 +1,22 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = lockstat_pthread
+
+SRC_FILES = \
+	../ports/posix/lockstat_pthread.c \
+	../modules/common/src/lockstat.c \
+
+TEST_SRC_FILES = \
+	src/common/lockstat_pthread_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/common/include \
+	../ports/posix/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS = -DLOCKSTAT_ENABLED
+CPPUTEST_LDFLAGS = -lpthread
+
+include runners/MakefileRunner
@@ -0,0 +1,23 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = MessageQueueOverwrite
+
+SRC_FILES = \
+	../modules/common/src/msgq.c \
+	../modules/common/src/ringbuf.c \
+	../modules/common/src/bitops.c \
+	stubs/bitops.c \
+
+TEST_SRC_FILES = \
+	src/common/msgq_overwrite_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/common/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS =
+CPPUTEST_LDFLAGS = -Wl,--wrap=ringbuf_peek
+
+include runners/MakefileRunner
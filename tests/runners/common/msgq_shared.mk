@@ -0,0 +1,21 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = MessageQueueShared
+
+SRC_FILES = \
+	../ports/posix/msgq_shared.c \
+
+TEST_SRC_FILES = \
+	src/common/msgq_shared_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/common/include \
+	../ports/posix/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS =
+CPPUTEST_LDFLAGS = -lpthread -lrt
+
+include runners/MakefileRunner
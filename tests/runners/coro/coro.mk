@@ -0,0 +1,26 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = Coroutine
+
+SRC_FILES = \
+	../modules/coro/src/coro.c \
+	../modules/common/src/msgq.c \
+	../modules/common/src/ringbuf.c \
+	../modules/common/src/bitops.c \
+	stubs/bitops.c \
+
+TEST_SRC_FILES = \
+	src/coro/coro_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/coro/include \
+	../modules/common/include \
+	../interfaces/l4/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS = -DUNITTEST
+CPPUTEST_LDFLAGS = -lpthread
+
+include runners/MakefileRunner
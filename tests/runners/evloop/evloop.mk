@@ -0,0 +1,20 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = EVLOOP
+
+SRC_FILES = \
+	../ports/posix/evloop.c \
+
+TEST_SRC_FILES = \
+	src/evloop/evloop_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../interfaces/evloop/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS = -DUNITTEST
+CPPUTEST_LDFLAGS = -lpthread
+
+include runners/MakefileRunner
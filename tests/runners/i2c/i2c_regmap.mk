@@ -0,0 +1,21 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = i2c_regmap
+
+SRC_FILES = \
+	../interfaces/i2c/src/i2c_regmap.c \
+	fakes/fake_i2c.c \
+
+TEST_SRC_FILES = \
+	src/i2c/i2c_regmap_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../interfaces/i2c/include \
+	fakes \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS =
+
+include runners/MakefileRunner
@@ -0,0 +1,24 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = l4pool
+
+SRC_FILES = \
+	../modules/l4pool/src/l4pool.c \
+	../modules/retry/src/retry.c \
+
+TEST_SRC_FILES = \
+	src/l4pool/l4pool_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/l4pool/include \
+	../modules/retry/include \
+	../modules/common/include \
+	../interfaces/l4/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS =
+CPPUTEST_LDFLAGS = -lpthread
+
+include runners/MakefileRunner
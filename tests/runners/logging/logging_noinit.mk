@@ -0,0 +1,22 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = logging_noinit
+
+SRC_FILES = \
+	../modules/logging/src/logging_noinit.c \
+	../modules/common/src/crc16.c \
+
+TEST_SRC_FILES = \
+	src/logging/logging_noinit_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/logging/include \
+	../modules/common/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS =
+CPPUTEST_LDFLAGS = -lpthread
+
+include runners/MakefileRunner
@@ -0,0 +1,32 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = metrics_shm
+
+SRC_FILES = \
+	../ports/posix/metrics_shm.c \
+	../ports/posix/metrics_shm_reader.c \
+	../modules/metrics/src/metrics.c \
+	../modules/metrics/src/metrics_overrides.c \
+
+TEST_SRC_FILES = \
+	src/metrics/metrics_shm_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	src/metrics \
+	../modules/metrics/include \
+	stubs/overrides \
+	../modules/common/include \
+	../ports/posix/include \
+	$(CPPUTEST_HOME)/include \
+
+CPPUTEST_CPPFLAGS = \
+	-DMETRICS_USER_DEFINES=\"my_metrics.def\" \
+	-DMETRICS_SHM_NAME=\"/libmcu_metrics_test\" \
+	-DLIBMCU_NOINIT=
+
+CPPUTEST_LDFLAGS = -lpthread -lrt
+
+MOCKS_SRC_DIRS =
+
+include runners/MakefileRunner
@@ -4,6 +4,7 @@ COMPONENT_NAME = PM
 
 SRC_FILES = \
 	../modules/pm/src/pm.c \
+	../modules/common/src/deadline.c \
 
 TEST_SRC_FILES = \
 	src/pm/pm_test.cpp \
@@ -11,6 +12,7 @@ TEST_SRC_FILES = \
 
 INCLUDE_DIRS = \
 	../modules/pm/include \
+	../modules/common/include \
 	$(CPPUTEST_HOME)/include \
 
 MOCKS_SRC_DIRS =
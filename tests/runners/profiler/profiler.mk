@@ -0,0 +1,22 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = profiler
+
+SRC_FILES = \
+	../ports/posix/profiler.c \
+
+TEST_SRC_FILES = \
+	src/profiler/profiler_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/common/include \
+	../modules/trace/include \
+	../ports/posix/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS = -fno-omit-frame-pointer
+CPPUTEST_LDFLAGS = -lpthread -lrt -ldl
+
+include runners/MakefileRunner
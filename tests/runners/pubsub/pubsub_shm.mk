@@ -0,0 +1,24 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = pubsub_shm
+
+SRC_FILES = \
+	../modules/pubsub/src/pubsub.c \
+	../ports/posix/pubsub_shm.c \
+
+TEST_SRC_FILES = \
+	src/pubsub/pubsub_shm_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	stubs/overrides \
+	../modules/pubsub/include \
+	../modules/common/include \
+	../ports/posix/include \
+	$(CPPUTEST_HOME)/include \
+
+CPPUTEST_LDFLAGS = -lpthread -lrt
+
+MOCKS_SRC_DIRS =
+
+include runners/MakefileRunner
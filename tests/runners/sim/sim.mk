@@ -0,0 +1,22 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = SIM
+
+SRC_FILES = \
+	../ports/posix/sim.c \
+	../modules/common/src/deadline.c \
+
+TEST_SRC_FILES = \
+	src/sim/sim_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../modules/common/include \
+	../ports/posix/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS = -DUNITTEST
+CPPUTEST_LDFLAGS = -lpthread
+
+include runners/MakefileRunner
@@ -0,0 +1,21 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = spi
+
+SRC_FILES = \
+	../interfaces/spi/src/spi.c \
+	mocks/spi.cpp \
+
+TEST_SRC_FILES = \
+	src/spi/spi_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../interfaces/spi/include \
+	../modules/common/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS =
+
+include runners/MakefileRunner
@@ -0,0 +1,24 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = tracepoint
+
+SRC_FILES = \
+	../modules/trace/src/tracepoint.c \
+
+TEST_SRC_FILES = \
+	src/trace/tracepoint_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	src/trace \
+	../modules/trace/include \
+	../modules/common/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS = \
+	-DTRACEPOINT_USER_DEFINES=\"my_tracepoints.def\" \
+	-DTRACEPOINT_BUFFER_LEN=8 \
+	-DTRACEPOINT_MAX_CPUS=2 \
+
+include runners/MakefileRunner
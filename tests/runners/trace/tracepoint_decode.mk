@@ -0,0 +1,9 @@
+# SPDX-License-Identifier: MIT
+
+# tools/scripts/tracepoint_decode.py is tested with the Python unittest
+# instead of CppUTest.
+
+.PHONY: all start gcov debug flags
+all:
+	python3 src/trace/tracepoint_decode_test.py
+start gcov debug flags:
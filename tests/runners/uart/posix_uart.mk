@@ -0,0 +1,25 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = posix_uart
+
+SRC_FILES = \
+	stubs/bitops.c \
+	../modules/common/src/ringbuf.c \
+	../interfaces/uart/src/uart_rx.c \
+	../ports/posix/uart.c \
+
+TEST_SRC_FILES = \
+	src/uart/posix_uart_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../interfaces/uart/include \
+	../ports/posix/include \
+	../modules/common/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS =
+CPPUTEST_LDFLAGS = -lpthread
+
+include runners/MakefileRunner
@@ -0,0 +1,22 @@
+# SPDX-License-Identifier: MIT
+
+COMPONENT_NAME = uart_rx
+
+SRC_FILES = \
+	stubs/bitops.c \
+	../modules/common/src/ringbuf.c \
+	../interfaces/uart/src/uart_rx.c \
+
+TEST_SRC_FILES = \
+	src/uart/uart_rx_test.cpp \
+	src/test_all.cpp \
+
+INCLUDE_DIRS = \
+	../interfaces/uart/include \
+	../modules/common/include \
+	$(CPPUTEST_HOME)/include \
+
+MOCKS_SRC_DIRS =
+CPPUTEST_CPPFLAGS =
+
+include runners/MakefileRunner
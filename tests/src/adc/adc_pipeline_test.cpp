@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include "libmcu/adc_pipeline.h"
+#include "libmcu/ringbuf.h"
+
+TEST_GROUP(ADCPipeline) {
+	struct ringbuf in;
+	struct ringbuf out;
+	uint8_t in_space[64];
+	uint8_t out_space[64];
+	struct adc_pipeline *pipeline;
+
+	void setup(void) {
+		ringbuf_create_static(&in, in_space, sizeof(in_space));
+		ringbuf_create_static(&out, out_space, sizeof(out_space));
+		pipeline = NULL;
+	}
+	void teardown(void) {
+		adc_pipeline_destroy(pipeline);
+	}
+
+	void create(uint8_t nr_channels, uint8_t order, uint16_t decimation,
+			uint8_t frac_bits, uint16_t window_len) {
+		struct adc_pipeline_param param = {
+			.nr_channels = nr_channels,
+			.cic_order = order,
+			.decimation = decimation,
+			.frac_bits = frac_bits,
+			.window_len = window_len,
+		};
+		pipeline = adc_pipeline_create(&param);
+		CHECK(pipeline != NULL);
+	}
+	void feed(const uint16_t *samples, size_t n) {
+		LONGS_EQUAL(n * sizeof(*samples),
+				ringbuf_write(&in, samples, n * sizeof(*samples)));
+	}
+	int32_t pop(void) {
+		int32_t v = 0;
+		LONGS_EQUAL(sizeof(v), ringbuf_read(&out, 0, &v, sizeof(v)));
+		return v;
+	}
+};
+
+TEST(ADCPipeline, create_ShouldReturnNull_WhenInvalidParamsGiven) {
+	struct adc_pipeline_param param = {
+		.nr_channels = 1, .cic_order = 1, .decimation = 4,
+	};
+	param.nr_channels = ADC_PIPELINE_MAX_CHANNELS + 1;
+	POINTERS_EQUAL(NULL, adc_pipeline_create(&param));
+	param.nr_channels = 1;
+	param.cic_order = 0;
+	POINTERS_EQUAL(NULL, adc_pipeline_create(&param));
+	param.cic_order = ADC_PIPELINE_MAX_CIC_ORDER + 1;
+	POINTERS_EQUAL(NULL, adc_pipeline_create(&param));
+	param.cic_order = 1;
+	param.decimation = 0;
+	POINTERS_EQUAL(NULL, adc_pipeline_create(&param));
+	param.decimation = 4;
+	param.frac_bits = 16;
+	POINTERS_EQUAL(NULL, adc_pipeline_create(&param));
+}
+
+TEST(ADCPipeline, create_ShouldReturnNull_WhenGainOverflows) {
+	struct adc_pipeline_param param = {
+		.nr_channels = 1, .cic_order = 3, .decimation = 41,
+	};
+	POINTERS_EQUAL(NULL, adc_pipeline_create(&param));
+	param.decimation = 40;
+	pipeline = adc_pipeline_create(&param);
+	CHECK(pipeline != NULL);
+}
+
+TEST(ADCPipeline, process_ShouldAverage_WhenMovingAverageDecimation) {
+	const uint16_t samples[] = { 10, 20, 30, 40, 100, 100, 100, 104 };
+	create(1, 1, 4, 0, 0);
+	feed(samples, 8);
+
+	LONGS_EQUAL(2, adc_pipeline_process(pipeline, &in, &out));
+	LONGS_EQUAL(25, pop());
+	LONGS_EQUAL(101, pop());
+	LONGS_EQUAL(0, ringbuf_length(&in));
+}
+
+TEST(ADCPipeline, process_ShouldKeepPartialDecimation_WhenNotEnoughInput) {
+	const uint16_t samples[] = { 8, 8, 8, 8 };
+	create(1, 1, 4, 0, 0);
+	feed(samples, 3);
+	LONGS_EQUAL(0, adc_pipeline_process(pipeline, &in, &out));
+	feed(&samples[3], 1);
+	LONGS_EQUAL(1, adc_pipeline_process(pipeline, &in, &out));
+	LONGS_EQUAL(8, pop());
+}
+
+TEST(ADCPipeline, process_ShouldGainResolution_WhenOversampling) {
+	/* 4^2 samples with 2 fractional bits: 1 more LSB in 4 samples of 16
+	 * shows up as a quarter LSB */
+	uint16_t samples[16];
+	for (int i = 0; i < 16; i++) {
+		samples[i] = (uint16_t)(100 + (i < 4));
+	}
+	create(1, 1, 16, 2, 0);
+	feed(samples, 16);
+	LONGS_EQUAL(1, adc_pipeline_process(pipeline, &in, &out));
+	LONGS_EQUAL(401, pop());
+}
+
+TEST(ADCPipeline, process_ShouldSettleToInput_WhenHigherOrderCIC) {
+	uint16_t samples[8];
+	for (int i = 0; i < 8; i++) {
+		samples[i] = 1000;
+	}
+	create(1, 3, 2, 0, 0);
+
+	for (int i = 0; i < 4; i++) {
+		feed(samples, 8);
+		adc_pipeline_process(pipeline, &in, NULL);
+	}
+	feed(samples, 2);
+	LONGS_EQUAL(1, adc_pipeline_process(pipeline, &in, &out));
+	LONGS_EQUAL(1000, pop());
+}
+
+TEST(ADCPipeline, process_ShouldHandleMultipleChannels) {
+	const uint16_t frames[] = { 1, 100, 3, 300 };
+	int32_t outputs[2];
+	create(2, 1, 2, 0, 0);
+	feed(frames, 4);
+	LONGS_EQUAL(1, adc_pipeline_process(pipeline, &in, &out));
+	LONGS_EQUAL(sizeof(outputs), ringbuf_read(&out, 0, outputs, sizeof(outputs)));
+	LONGS_EQUAL(2, outputs[0]);
+	LONGS_EQUAL(200, outputs[1]);
+}
+
+TEST(ADCPipeline, process_ShouldHandleFrameWrappingAround) {
+	const uint16_t frames[] = { 1, 2, 3 };
+	uint8_t pad[62];
+	create(3, 1, 1, 0, 0);
+
+	ringbuf_write(&in, pad, sizeof(pad));
+	ringbuf_consume(&in, sizeof(pad));
+	feed(frames, 3);
+
+	LONGS_EQUAL(1, adc_pipeline_process(pipeline, &in, &out));
+	LONGS_EQUAL(1, pop());
+	LONGS_EQUAL(2, pop());
+	LONGS_EQUAL(3, pop());
+}
+
+TEST(ADCPipeline, process_ShouldStopAndKeepInput_WhenOutputIsFull) {
+	uint16_t samples[20];
+	memset(samples, 0, sizeof(samples));
+	create(1, 1, 1, 0, 0);
+	feed(samples, 20);
+
+	LONGS_EQUAL(16, adc_pipeline_process(pipeline, &in, &out));
+	LONGS_EQUAL(4 * sizeof(uint16_t), ringbuf_length(&in));
+}
+
+TEST(ADCPipeline, get_window_ShouldReturnEAGAIN_WhenNoWindowCompleted) {
+	struct adc_window window;
+	create(1, 1, 1, 0, 4);
+	LONGS_EQUAL(-EAGAIN, adc_pipeline_get_window(pipeline, 0, &window));
+	LONGS_EQUAL(-EINVAL, adc_pipeline_get_window(pipeline, 1, &window));
+}
+
+TEST(ADCPipeline, get_window_ShouldReturnMinMaxMean_WhenWindowCompleted) {
+	const uint16_t frames[] = {
+		5, 50, 1, 10, 9, 90, 3, 30,
+		100, 100,
+	};
+	struct adc_window window;
+	create(2, 1, 1, 0, 4);
+	feed(frames, 10);
+	adc_pipeline_process(pipeline, &in, NULL);
+
+	LONGS_EQUAL(0, adc_pipeline_get_window(pipeline, 0, &window));
+	LONGS_EQUAL(1, window.min);
+	LONGS_EQUAL(9, window.max);
+	LONGS_EQUAL(4, window.mean);
+	LONGS_EQUAL(0, adc_pipeline_get_window(pipeline, 1, &window));
+	LONGS_EQUAL(10, window.min);
+	LONGS_EQUAL(90, window.max);
+	LONGS_EQUAL(45, window.mean);
+}
+
+TEST(ADCPipeline, reset_ShouldClearStates) {
+	const uint16_t samples[] = { 100, 100, 0, 0 };
+	struct adc_window window;
+	create(1, 1, 2, 0, 1);
+	feed(samples, 1);
+	adc_pipeline_process(pipeline, &in, &out);
+	adc_pipeline_reset(pipeline);
+
+	feed(&samples[2], 2);
+	LONGS_EQUAL(1, adc_pipeline_process(pipeline, &in, &out));
+	LONGS_EQUAL(0, pop());
+	LONGS_EQUAL(0, adc_pipeline_get_window(pipeline, 0, &window));
+	LONGS_EQUAL(0, window.max);
+}
@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+
+#include "libmcu/bitmap.hpp"
+
+TEST_GROUP(BitmapTemplate) {
+	void setup(void) {
+	}
+	void teardown(void) {
+	}
+};
+
+TEST(BitmapTemplate, ShouldBeClearedByDefault) {
+	libmcu::Bitmap<70> bitmap;
+	LONGS_EQUAL(0, bitmap.count());
+	CHECK_FALSE(bitmap.get(69));
+}
+
+TEST(BitmapTemplate, ShouldCountOnlyValidBits_WhenFilled) {
+	libmcu::Bitmap<70> bitmap(true);
+	LONGS_EQUAL(70, bitmap.count());
+	libmcu::Bitmap<64> full(true);
+	LONGS_EQUAL(64, full.count());
+}
+
+TEST(BitmapTemplate, setAndClear_ShouldChangeTheBit) {
+	libmcu::Bitmap<70> bitmap;
+	bitmap.set(0);
+	bitmap.set(65);
+	CHECK_TRUE(bitmap.get(0));
+	CHECK_TRUE(bitmap.get(65));
+	LONGS_EQUAL(2, bitmap.count());
+	bitmap.clear(65);
+	CHECK_FALSE(bitmap.get(65));
+	LONGS_EQUAL(1, bitmap.count());
+}
+
+TEST(BitmapTemplate, data_ShouldBeCompatibleWithCApi) {
+	libmcu::Bitmap<70> bitmap;
+	bitmap.set(33);
+	CHECK_TRUE(bitmap_get(bitmap.data(), 33));
+	bitmap_set(bitmap.data(), 68);
+	CHECK_TRUE(bitmap.get(68));
+	LONGS_EQUAL(bitmap.count(), bitmap_count(bitmap.data(), 70));
+}
@@ -9,6 +9,9 @@
 #include <stdlib.h>
 #include "libmcu/board.h"
 #include "libmcu/cli.h"
+#include "libmcu/lockstat.h"
+#include "libmcu/profiler.h"
+#include "libmcu/trace.h"
 
 const char *board_get_version_string(void) {
 	return "version";
@@ -19,6 +22,12 @@ const char *board_get_build_date_string(void) {
 const char *board_get_serial_number_string(void) {
 	return "serial number";
 }
+uint64_t board_get_time_since_boot_us(void) {
+	return 0;
+}
+void *trace_get_current_thread(void) {
+	return NULL;
+}
 
 static char write_spy_buffer[1024];
 static size_t write_spy_buffer_index;
@@ -33,7 +42,7 @@ static struct cli_io io = {
 	.write = write_spy,
 };
 
-DEFINE_CLI_CMD_LIST(cli_commands, exit, info, md);
+DEFINE_CLI_CMD_LIST(cli_commands, exit, info, md, lockstat, prof);
 
 TEST_GROUP(cli_commands) {
 	struct cli cli;
@@ -79,6 +88,59 @@ TEST(cli_commands, info_ShouldReturnBuildDate_WhenSecondArgumentGiven) {
 	STRCMP_EQUAL("build date\n", write_spy_buffer);
 }
 
+TEST(cli_commands, lockstat_ShouldReturnInvalidParam_WhenUnknownArgGiven) {
+	const char *argv[] = { "lockstat", "clear", };
+	LONGS_EQUAL(CLI_CMD_INVALID_PARAM, cli_cmd_lockstat.func(2, argv, &cli));
+}
+
+TEST(cli_commands, lockstat_ShouldPrintStatistics_WhenLockAcquired) {
+	static struct lockstat test_lock = { "test_lock", };
+	const char *argv[] = { "lockstat", };
+
+	lockstat_acquired(&test_lock, 2048, true, (const void *)0x1234);
+	lockstat_released(&test_lock);
+
+	LONGS_EQUAL(CLI_CMD_SUCCESS, cli_cmd_lockstat.func(1, argv, &cli));
+	STRCMP_EQUAL("test_lock: 1 acquired, 1 contended\n"
+			"  wait avg/max: 2048/2048ns, hold avg/max: 0/0ns\n"
+			"  wait: 2048ns+=1\n"
+			"  hold: 0ns+=1\n"
+			"  holder 0x1234: 1 times, 0ns\n",
+			write_spy_buffer);
+
+	const char *argv2[] = { "lockstat", "reset", };
+	LONGS_EQUAL(CLI_CMD_SUCCESS, cli_cmd_lockstat.func(2, argv2, &cli));
+	LONGS_EQUAL(0, test_lock.acquisitions);
+}
+
+TEST(cli_commands, prof_ShouldReturnInvalidParam_WhenNoArgGiven) {
+	const char *argv[] = { "prof", };
+	LONGS_EQUAL(CLI_CMD_INVALID_PARAM, cli_cmd_prof.func(1, argv, &cli));
+}
+
+TEST(cli_commands, prof_ShouldReturnInvalidParam_WhenUnknownArgGiven) {
+	const char *argv[] = { "prof", "pause", };
+	LONGS_EQUAL(CLI_CMD_INVALID_PARAM, cli_cmd_prof.func(2, argv, &cli));
+}
+
+TEST(cli_commands, prof_ShouldStartAndStop) {
+	const char *start[] = { "prof", "start", "100", };
+	const char *stop[] = { "prof", "stop", };
+
+	LONGS_EQUAL(CLI_CMD_SUCCESS, cli_cmd_prof.func(3, start, &cli));
+	LONGS_EQUAL(CLI_CMD_ERROR, cli_cmd_prof.func(3, start, &cli));
+	LONGS_EQUAL(CLI_CMD_SUCCESS, cli_cmd_prof.func(2, stop, &cli));
+}
+
+TEST(cli_commands, prof_ShouldPrintDropped_WhenDumped) {
+	const char *reset[] = { "prof", "reset", };
+	const char *dump[] = { "prof", "dump", };
+
+	LONGS_EQUAL(CLI_CMD_SUCCESS, cli_cmd_prof.func(2, reset, &cli));
+	LONGS_EQUAL(CLI_CMD_SUCCESS, cli_cmd_prof.func(2, dump, &cli));
+	STRCMP_EQUAL("dropped: 0\n", write_spy_buffer);
+}
+
 TEST_GROUP(memdump) {
 	uint8_t memsrc[1024];
 	char addr[32];
@@ -7,6 +7,7 @@
 #include "CppUTest/TestHarness.h"
 #include <string.h>
 #include "libmcu/cli.h"
+#include "libmcu/arena.h"
 
 #define CTRL_C 0x03
 #define CTRL_P 0x10
@@ -25,6 +26,16 @@ DEFINE_CLI_CMD(args, "") {
 	cli->io->write(buf, (size_t)len);
 	return CLI_CMD_SUCCESS;
 }
+static void *scratch_allocated[2];
+static int scratch_count;
+DEFINE_CLI_CMD(scratch, NULL) {
+	struct cli const *cli = (struct cli const *)env;
+	if (!cli->arena || arena_default() != cli->arena) {
+		return CLI_CMD_ERROR;
+	}
+	scratch_allocated[scratch_count++ % 2] = arena_alloc(cli->arena, 32);
+	return CLI_CMD_SUCCESS;
+}
 DEFINE_CLI_CMD(error, NULL) {
 	return CLI_CMD_ERROR;
 }
@@ -65,7 +76,8 @@ TEST_GROUP(cli) {
 		write_index = 0;
 		read_index = 0;
 
-		DEFINE_CLI_CMD_LIST(cmd_list, exit, args, error, invalid);
+		DEFINE_CLI_CMD_LIST(cmd_list, exit, args, error, invalid,
+				scratch);
 		cli_init(&cli, &io, cli_buffer, sizeof(cli_buffer), 0);
 		cli_register_cmdlist(&cli, cmd_list);
 	}
@@ -206,3 +218,26 @@ TEST(cli, ShouldPrintNewLine_WhenCtrlCGiven) {
 	cli_run(&cli, NULL);
 	then("$ arg\n");
 }
+
+TEST(cli, ShouldReturnError_WhenNoArenaGiven) {
+	given("scratch\nexit\n");
+	cli_run(&cli, NULL);
+	then("$ scratch\nERROR\n");
+}
+
+TEST(cli, ShouldReleaseArenaAllocations_WhenCommandReturns) {
+	uint64_t buf[16];
+	struct arena arena;
+	arena_init(&arena, buf, sizeof(buf));
+	cli_set_arena(&cli, &arena);
+	scratch_count = 0;
+
+	given("scratch\nscratch\nexit\n");
+	cli_run(&cli, NULL);
+
+	LONGS_EQUAL(2, scratch_count);
+	CHECK(scratch_allocated[0] != NULL);
+	POINTERS_EQUAL(scratch_allocated[0], scratch_allocated[1]);
+	LONGS_EQUAL(0, arena_used(&arena));
+	POINTERS_EQUAL(NULL, arena_default());
+}
@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include "libmcu/arena.h"
+
+TEST_GROUP(arena) {
+	struct arena arena;
+	uint64_t buf[32];
+
+	void setup(void) {
+		arena_init(&arena, buf, sizeof(buf));
+	}
+	void teardown(void) {
+		arena_deinit(&arena);
+		arena_set_default(NULL);
+	}
+};
+
+TEST(arena, alloc_ShouldReturnMemoryFromGivenBuffer) {
+	uint8_t *p = (uint8_t *)arena_alloc(&arena, 16);
+
+	CHECK(p != NULL);
+	CHECK(p >= (uint8_t *)buf && p + 16 <= (uint8_t *)buf + sizeof(buf));
+	memset(p, 0xa5, 16);
+}
+
+TEST(arena, alloc_ShouldReturnDistinctMemory) {
+	uint8_t *p1 = (uint8_t *)arena_alloc(&arena, 10);
+	uint8_t *p2 = (uint8_t *)arena_alloc(&arena, 10);
+
+	CHECK(p2 >= p1 + 10);
+}
+
+TEST(arena, alloc_ShouldAlignToDefault) {
+	arena_alloc(&arena, 1);
+	uintptr_t p = (uintptr_t)arena_alloc(&arena, 1);
+
+	LONGS_EQUAL(0, p % ARENA_DEFAULT_ALIGN);
+}
+
+TEST(arena, alloc_aligned_ShouldAlignToGivenAlignment) {
+	arena_alloc_aligned(&arena, 1, 1);
+	uintptr_t p1 = (uintptr_t)arena_alloc_aligned(&arena, 1, 1);
+	uintptr_t p2 = (uintptr_t)arena_alloc_aligned(&arena, 1, 32);
+
+	LONGS_EQUAL(0, p2 % 32);
+	CHECK(p1 < p2);
+}
+
+TEST(arena, alloc_aligned_ShouldReturnNull_WhenAlignmentIsNotPowerOfTwo) {
+	POINTERS_EQUAL(NULL, arena_alloc_aligned(&arena, 1, 0));
+	POINTERS_EQUAL(NULL, arena_alloc_aligned(&arena, 1, 12));
+}
+
+TEST(arena, alloc_ShouldReturnNull_WhenNoSpaceLeft) {
+	POINTERS_EQUAL(NULL, arena_alloc(&arena, sizeof(buf)));
+	CHECK(arena_alloc(&arena, 64) != NULL);
+}
+
+TEST(arena, restore_ShouldReleaseAllocationsAfterMark) {
+	arena_alloc(&arena, 8);
+	const size_t used = arena_used(&arena);
+	arena_mark_t mark;
+
+	arena_save(&arena, &mark);
+	void *p = arena_alloc(&arena, 32);
+	arena_alloc(&arena, 32);
+	arena_restore(&arena, &mark);
+
+	LONGS_EQUAL(used, arena_used(&arena));
+	POINTERS_EQUAL(p, arena_alloc(&arena, 32));
+}
+
+TEST(arena, scope_ShouldReleaseAllocationsAtTheEnd) {
+	arena_alloc(&arena, 8);
+	const size_t used = arena_used(&arena);
+
+	ARENA_SCOPE(&arena) {
+		CHECK(arena_alloc(&arena, 64) != NULL);
+		CHECK(arena_used(&arena) > used);
+	}
+
+	LONGS_EQUAL(used, arena_used(&arena));
+}
+
+TEST(arena, reset_ShouldReleaseEverything) {
+	arena_alloc(&arena, 8);
+	arena_alloc(&arena, 8);
+	arena_reset(&arena);
+	LONGS_EQUAL(0, arena_used(&arena));
+}
+
+TEST(arena, add_ShouldChainBuffers_WhenFirstIsFull) {
+	uint64_t buf2[16];
+
+	LONGS_EQUAL(0, arena_add(&arena, buf2, sizeof(buf2)));
+	arena_alloc(&arena, sizeof(buf) - 64);
+	uint8_t *p = (uint8_t *)arena_alloc(&arena, 64);
+
+	CHECK(p >= (uint8_t *)buf2 && p + 64 <= (uint8_t *)buf2 + sizeof(buf2));
+}
+
+TEST(arena, add_ShouldReturnEINVAL_WhenBufferTooSmall) {
+	uint64_t small[1];
+	LONGS_EQUAL(-EINVAL, arena_add(&arena, small, sizeof(small)));
+	LONGS_EQUAL(-EINVAL, arena_add(&arena, NULL, 128));
+}
+
+TEST(arena, restore_ShouldRewindAcrossBlocks) {
+	uint64_t buf2[16];
+	arena_mark_t mark;
+
+	arena_add(&arena, buf2, sizeof(buf2));
+	arena_alloc(&arena, 16);
+	arena_save(&arena, &mark);
+	void *p = arena_alloc(&arena, 16);
+	arena_alloc(&arena, sizeof(buf)); /* does not fit in the first */
+	arena_alloc(&arena, 64);
+	arena_restore(&arena, &mark);
+
+	POINTERS_EQUAL(p, arena_alloc(&arena, 16));
+}
+
+TEST(arena, chained_ShouldAllocateBlocksOnDemand) {
+	struct arena chained;
+	arena_init_chained(&chained, 64);
+
+	void *p1 = arena_alloc(&chained, 48);
+	void *p2 = arena_alloc(&chained, 48);
+	void *p3 = arena_alloc(&chained, 200); /* larger than a block */
+
+	CHECK(p1 && p2 && p3);
+	memset(p3, 0, 200);
+	CHECK(arena_used(&chained) >= 48 + 48 + 200);
+
+	arena_deinit(&chained);
+}
+
+TEST(arena, chained_ShouldReuseBlocks_WhenRestored) {
+	struct arena chained;
+	arena_mark_t mark;
+	arena_init_chained(&chained, 64);
+
+	arena_save(&chained, &mark);
+	void *p1 = arena_alloc(&chained, 48);
+	void *p2 = arena_alloc(&chained, 48);
+	arena_restore(&chained, &mark);
+
+	POINTERS_EQUAL(p1, arena_alloc(&chained, 48));
+	POINTERS_EQUAL(p2, arena_alloc(&chained, 48));
+
+	arena_deinit(&chained);
+}
+
+TEST(arena, default_ShouldReturnWhatIsSet) {
+	POINTERS_EQUAL(NULL, arena_default());
+	POINTERS_EQUAL(NULL, arena_set_default(&arena));
+	POINTERS_EQUAL(&arena, arena_default());
+}
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <errno.h>
+
+#include "libmcu/deadline.h"
+
+static uint32_t t1, t2;
+
+static uint32_t source_1(void) {
+	return t1;
+}
+
+static uint32_t source_2(void) {
+	return t2;
+}
+
+TEST_GROUP(Deadline) {
+	void setup(void) {
+		t1 = t2 = DEADLINE_NONE;
+	}
+	void teardown(void) {
+		deadline_unregister(source_1);
+		deadline_unregister(source_2);
+	}
+};
+
+TEST(Deadline, next_ShouldReturnNone_WhenNoSourceRegistered) {
+	LONGS_EQUAL(DEADLINE_NONE, deadline_next_ms());
+}
+
+TEST(Deadline, next_ShouldReturnEarliestOfAllSources) {
+	deadline_register(source_1);
+	deadline_register(source_2);
+	t1 = 100;
+	t2 = 30;
+	LONGS_EQUAL(30, deadline_next_ms());
+	t1 = 0;
+	LONGS_EQUAL(0, deadline_next_ms());
+}
+
+TEST(Deadline, next_ShouldIgnoreSource_WhenUnregistered) {
+	deadline_register(source_1);
+	deadline_register(source_2);
+	t1 = 100;
+	t2 = 30;
+	deadline_unregister(source_2);
+	LONGS_EQUAL(100, deadline_next_ms());
+}
+
+TEST(Deadline, register_ShouldReturnError_WhenInvalidOrDuplicated) {
+	LONGS_EQUAL(-EINVAL, deadline_register(NULL));
+	LONGS_EQUAL(0, deadline_register(source_1));
+	LONGS_EQUAL(-EEXIST, deadline_register(source_1));
+}
+
+TEST(Deadline, unregister_ShouldReturnENOENT_WhenNotRegistered) {
+	LONGS_EQUAL(-ENOENT, deadline_unregister(source_1));
+	LONGS_EQUAL(-ENOENT, deadline_unregister(NULL));
+}
@@ -0,0 +1,229 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <string.h>
+
+#include "libmcu/flash_cache.h"
+#include "libmcu/flash_kvstore.h"
+
+#define FLASH_SIZE		4096
+#define PAGE_SIZE		256
+
+struct flash {
+	struct flash_api api;
+	uint8_t mem[FLASH_SIZE];
+	int reads;
+	int writes;
+	int erases;
+	size_t last_write_len;
+};
+
+static int ram_erase(struct flash *self, uintptr_t offset, size_t size) {
+	memset(&self->mem[offset], 0xff, size);
+	self->erases++;
+	return 0;
+}
+static int ram_write(struct flash *self,
+		uintptr_t offset, const void *data, size_t len) {
+	memcpy(&self->mem[offset], data, len);
+	self->writes++;
+	self->last_write_len = len;
+	return 0;
+}
+static int ram_read(struct flash *self,
+		uintptr_t offset, void *buf, size_t len) {
+	memcpy(buf, &self->mem[offset], len);
+	self->reads++;
+	return (int)len;
+}
+static size_t ram_size(struct flash *self) {
+	return sizeof(self->mem);
+}
+
+static void init_flash(struct flash *flash) {
+	memset(flash, 0, sizeof(*flash));
+	flash->api.erase = ram_erase;
+	flash->api.write = ram_write;
+	flash->api.read = ram_read;
+	flash->api.size = ram_size;
+	memset(flash->mem, 0xff, sizeof(flash->mem));
+}
+
+TEST_GROUP(FlashCache) {
+	struct flash backing;
+	struct flash *cache;
+
+	void setup(void) {
+		init_flash(&backing);
+		for (int i = 0; i < FLASH_SIZE; i++) {
+			backing.mem[i] = (uint8_t)i;
+		}
+		cache = flash_cache_create(&backing, PAGE_SIZE);
+	}
+	void teardown(void) {
+		flash_cache_delete(cache);
+	}
+};
+
+TEST(FlashCache, create_ShouldReturnNull_WhenInvalidParamsGiven) {
+	POINTERS_EQUAL(NULL, flash_cache_create(NULL, PAGE_SIZE));
+	POINTERS_EQUAL(NULL, flash_cache_create(&backing, 0));
+}
+
+TEST(FlashCache, size_ShouldReturnSizeOfUnderlyingFlash) {
+	LONGS_EQUAL(FLASH_SIZE, flash_size(cache));
+}
+
+TEST(FlashCache, read_ShouldReadWholePageOnce_WhenReadInSmallChunks) {
+	uint8_t buf[16];
+
+	for (int i = 0; i < PAGE_SIZE; i += sizeof(buf)) {
+		LONGS_EQUAL(sizeof(buf), flash_read(cache, i, buf, sizeof(buf)));
+		MEMCMP_EQUAL(&backing.mem[i], buf, sizeof(buf));
+	}
+
+	LONGS_EQUAL(1, backing.reads);
+}
+
+TEST(FlashCache, read_ShouldReadBothPages_WhenCrossingPageBoundary) {
+	uint8_t buf[16];
+
+	LONGS_EQUAL(sizeof(buf), flash_read(cache, PAGE_SIZE - 8,
+			buf, sizeof(buf)));
+	MEMCMP_EQUAL(&backing.mem[PAGE_SIZE - 8], buf, sizeof(buf));
+	LONGS_EQUAL(2, backing.reads);
+}
+
+TEST(FlashCache, read_ShouldBypassCache_WhenLargerThanPage) {
+	uint8_t buf[PAGE_SIZE * 2];
+
+	LONGS_EQUAL(sizeof(buf), flash_read(cache, 8, buf, sizeof(buf)));
+	MEMCMP_EQUAL(&backing.mem[8], buf, sizeof(buf));
+	LONGS_EQUAL(1, backing.reads);
+}
+
+TEST(FlashCache, write_ShouldCombineContiguousWrites_WhenInSamePage) {
+	uint8_t data[16];
+	memset(data, 0xA5, sizeof(data));
+
+	for (int i = 0; i < PAGE_SIZE; i += sizeof(data)) {
+		LONGS_EQUAL(0, flash_write(cache, i, data, sizeof(data)));
+	}
+	LONGS_EQUAL(0, backing.writes);
+
+	LONGS_EQUAL(0, flash_cache_sync(cache));
+	LONGS_EQUAL(1, backing.writes);
+	LONGS_EQUAL(PAGE_SIZE, backing.last_write_len);
+	LONGS_EQUAL(0xA5, backing.mem[PAGE_SIZE - 1]);
+}
+
+TEST(FlashCache, write_ShouldFlush_WhenPageChanges) {
+	uint8_t data[16] = { 0, };
+
+	flash_write(cache, 0, data, sizeof(data));
+	flash_write(cache, PAGE_SIZE, data, sizeof(data));
+	LONGS_EQUAL(1, backing.writes);
+	flash_cache_sync(cache);
+	LONGS_EQUAL(2, backing.writes);
+}
+
+TEST(FlashCache, write_ShouldFlush_WhenNotContiguous) {
+	uint8_t data[16] = { 0, };
+
+	flash_write(cache, 0, data, sizeof(data));
+	flash_write(cache, 32, data, sizeof(data));
+	LONGS_EQUAL(1, backing.writes);
+	LONGS_EQUAL(sizeof(data), backing.last_write_len);
+	LONGS_EQUAL(16, backing.mem[16]);
+}
+
+TEST(FlashCache, write_ShouldSplitIntoPages_WhenSpanningPages) {
+	uint8_t data[PAGE_SIZE + 32] = { 0, };
+
+	flash_write(cache, PAGE_SIZE - 16, data, sizeof(data));
+	flash_cache_sync(cache);
+
+	LONGS_EQUAL(3, backing.writes);
+	MEMCMP_EQUAL(data, &backing.mem[PAGE_SIZE - 16], sizeof(data));
+}
+
+TEST(FlashCache, read_ShouldReturnWrittenData_WhenWritePending) {
+	uint8_t data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	uint8_t buf[16];
+
+	flash_read(cache, 0, buf, sizeof(buf));
+	flash_write(cache, 4, data, sizeof(data));
+	flash_read(cache, 0, buf, sizeof(buf));
+
+	MEMCMP_EQUAL(data, &buf[4], sizeof(data));
+	LONGS_EQUAL(12, buf[12]);
+}
+
+TEST(FlashCache, read_ShouldKeepCache_WhenWritePendingElsewhere) {
+	uint8_t data[8] = { 0, };
+	uint8_t buf[16];
+
+	flash_read(cache, 0, buf, sizeof(buf));
+	flash_write(cache, 128, data, sizeof(data));
+	flash_read(cache, 16, buf, sizeof(buf));
+
+	LONGS_EQUAL(1, backing.reads);
+	LONGS_EQUAL(0, backing.writes);
+}
+
+TEST(FlashCache, erase_ShouldFlushAndInvalidateCache) {
+	uint8_t data[8] = { 0, };
+	uint8_t buf[8];
+
+	flash_read(cache, 0, buf, sizeof(buf));
+	flash_write(cache, PAGE_SIZE, data, sizeof(data));
+	LONGS_EQUAL(0, flash_erase(cache, 0, PAGE_SIZE));
+	LONGS_EQUAL(1, backing.writes);
+
+	flash_read(cache, 0, buf, sizeof(buf));
+	LONGS_EQUAL(0xff, buf[0]);
+	LONGS_EQUAL(2, backing.reads);
+}
+
+TEST(FlashCache, delete_ShouldFlushPendingWrites) {
+	struct flash *c = flash_cache_create(&backing, PAGE_SIZE);
+	uint8_t data[8] = { 0, };
+
+	flash_write(c, 0, data, sizeof(data));
+	flash_cache_delete(c);
+
+	LONGS_EQUAL(1, backing.writes);
+	LONGS_EQUAL(0, backing.mem[7]);
+}
+
+TEST(FlashCache, kvstore_ShouldWorkOnCache_WithFewerAccesses) {
+	struct flash scratch;
+	uint32_t value;
+
+	init_flash(&backing);
+	init_flash(&scratch);
+
+	struct kvstore *kvs = flash_kvstore_new(cache, &scratch);
+
+	for (uint32_t i = 0; i < 100; i++) {
+		LONGS_EQUAL(0, kvstore_write(kvs, i & 1? "odd" : "even",
+				&i, sizeof(i)));
+	}
+	flash_cache_sync(cache);
+
+	LONGS_EQUAL(sizeof(value), kvstore_read(kvs, "even", &value,
+			sizeof(value)));
+	LONGS_EQUAL(98, value);
+	LONGS_EQUAL(sizeof(value), kvstore_read(kvs, "odd", &value,
+			sizeof(value)));
+	LONGS_EQUAL(99, value);
+
+	const int uncached_meta_reads = 100 * (FLASH_SIZE >> 4) / 16;
+	CHECK(backing.reads < uncached_meta_reads / 4);
+}
@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "libmcu/flash_kvstore.h"
+
+#define FLASH_SIZE		4096
+
+struct flash {
+	struct flash_api api;
+	uint8_t mem[FLASH_SIZE];
+};
+
+static int ram_erase(struct flash *self, uintptr_t offset, size_t size) {
+	memset(&self->mem[offset], 0xff, size);
+	return 0;
+}
+static int ram_write(struct flash *self,
+		uintptr_t offset, const void *data, size_t len) {
+	memcpy(&self->mem[offset], data, len);
+	return 0;
+}
+static int ram_read(struct flash *self,
+		uintptr_t offset, void *buf, size_t len) {
+	memcpy(buf, &self->mem[offset], len);
+	return (int)len;
+}
+static size_t ram_size(struct flash *self) {
+	return sizeof(self->mem);
+}
+
+static struct flash storage;
+static struct flash scratch;
+
+static bool collect_key(char const *key, size_t size, void *ctx)
+{
+	char *keys = (char *)ctx;
+	size_t len = strlen(keys);
+	snprintf(&keys[len], 256 - len, "%s:%u,", key, (unsigned int)size);
+	return true;
+}
+
+static bool stop_at_first(char const *key, size_t size, void *ctx)
+{
+	(*(int *)ctx)++;
+	return false;
+}
+
+TEST_GROUP(FlashKVStoreNames) {
+	struct kvstore *kvstore;
+	char keys[256];
+
+	void setup(void) {
+		const struct flash_api api = {
+			.erase = ram_erase,
+			.write = ram_write,
+			.read = ram_read,
+			.size = ram_size,
+		};
+		storage.api = api;
+		scratch.api = api;
+		memset(storage.mem, 0xff, sizeof(storage.mem));
+		memset(scratch.mem, 0xff, sizeof(scratch.mem));
+		memset(keys, 0, sizeof(keys));
+
+		kvstore = flash_kvstore_new(&storage, &scratch);
+	}
+	void teardown(void) {
+	}
+};
+
+TEST(FlashKVStoreNames, iterate_ShouldVisitAllKeys_WhenNoPrefixGiven) {
+	const uint8_t large[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+	LONGS_EQUAL(0, kvstore_write(kvstore, "cfg/a", "ab", 2));
+	LONGS_EQUAL(0, kvstore_write(kvstore, "metric/0", large, sizeof(large)));
+
+	LONGS_EQUAL(0, kvstore_iterate(kvstore, NULL, collect_key, keys));
+	STRCMP_EQUAL("cfg/a:2,metric/0:9,", keys);
+}
+
+TEST(FlashKVStoreNames, iterate_ShouldVisitOnlyMatchingKeys_WhenPrefixGiven) {
+	LONGS_EQUAL(0, kvstore_write(kvstore, "cfg/a", "ab", 2));
+	LONGS_EQUAL(0, kvstore_write(kvstore, "metric/0", "0", 1));
+	LONGS_EQUAL(0, kvstore_write(kvstore, "metric/1", "11", 2));
+
+	LONGS_EQUAL(0, kvstore_iterate(kvstore, "metric/", collect_key, keys));
+	STRCMP_EQUAL("metric/0:1,metric/1:2,", keys);
+}
+
+TEST(FlashKVStoreNames, iterate_ShouldVisitOnce_WhenKeyUpdated) {
+	LONGS_EQUAL(0, kvstore_write(kvstore, "key", "a", 1));
+	LONGS_EQUAL(0, kvstore_write(kvstore, "key", "bcdefgh", 7));
+
+	LONGS_EQUAL(0, kvstore_iterate(kvstore, "", collect_key, keys));
+	STRCMP_EQUAL("key:7,", keys);
+}
+
+TEST(FlashKVStoreNames, iterate_ShouldSkipClearedKeys) {
+	LONGS_EQUAL(0, kvstore_write(kvstore, "key1", "a", 1));
+	LONGS_EQUAL(0, kvstore_write(kvstore, "key2", "b", 1));
+	kvstore_clear(kvstore, "key1");
+
+	LONGS_EQUAL(0, kvstore_iterate(kvstore, NULL, collect_key, keys));
+	STRCMP_EQUAL("key2:1,", keys);
+}
+
+TEST(FlashKVStoreNames, iterate_ShouldStop_WhenCallbackReturnsFalse) {
+	int count = 0;
+
+	LONGS_EQUAL(0, kvstore_write(kvstore, "key1", "a", 1));
+	LONGS_EQUAL(0, kvstore_write(kvstore, "key2", "b", 1));
+
+	LONGS_EQUAL(0, kvstore_iterate(kvstore, NULL, stop_at_first, &count));
+	LONGS_EQUAL(1, count);
+}
+
+TEST(FlashKVStoreNames, iterate_ShouldKeepNames_WhenReclaimed) {
+	uint8_t buf[4];
+
+	LONGS_EQUAL(0, kvstore_write(kvstore, "key1", "a", 1));
+	LONGS_EQUAL(0, kvstore_write(kvstore, "key2", "b", 1));
+	kvstore_clear(kvstore, "key2");
+	for (uint8_t i = 0; i < 16; i++) {
+		LONGS_EQUAL(0, kvstore_write(kvstore, "counter", &i, sizeof(i)));
+	}
+
+	LONGS_EQUAL(0, kvstore_iterate(kvstore, NULL, collect_key, keys));
+	STRCMP_EQUAL("key1:1,counter:1,", keys);
+	LONGS_EQUAL(1, kvstore_read(kvstore, "counter", buf, sizeof(buf)));
+	LONGS_EQUAL(15, buf[0]);
+}
@@ -384,7 +384,7 @@ TEST(FlashKVStore, write_ShouldWriteInAlignment) {
 		.andReturnValue((int)sizeof(first_meta));
 	prepare_meta_read_empty(1, META_SIZE / META_ENTRY_SIZE - 1);
 
-	const uint8_t expected_value[] = { 1, 2, 3 };
+	const uint8_t expected_value[] = { 1, 2, 3, 4, 5 };
 	const uint8_t expected_meta[] = {
 		0x34, 0xfd, 0x64, 0x71, 0x94, 0x9d, 0xf7, 0x0f,
 		META_ENTRY_SIZE, 0x00, 0x00, 0x00, sizeof(expected_value), 0x00, 0x00, 0x00,
@@ -406,6 +406,96 @@ TEST(FlashKVStore, write_ShouldWriteInAlignment) {
 			expected_value, sizeof(expected_value)));
 }
 
+TEST(FlashKVStore, write_ShouldKeepSmallValueInMeta) {
+	const uint8_t first_meta[] = {
+		0xab, 0x13, 0x35, 0x24, 0x25, 0xff, 0x4a, 0x3a,
+		0x00, 0x00, 0x00, 0x00, 9, 0x00, 0x00, 0x00,
+	};
+
+	mock().expectOneCall("fake_read") // for find
+		.withParameter("self", &flash)
+		.withParameter("offset", 0)
+		.withParameter("len", sizeof(first_meta))
+		.withOutputParameterReturning("buf",
+				first_meta, sizeof(first_meta))
+		.andReturnValue((int)sizeof(first_meta));
+	prepare_meta_read_empty(1, META_SIZE / META_ENTRY_SIZE - 1);
+
+	const uint8_t value[] = { 1, 2, 3 };
+	const uint8_t expected_meta[] = {
+		0x34, 0xfd, 0x64, 0x71, 0x94, 0x9d, 0xf7, 0x0f,
+		1, 2, 3, 0xff, sizeof(value), 0x00, 0x00, 0x80,
+	};
+	ByteArray meta = { expected_meta, sizeof(expected_meta), };
+	mock().expectOneCall("fake_write") // for write meta only
+		.withParameter("self", &flash)
+		.withParameter("offset", META_ENTRY_SIZE)
+		.withParameterOfType("ByteArray", "byteArray", &meta)
+		.andReturnValue(0);
+
+	LONGS_EQUAL(0, kvstore_write(kvstore, "mykey", value, sizeof(value)));
+}
+
+TEST(FlashKVStore, read_ShouldReturnSmallValue_WhenKeptInMeta) {
+	struct flash f = {
+		.api = {
+			.erase = spy_erase,
+			.write = spy_write,
+			.read = spy_read,
+			.size = spy_size,
+		},
+	};
+	kvstore = flash_kvstore_new(&f, NULL);
+	const uint8_t small[] = { 0xde, 0xad, 0xbe, 0xef };
+	const uint8_t large[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	uint8_t buf[sizeof(large)];
+
+	LONGS_EQUAL(0, kvstore_write(kvstore, "small", small, sizeof(small)));
+	LONGS_EQUAL(0, kvstore_write(kvstore, "large", large, sizeof(large)));
+
+	LONGS_EQUAL(sizeof(small), kvstore_read(kvstore, "small", buf, sizeof(buf)));
+	MEMCMP_EQUAL(small, buf, sizeof(small));
+	LONGS_EQUAL(sizeof(large), kvstore_read(kvstore, "large", buf, sizeof(buf)));
+	MEMCMP_EQUAL(large, buf, sizeof(large));
+	LONGS_EQUAL(2, kvstore_read(kvstore, "small", buf, 2));
+	MEMCMP_EQUAL(small, buf, 2);
+}
+
+TEST(FlashKVStore, write_ShouldKeepSmallValues_WhenReclaimed) {
+	struct flash f = {
+		.api = {
+			.erase = spy_erase,
+			.write = spy_write,
+			.read = spy_read,
+			.size = spy_size,
+		},
+	};
+	struct flash s = {
+		.api = {
+			.erase = spy_scratch_erase,
+			.write = spy_scratch_write,
+			.read = spy_scratch_read,
+			.size = spy_scratch_size,
+		},
+	};
+	kvstore = flash_kvstore_new(&f, &s);
+	const uint8_t large[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	uint8_t buf[sizeof(large)];
+
+	LONGS_EQUAL(0, kvstore_write(kvstore, "small", "abc", 3));
+	LONGS_EQUAL(0, kvstore_write(kvstore, "large", large, sizeof(large)));
+	for (uint8_t i = 0; i < 4; i++) {
+		LONGS_EQUAL(0, kvstore_write(kvstore, "counter", &i, sizeof(i)));
+	}
+
+	LONGS_EQUAL(3, kvstore_read(kvstore, "small", buf, sizeof(buf)));
+	MEMCMP_EQUAL("abc", buf, 3);
+	LONGS_EQUAL(sizeof(large), kvstore_read(kvstore, "large", buf, sizeof(buf)));
+	MEMCMP_EQUAL(large, buf, sizeof(large));
+	LONGS_EQUAL(1, kvstore_read(kvstore, "counter", buf, sizeof(buf)));
+	LONGS_EQUAL(3, buf[0]);
+}
+
 TEST(FlashKVStore, write_ShouldReturnNoSpace_WhenNoSpaceLeft) {
 	struct flash f = {
 		.api = {
@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "libmcu/lockstat_pthread.h"
+#include "libmcu/board.h"
+
+uint64_t board_get_time_since_boot_us(void) {
+	return 0;
+}
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+LOCKSTAT_DEFINE(mutex_stat);
+
+static volatile bool holding;
+
+static void *hold_for_a_while(void *arg) {
+	(void)arg;
+	LOCKSTAT_MUTEX_LOCK(mutex_stat, &mutex);
+	holding = true;
+	usleep(20000);
+	LOCKSTAT_MUTEX_UNLOCK(mutex_stat, &mutex);
+	return NULL;
+}
+
+TEST_GROUP(LockStatPthread) {
+	void setup(void) {
+		holding = false;
+		lockstat_reset();
+	}
+	void teardown(void) {
+	}
+};
+
+TEST(LockStatPthread, lock_ShouldRecordAcquisitionAndHolder_WhenUncontended) {
+	LONGS_EQUAL(0, LOCKSTAT_MUTEX_LOCK(mutex_stat, &mutex));
+	usleep(1000);
+	LONGS_EQUAL(0, LOCKSTAT_MUTEX_UNLOCK(mutex_stat, &mutex));
+
+	LONGS_EQUAL(1, mutex_stat.acquisitions);
+	LONGS_EQUAL(0, mutex_stat.contentions);
+	CHECK(mutex_stat.hold_total_ns >= 1000000);
+	CHECK(mutex_stat.holders[0].caller != NULL);
+	LONGS_EQUAL(1, mutex_stat.holders[0].count);
+}
+
+TEST(LockStatPthread, lock_ShouldRecordWaitTime_WhenContended) {
+	pthread_t thread;
+
+	pthread_create(&thread, NULL, hold_for_a_while, NULL);
+	while (!holding) {
+		usleep(100);
+	}
+
+	LONGS_EQUAL(0, LOCKSTAT_MUTEX_LOCK(mutex_stat, &mutex));
+	LONGS_EQUAL(0, LOCKSTAT_MUTEX_UNLOCK(mutex_stat, &mutex));
+	pthread_join(thread, NULL);
+
+	LONGS_EQUAL(2, mutex_stat.acquisitions);
+	LONGS_EQUAL(1, mutex_stat.contentions);
+	CHECK(mutex_stat.wait_max_ns >= 5000000);
+	CHECK(mutex_stat.hold_max_ns >= 5000000);
+}
@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <string.h>
+
+#include "libmcu/lockstat.h"
+#include "libmcu/board.h"
+
+static uint64_t fake_time_ns;
+
+uint64_t lockstat_get_time_ns(void) {
+	return fake_time_ns;
+}
+uint64_t board_get_time_since_boot_us(void) {
+	return fake_time_ns / 1000;
+}
+
+LOCKSTAT_DEFINE(lock_a);
+LOCKSTAT_DEFINE(lock_b);
+
+static const void *caller_1 = (const void *)0x1000;
+static const void *caller_2 = (const void *)0x2000;
+
+static void hold(struct lockstat *stat, const void *caller,
+		uint64_t wait_ns, uint64_t hold_ns) {
+	lockstat_acquired(stat, wait_ns, wait_ns != 0, caller);
+	fake_time_ns += hold_ns;
+	lockstat_released(stat);
+}
+
+static void count_locks(const struct lockstat *stat, void *ctx) {
+	if (stat == &lock_a || stat == &lock_b) {
+		(*(int *)ctx)++;
+	}
+}
+
+TEST_GROUP(LockStat) {
+	void setup(void) {
+		fake_time_ns = 0;
+		lockstat_reset();
+	}
+	void teardown(void) {
+	}
+};
+
+TEST(LockStat, acquired_ShouldCountAcquisitionsAndContentions) {
+	hold(&lock_a, caller_1, 0, 100);
+	hold(&lock_a, caller_1, 5000, 100);
+	hold(&lock_a, caller_1, 0, 100);
+
+	LONGS_EQUAL(3, lock_a.acquisitions);
+	LONGS_EQUAL(1, lock_a.contentions);
+}
+
+TEST(LockStat, acquired_ShouldRecordWaitTime_WhenContended) {
+	hold(&lock_a, caller_1, 3000, 0);
+	hold(&lock_a, caller_1, 1500, 0);
+
+	LONGS_EQUAL(4500, lock_a.wait_total_ns);
+	LONGS_EQUAL(3000, lock_a.wait_max_ns);
+	LONGS_EQUAL(1, lock_a.wait_histogram[1]); /* [1024, 2048) */
+	LONGS_EQUAL(1, lock_a.wait_histogram[2]); /* [2048, 4096) */
+}
+
+TEST(LockStat, acquired_ShouldNotRecordWaitTime_WhenUncontended) {
+	hold(&lock_a, caller_1, 0, 0);
+
+	LONGS_EQUAL(0, lock_a.wait_total_ns);
+	for (unsigned int i = 0; i < LOCKSTAT_HISTOGRAM_BUCKETS; i++) {
+		LONGS_EQUAL(0, lock_a.wait_histogram[i]);
+	}
+}
+
+TEST(LockStat, released_ShouldRecordHoldTime) {
+	hold(&lock_a, caller_1, 0, 500);
+	hold(&lock_a, caller_1, 0, 1500);
+
+	LONGS_EQUAL(2000, lock_a.hold_total_ns);
+	LONGS_EQUAL(1500, lock_a.hold_max_ns);
+	LONGS_EQUAL(1, lock_a.hold_histogram[0]);
+	LONGS_EQUAL(1, lock_a.hold_histogram[1]);
+}
+
+TEST(LockStat, released_ShouldPutLongHoldsInLastBucket) {
+	hold(&lock_a, caller_1, 0, UINT64_C(1) << 40);
+	LONGS_EQUAL(1, lock_a.hold_histogram[LOCKSTAT_HISTOGRAM_BUCKETS - 1]);
+}
+
+TEST(LockStat, released_ShouldSortHoldersByCount) {
+	hold(&lock_a, caller_1, 0, 10);
+	hold(&lock_a, caller_2, 0, 20);
+	hold(&lock_a, caller_2, 0, 20);
+
+	POINTERS_EQUAL(caller_2, lock_a.holders[0].caller);
+	LONGS_EQUAL(2, lock_a.holders[0].count);
+	LONGS_EQUAL(40, lock_a.holders[0].hold_ns);
+	POINTERS_EQUAL(caller_1, lock_a.holders[1].caller);
+	LONGS_EQUAL(1, lock_a.holders[1].count);
+}
+
+TEST(LockStat, released_ShouldReplaceLeastFrequentHolder_WhenTableFull) {
+	for (uintptr_t i = 1; i <= LOCKSTAT_MAX_HOLDERS; i++) {
+		for (uintptr_t j = 0; j < i + 1; j++) {
+			hold(&lock_a, (const void *)i, 0, 1);
+		}
+	}
+
+	const void *newcomer = (const void *)0x9999;
+	hold(&lock_a, newcomer, 0, 1);
+
+	const struct lockstat_holder *last =
+		&lock_a.holders[LOCKSTAT_MAX_HOLDERS - 1];
+	POINTERS_EQUAL(newcomer, last->caller);
+	LONGS_EQUAL(3, last->count);
+	LONGS_EQUAL(1, last->hold_ns);
+}
+
+TEST(LockStat, iterate_ShouldVisitEachLockOnce_WhenAcquired) {
+	int count = 0;
+
+	hold(&lock_a, caller_1, 0, 0);
+	hold(&lock_b, caller_1, 0, 0);
+	hold(&lock_b, caller_1, 0, 0);
+
+	lockstat_iterate(count_locks, &count);
+
+	LONGS_EQUAL(2, count);
+	STRCMP_EQUAL("lock_a", lock_a.name);
+}
+
+TEST(LockStat, reset_ShouldClearStatistics) {
+	hold(&lock_a, caller_1, 5000, 100);
+	lockstat_reset();
+
+	LONGS_EQUAL(0, lock_a.acquisitions);
+	LONGS_EQUAL(0, lock_a.contentions);
+	LONGS_EQUAL(0, lock_a.hold_total_ns);
+	LONGS_EQUAL(0, lock_a.holders[0].count);
+	STRCMP_EQUAL("lock_a", lock_a.name);
+}
+
+TEST(LockStat, bucket_ShouldReturnLowerBound) {
+	LONGS_EQUAL(0, lockstat_bucket_ns(0));
+	LONGS_EQUAL(1024, lockstat_bucket_ns(1));
+	LONGS_EQUAL(2048, lockstat_bucket_ns(2));
+}
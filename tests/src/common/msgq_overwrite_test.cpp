@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+#include "libmcu/msgq.h"
+#include "libmcu/ringbuf.h"
+
+#include <string.h>
+
+/* ringbuf_peek() is wrapped to let a producer overwrite the queue right after
+ * msgq_pop() peeks the header, as msgq_push_overwrite() from another thread
+ * would do without a lock */
+
+static struct msgq *overwriter;
+static const void *overwrite_data;
+static size_t overwrite_size;
+
+extern "C" size_t __real_ringbuf_peek(const struct ringbuf *handle,
+		const size_t offset, void *buf, const size_t bufsize);
+extern "C" size_t __wrap_ringbuf_peek(const struct ringbuf *handle,
+		const size_t offset, void *buf, const size_t bufsize) {
+	const size_t n = __real_ringbuf_peek(handle, offset, buf, bufsize);
+
+	if (offset == 0 && overwriter) {
+		struct msgq *q = overwriter;
+		overwriter = NULL;
+		LONGS_EQUAL(0, msgq_push_overwrite(q,
+				overwrite_data, overwrite_size));
+	}
+
+	return n;
+}
+
+TEST_GROUP(MessageQueueOverwrite) {
+	struct msgq *msgq;
+	uint8_t old_msg[48];
+
+	void setup(void) {
+		msgq = msgq_create(64);
+		memset(old_msg, 0xa5, sizeof(old_msg));
+		LONGS_EQUAL(0, msgq_push(msgq, old_msg, sizeof(old_msg)));
+		overwriter = NULL;
+	}
+	void teardown(void) {
+		msgq_destroy(msgq);
+	}
+
+	void overwrite_after_header_peek(const void *data, size_t datasize) {
+		overwrite_data = data;
+		overwrite_size = datasize;
+		overwriter = msgq;
+	}
+};
+
+TEST(MessageQueueOverwrite, pop_ShouldRetry_WhenOverwrittenTooLargeHeaderPeeked) {
+	uint8_t buf[8];
+	overwrite_after_header_peek("newest", 6);
+
+	LONGS_EQUAL(6, msgq_pop(msgq, buf, sizeof(buf)));
+	MEMCMP_EQUAL("newest", buf, 6);
+	LONGS_EQUAL(1, msgq_dropped(msgq));
+}
+
+TEST(MessageQueueOverwrite, pop_ShouldRetry_WhenOverwrittenBeforePeekingData) {
+	uint8_t buf[64];
+	overwrite_after_header_peek("newest", 6);
+
+	LONGS_EQUAL(6, msgq_pop(msgq, buf, sizeof(buf)));
+	MEMCMP_EQUAL("newest", buf, 6);
+}
+
+TEST(MessageQueueOverwrite, pop_ShouldReturnERANGE_WhenNotOverwritten) {
+	uint8_t buf[8];
+	LONGS_EQUAL(-ERANGE, msgq_pop(msgq, buf, sizeof(buf)));
+	LONGS_EQUAL(sizeof(old_msg) + sizeof(msgq_msg_meta_t), msgq_len(msgq));
+}
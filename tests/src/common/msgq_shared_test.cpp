@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <errno.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "libmcu/msgq_shared.h"
+
+#define NAME			"/libmcu_msgq_test"
+#define CAPACITY		256
+
+static uint64_t now_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+static void *push_later(void *arg) {
+	usleep(10000);
+	msgq_push_shared((struct msgq_shared *)arg, "late", 4);
+	return NULL;
+}
+
+#define NR_PRODUCERS		4
+#define NR_MESSAGES		10000
+
+static void *produce(void *arg) {
+	struct msgq_shared *q = (struct msgq_shared *)arg;
+	for (uint32_t i = 0; i < NR_MESSAGES; i++) {
+		while (msgq_push_shared(q, &i, sizeof(i)) != 0) {
+		}
+	}
+	return NULL;
+}
+
+TEST_GROUP(MessageQueueShared) {
+	struct msgq_shared *q;
+
+	void setup(void) {
+		msgq_unlink_shared(NAME);
+		q = msgq_create_shared(NAME, CAPACITY);
+		CHECK(q != NULL);
+	}
+	void teardown(void) {
+		msgq_destroy_shared(q);
+		msgq_unlink_shared(NAME);
+	}
+};
+
+TEST(MessageQueueShared, create_ShouldReturnNull_WhenCapacityNotPowerOf2) {
+	POINTERS_EQUAL(NULL, msgq_create_shared("/libmcu_msgq_none", 100));
+}
+
+TEST(MessageQueueShared, create_ShouldReturnNull_WhenCapacityDiffers) {
+	POINTERS_EQUAL(NULL, msgq_create_shared(NAME, CAPACITY * 2));
+}
+
+TEST(MessageQueueShared, cap_ShouldReturnCapacity) {
+	LONGS_EQUAL(CAPACITY, msgq_cap_shared(q));
+}
+
+TEST(MessageQueueShared, pop_ShouldReturnMessage_WhenPushed) {
+	char buf[16];
+	LONGS_EQUAL(0, msgq_push_shared(q, "hello", 5));
+	LONGS_EQUAL(sizeof(msgq_msg_meta_t) + 5, msgq_len_shared(q));
+	LONGS_EQUAL(5, msgq_next_msg_size_shared(q));
+	LONGS_EQUAL(5, msgq_pop_shared(q, buf, sizeof(buf), 0));
+	MEMCMP_EQUAL("hello", buf, 5);
+	LONGS_EQUAL(0, msgq_len_shared(q));
+}
+
+TEST(MessageQueueShared, pop_ShouldReturnENOENT_WhenEmptyWithNoWait) {
+	char buf[16];
+	LONGS_EQUAL(-ENOENT, msgq_pop_shared(q, buf, sizeof(buf), 0));
+}
+
+TEST(MessageQueueShared, pop_ShouldReturnETIMEDOUT_WhenNoMessageInTime) {
+	char buf[16];
+	uint64_t t0 = now_ms();
+	LONGS_EQUAL(-ETIMEDOUT, msgq_pop_shared(q, buf, sizeof(buf), 20));
+	CHECK(now_ms() - t0 >= 20);
+}
+
+TEST(MessageQueueShared, pop_ShouldReturnERANGE_WhenBufferTooSmall) {
+	char buf[4];
+	msgq_push_shared(q, "hello", 5);
+	LONGS_EQUAL(-ERANGE, msgq_pop_shared(q, buf, sizeof(buf), 0));
+	LONGS_EQUAL(5, msgq_next_msg_size_shared(q));
+}
+
+TEST(MessageQueueShared, push_ShouldReturnENOMEM_WhenFull) {
+	uint8_t msg[CAPACITY / 2 - sizeof(msgq_msg_meta_t)] = { 0, };
+	LONGS_EQUAL(0, msgq_push_shared(q, msg, sizeof(msg)));
+	LONGS_EQUAL(0, msgq_push_shared(q, msg, sizeof(msg)));
+	LONGS_EQUAL(-ENOMEM, msgq_push_shared(q, msg, 1));
+}
+
+TEST(MessageQueueShared, pop_ShouldWakeUp_WhenPushedWhileWaiting) {
+	char buf[16];
+	pthread_t thread;
+	pthread_create(&thread, NULL, push_later, q);
+	LONGS_EQUAL(4, msgq_pop_shared(q, buf, sizeof(buf), -1));
+	pthread_join(thread, NULL);
+	MEMCMP_EQUAL("late", buf, 4);
+}
+
+TEST(MessageQueueShared, pop_ShouldKeepMessagesIntact_WhenWrappedAround) {
+	uint8_t msg[37];
+	uint8_t buf[sizeof(msg)];
+	for (int i = 0; i < 100; i++) {
+		memset(msg, i, sizeof(msg));
+		LONGS_EQUAL(0, msgq_push_shared(q, msg, sizeof(msg)));
+		LONGS_EQUAL(sizeof(msg), msgq_pop_shared(q, buf, sizeof(buf), 0));
+		MEMCMP_EQUAL(msg, buf, sizeof(msg));
+	}
+}
+
+TEST(MessageQueueShared, pop_ShouldReturnAll_WhenMultipleProducers) {
+	struct msgq_shared *producers[NR_PRODUCERS];
+	pthread_t threads[NR_PRODUCERS];
+	uint64_t sum = 0;
+	uint32_t value;
+
+	for (int i = 0; i < NR_PRODUCERS; i++) {
+		producers[i] = msgq_create_shared(NAME, CAPACITY);
+		pthread_create(&threads[i], NULL, produce, producers[i]);
+	}
+
+	/* no message lost or duplicated if they sum up to the expected */
+	for (int i = 0; i < NR_PRODUCERS * NR_MESSAGES; i++) {
+		LONGS_EQUAL(sizeof(value),
+				msgq_pop_shared(q, &value, sizeof(value), 1000));
+		sum += value;
+	}
+
+	for (int i = 0; i < NR_PRODUCERS; i++) {
+		pthread_join(threads[i], NULL);
+		msgq_destroy_shared(producers[i]);
+	}
+
+	LONGS_EQUAL((uint64_t)NR_PRODUCERS * NR_MESSAGES * (NR_MESSAGES - 1) / 2,
+			sum);
+	LONGS_EQUAL(0, msgq_len_shared(q));
+}
+
+TEST(MessageQueueShared, pop_ShouldReceiveFromAnotherProcess) {
+	pid_t pid = fork();
+
+	if (pid == 0) {
+		struct msgq_shared *child = msgq_create_shared(NAME, CAPACITY);
+		for (uint32_t i = 0; i < NR_MESSAGES; i++) {
+			while (msgq_push_shared(child, &i, sizeof(i)) != 0) {
+			}
+		}
+		_exit(0);
+	}
+
+	for (uint32_t i = 0; i < NR_MESSAGES; i++) {
+		uint32_t value;
+		LONGS_EQUAL(sizeof(value),
+				msgq_pop_shared(q, &value, sizeof(value), 1000));
+		LONGS_EQUAL(i, value);
+	}
+
+	int status;
+	waitpid(pid, &status, 0);
+	LONGS_EQUAL(0, WEXITSTATUS(status));
+}
@@ -9,6 +9,9 @@
 #include "CppUTestExt/MockSupport.h"
 #include "libmcu/msgq.h"
 
+#include <pthread.h>
+#include <string.h>
+
 static int f_lock(void *ctx) {
 	return mock().actualCall(__func__)
 		.withParameter("ctx", ctx)
@@ -259,3 +262,104 @@ TEST(MessageQueue, calc_size_ShouldReturnRoundUpToPowerOfTwo) {
 	LONGS_EQUAL(16, msgq_calc_size(1, 8));
 	LONGS_EQUAL(32, msgq_calc_size(1, 9));
 }
+
+TEST(MessageQueue, push_overwrite_ShouldDropOldestMessages_WhenFull) {
+	uint8_t msg[24];
+	uint8_t buf[sizeof(msg)];
+
+	for (uint8_t i = 0; i < 4; i++) {
+		memset(msg, i, sizeof(msg));
+		LONGS_EQUAL(0, msgq_push_overwrite(msgq, msg, sizeof(msg)));
+	}
+	LONGS_EQUAL(0, msgq_dropped(msgq));
+
+	memset(msg, 4, sizeof(msg));
+	LONGS_EQUAL(0, msgq_push_overwrite(msgq, msg, sizeof(msg)));
+	LONGS_EQUAL(1, msgq_dropped(msgq));
+
+	for (uint8_t i = 1; i <= 4; i++) {
+		LONGS_EQUAL(sizeof(buf), msgq_pop(msgq, buf, sizeof(buf)));
+		LONGS_EQUAL(i, buf[0]);
+		LONGS_EQUAL(i, buf[sizeof(buf) - 1]);
+	}
+	LONGS_EQUAL(-ENOENT, msgq_pop(msgq, buf, sizeof(buf)));
+}
+
+TEST(MessageQueue, push_overwrite_ShouldDropAsManyAsNeeded_WhenMessageIsLarge) {
+	uint8_t small[8] = { 0, };
+	uint8_t large[96] = { 0xA5, };
+	uint8_t buf[sizeof(large)];
+
+	for (int i = 0; i < 8; i++) {
+		msgq_push(msgq, small, sizeof(small));
+	}
+	LONGS_EQUAL(0, msgq_push_overwrite(msgq, large, sizeof(large)));
+	CHECK(msgq_dropped(msgq) >= 6);
+
+	int len;
+	while ((len = msgq_pop(msgq, buf, sizeof(buf))) == sizeof(small));
+	LONGS_EQUAL(sizeof(large), len);
+	LONGS_EQUAL(0xA5, buf[0]);
+}
+
+TEST(MessageQueue, push_overwrite_ShouldReturnNoMem_WhenLargerThanCapacity) {
+	uint8_t msg[128];
+	LONGS_EQUAL(-ENOMEM, msgq_push_overwrite(msgq, msg, sizeof(msg)));
+}
+
+TEST(MessageQueue, push_overwrite_ShouldCallSyncFunctions_WhenLockAndUnlockAreSet) {
+	mock().expectOneCall("f_lock")
+		.withParameter("ctx", sync_ctx);
+	mock().expectOneCall("f_unlock")
+		.withParameter("ctx", sync_ctx);
+	msgq_set_sync(msgq, f_lock, f_unlock, sync_ctx);
+	msgq_push_overwrite(msgq, "a", 1);
+}
+
+#define NR_MESSAGES		100000
+
+struct sample {
+	uint32_t seq;
+	uint32_t check[3];
+};
+
+static void *produce(void *arg) {
+	struct msgq *q = (struct msgq *)arg;
+
+	for (uint32_t i = 1; i <= NR_MESSAGES; i++) {
+		const struct sample sample = { i, { i, ~i, i * 3 } };
+		msgq_push_overwrite(q, &sample, sizeof(sample) - (i & 3) * 4);
+	}
+
+	return NULL;
+}
+
+TEST(MessageQueue, push_overwrite_ShouldKeepMessagesIntact_WhenConsumedConcurrently) {
+	pthread_t producer;
+	struct sample sample;
+	uint32_t last = 0;
+	uint32_t received = 0;
+
+	pthread_create(&producer, NULL, produce, msgq);
+
+	while (last < NR_MESSAGES) {
+		memset(&sample, 0, sizeof(sample));
+		const int len = msgq_pop(msgq, &sample, sizeof(sample));
+		if (len < 0) {
+			continue;
+		}
+		LONGS_EQUAL(sizeof(sample) - (sample.seq & 3) * 4, len);
+		CHECK(sample.seq > last);
+		if (len > 4) {
+			LONGS_EQUAL(sample.seq, sample.check[0]);
+		}
+		if (len > 8) {
+			LONGS_EQUAL(~sample.seq, sample.check[1]);
+		}
+		last = sample.seq;
+		received++;
+	}
+
+	pthread_join(producer, NULL);
+	CHECK(received <= NR_MESSAGES);
+}
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+
+#include <memory>
+
+#include "libmcu/ringbuf.hpp"
+#include "libmcu/msgq.hpp"
+
+TEST_GROUP(RingBufferTemplate) {
+	void setup(void) {
+	}
+	void teardown(void) {
+	}
+};
+
+TEST(RingBufferTemplate, capacity_ShouldBeCompileTimeConstant) {
+	static_assert(libmcu::RingBuffer<uint32_t, 8>::capacity() == 8, "");
+	libmcu::RingBuffer<uint32_t, 8> rb;
+	LONGS_EQUAL(0, rb.length());
+	LONGS_EQUAL(8, rb.available());
+	CHECK_TRUE(rb.empty());
+}
+
+TEST(RingBufferTemplate, push_ShouldReturnFalse_WhenFull) {
+	libmcu::RingBuffer<int, 4> rb;
+	for (int i = 0; i < 4; i++) {
+		CHECK_TRUE(rb.push(i));
+	}
+	CHECK_TRUE(rb.full());
+	CHECK_FALSE(rb.push(4));
+}
+
+TEST(RingBufferTemplate, pop_ShouldReturnInFifoOrder_WhenWrappedAround) {
+	libmcu::RingBuffer<int, 4> rb;
+	int v;
+	for (int i = 0; i < 10; i++) {
+		rb.push(i);
+		rb.push(i + 100);
+		CHECK_TRUE(rb.pop(v));
+		LONGS_EQUAL(i, v);
+		CHECK_TRUE(rb.pop(v));
+		LONGS_EQUAL(i + 100, v);
+	}
+	CHECK_FALSE(rb.pop(v));
+}
+
+TEST(RingBufferTemplate, push_ShouldMoveElement_WhenMoveOnlyTypeGiven) {
+	libmcu::RingBuffer<std::unique_ptr<int>, 2> rb;
+	std::unique_ptr<int> p(new int(7));
+	CHECK_TRUE(rb.push(std::move(p)));
+	POINTERS_EQUAL(NULL, p.get());
+	CHECK_TRUE(rb.pop(p));
+	LONGS_EQUAL(7, *p);
+}
+
+TEST(RingBufferTemplate, destructor_ShouldDestroyQueuedElements) {
+	std::shared_ptr<int> p(new int(1));
+	{
+		libmcu::RingBuffer<std::shared_ptr<int>, 4> rb;
+		rb.push(p);
+		rb.push(p);
+		LONGS_EQUAL(3, p.use_count());
+	}
+	LONGS_EQUAL(1, p.use_count());
+}
+
+TEST(RingBufferTemplate, move_ShouldTransferElements) {
+	libmcu::RingBuffer<std::unique_ptr<int>, 4> rb;
+	rb.emplace(new int(1));
+	rb.emplace(new int(2));
+
+	libmcu::RingBuffer<std::unique_ptr<int>, 4> moved(std::move(rb));
+	CHECK_TRUE(rb.empty());
+	LONGS_EQUAL(2, moved.length());
+	LONGS_EQUAL(1, *moved.front());
+}
+
+TEST(RingBufferTemplate, write_ShouldWriteAsMuchAsAvailable) {
+	libmcu::RingBuffer<uint8_t, 8> rb;
+	const uint8_t data[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	LONGS_EQUAL(8, rb.write(data, sizeof(data)));
+	LONGS_EQUAL(0, rb.write(data, 1));
+}
+
+TEST(RingBufferTemplate, read_ShouldReadData_WhenWrappedAround) {
+	libmcu::RingBuffer<uint8_t, 8> rb;
+	const uint8_t data[6] = { 1, 2, 3, 4, 5, 6 };
+	uint8_t buf[6];
+	rb.write(data, 6);
+	rb.read(buf, 4);
+	LONGS_EQUAL(6, rb.write(data, 6));
+	LONGS_EQUAL(2, rb.read(buf, 2));
+	LONGS_EQUAL(6, rb.read(buf, sizeof(buf)));
+	MEMCMP_EQUAL(data, buf, sizeof(data));
+}
+
+TEST(RingBufferTemplate, peekPointer_ShouldReturnContiguousLength) {
+	libmcu::RingBuffer<uint8_t, 8> rb;
+	const uint8_t data[6] = { 1, 2, 3, 4, 5, 6 };
+	size_t contiguous;
+	rb.write(data, 6);
+	rb.consume(6);
+	rb.write(data, 6);
+	const uint8_t *p = rb.peek_pointer(0, &contiguous);
+	LONGS_EQUAL(2, contiguous);
+	LONGS_EQUAL(1, p[0]);
+	POINTERS_EQUAL(NULL, rb.peek_pointer(6, &contiguous));
+}
+
+TEST_GROUP(MsgQueueTemplate) {
+	libmcu::MsgQueue<64> q;
+
+	void setup(void) {
+	}
+	void teardown(void) {
+	}
+};
+
+TEST(MsgQueueTemplate, calcSize_ShouldRoundUpToPowerOf2) {
+	static_assert(libmcu::MsgQueue<8>::calc_size(1, 0) ==
+			sizeof(msgq_msg_meta_t), "");
+	LONGS_EQUAL(msgq_calc_size(3, 10),
+			libmcu::MsgQueue<8>::calc_size(3, 10));
+	LONGS_EQUAL(msgq_calc_size(2, 24),
+			libmcu::MsgQueue<8>::calc_size(2, 24));
+}
+
+TEST(MsgQueueTemplate, pop_ShouldReturnMessage_WhenPushed) {
+	char buf[16];
+	LONGS_EQUAL(0, q.push("hello", 5));
+	LONGS_EQUAL(0, q.push("world!", 6));
+	LONGS_EQUAL(5, q.next_msg_size());
+	LONGS_EQUAL(5, q.pop(buf, sizeof(buf)));
+	MEMCMP_EQUAL("hello", buf, 5);
+	LONGS_EQUAL(6, q.pop(buf, sizeof(buf)));
+	MEMCMP_EQUAL("world!", buf, 6);
+	CHECK_TRUE(q.empty());
+}
+
+TEST(MsgQueueTemplate, pop_ShouldReturnENOENT_WhenEmpty) {
+	char buf[16];
+	LONGS_EQUAL(-ENOENT, q.pop(buf, sizeof(buf)));
+}
+
+TEST(MsgQueueTemplate, pop_ShouldReturnERANGE_WhenBufferTooSmall) {
+	char buf[4];
+	q.push("hello", 5);
+	LONGS_EQUAL(-ERANGE, q.pop(buf, sizeof(buf)));
+	LONGS_EQUAL(5, q.next_msg_size());
+}
+
+TEST(MsgQueueTemplate, push_ShouldReturnENOMEM_WhenNoSpace) {
+	uint8_t data[64] = { 0, };
+	LONGS_EQUAL(64 - sizeof(msgq_msg_meta_t), q.available());
+	LONGS_EQUAL(-ENOMEM, q.push(data, sizeof(data)));
+	LONGS_EQUAL(0, q.push(data, q.available()));
+	LONGS_EQUAL(0, q.available());
+}
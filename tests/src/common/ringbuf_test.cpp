@@ -308,3 +308,86 @@ TEST(RingBuffer, peek_ShouldReturnZero_WhenRingBufferIsEmpty) {
 	uint8_t buf[5];
 	LONGS_EQUAL(0, ringbuf_peek(&ringbuf_obj, 0, buf, sizeof(buf)));
 }
+
+TEST(RingBuffer, write_overwrite_ShouldWriteAll_WhenSpaceAvailable) {
+	prepare_test();
+	const uint8_t test_data[] = "1234567890";
+	LONGS_EQUAL(sizeof(test_data), ringbuf_write_overwrite(&ringbuf_obj,
+			test_data, sizeof(test_data)));
+	LONGS_EQUAL(sizeof(test_data), ringbuf_length(&ringbuf_obj));
+	LONGS_EQUAL(0, ringbuf_dropped(&ringbuf_obj));
+}
+
+TEST(RingBuffer, write_overwrite_ShouldDropOldest_WhenFull) {
+	prepare_test();
+	uint8_t buf[SPACE_SIZE];
+	for (uint8_t i = 0; i < SPACE_SIZE; i++) {
+		ringbuf_write_overwrite(&ringbuf_obj, &i, 1);
+	}
+	const uint8_t newest[] = { 0xA0, 0xA1, 0xA2, 0xA3 };
+	LONGS_EQUAL(sizeof(newest), ringbuf_write_overwrite(&ringbuf_obj,
+			newest, sizeof(newest)));
+	LONGS_EQUAL(SPACE_SIZE, ringbuf_length(&ringbuf_obj));
+
+	LONGS_EQUAL(SPACE_SIZE, ringbuf_read(&ringbuf_obj, 0, buf, sizeof(buf)));
+	LONGS_EQUAL(4, buf[0]);
+	LONGS_EQUAL(SPACE_SIZE - 1, buf[SPACE_SIZE - 5]);
+	MEMCMP_EQUAL(newest, &buf[SPACE_SIZE - 4], sizeof(newest));
+	LONGS_EQUAL(sizeof(newest), ringbuf_dropped(&ringbuf_obj));
+}
+
+TEST(RingBuffer, write_overwrite_ShouldKeepLastPart_WhenLargerThanCapacity) {
+	prepare_test();
+	uint8_t data[SPACE_SIZE + 10];
+	uint8_t buf[SPACE_SIZE];
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)i;
+	}
+	LONGS_EQUAL(SPACE_SIZE, ringbuf_write_overwrite(&ringbuf_obj,
+			data, sizeof(data)));
+	LONGS_EQUAL(SPACE_SIZE, ringbuf_read(&ringbuf_obj, 0, buf, sizeof(buf)));
+	MEMCMP_EQUAL(&data[10], buf, sizeof(buf));
+}
+
+TEST(RingBuffer, consume_ShouldReturnFalse_WhenOverwrittenAfterPeek) {
+	prepare_test();
+	uint8_t data[SPACE_SIZE] = { 0, };
+	uint8_t buf[8];
+	ringbuf_write_overwrite(&ringbuf_obj, data, sizeof(data));
+	ringbuf_peek(&ringbuf_obj, 0, buf, sizeof(buf));
+
+	const uint8_t newest[] = "new";
+	ringbuf_write_overwrite(&ringbuf_obj, newest, sizeof(newest));
+
+	CHECK_FALSE(ringbuf_consume(&ringbuf_obj, sizeof(buf)));
+	LONGS_EQUAL(sizeof(newest), ringbuf_dropped(&ringbuf_obj));
+	LONGS_EQUAL(SPACE_SIZE, ringbuf_length(&ringbuf_obj));
+	CHECK_TRUE(ringbuf_consume(&ringbuf_obj, sizeof(buf)));
+}
+
+TEST(RingBuffer, drop_oldest_ShouldDropWholeRecords) {
+	prepare_test();
+	uint8_t rec[SPACE_SIZE / 4] = { sizeof(rec), };
+	uint8_t header;
+	for (int i = 0; i < 4; i++) {
+		ringbuf_write(&ringbuf_obj, rec, sizeof(rec));
+	}
+	struct local {
+		static size_t get_size(const void *hdr) {
+			return *(const uint8_t *)hdr;
+		}
+	};
+	LONGS_EQUAL(2, ringbuf_drop_oldest(&ringbuf_obj, sizeof(rec) + 1,
+			&header, sizeof(header), local::get_size));
+	LONGS_EQUAL(sizeof(rec) * 2, ringbuf_length(&ringbuf_obj));
+	LONGS_EQUAL(0, ringbuf_drop_oldest(&ringbuf_obj, sizeof(rec),
+			&header, sizeof(header), local::get_size));
+}
+
+TEST(RingBuffer, write_ShouldNotOverwrite_WhenFull) {
+	prepare_test();
+	uint8_t data[SPACE_SIZE] = { 0, };
+	ringbuf_write(&ringbuf_obj, data, sizeof(data));
+	LONGS_EQUAL(0, ringbuf_write(&ringbuf_obj, data, 1));
+	LONGS_EQUAL(0, ringbuf_dropped(&ringbuf_obj));
+}
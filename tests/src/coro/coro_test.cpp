@@ -0,0 +1,413 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+#include "CppUTestExt/MockSupport.h"
+
+#include <string.h>
+
+#include "libmcu/coro.h"
+#include "libmcu/msgq.h"
+#include "libmcu/board.h"
+#include "libmcu/l4.h"
+
+static unsigned long time_ms;
+
+unsigned long board_get_time_since_boot_ms(void) {
+	return time_ms;
+}
+
+struct task {
+	struct coro co;
+	int id;
+	int count;
+	int steps;
+	int last_err;
+	struct coro_event *ev;
+	struct msgq *q;
+	bool cond;
+	char buf[16];
+	struct coro_sched *sched;
+	struct coro *victim;
+	int cancel_err;
+	struct l4 *conn;
+};
+
+/* fake connection returning the queued results one after another, 0 when
+ * nothing is queued as a real one does on its receive timeout */
+struct l4 {
+	int results[4];
+	int nr_results;
+	int nr_reads;
+	const char *data;
+};
+
+int l4_read(struct l4 *self, void *buf, size_t bufsize) {
+	self->nr_reads++;
+	if (self->nr_results == 0) {
+		return 0;
+	}
+
+	const int rc = self->results[0];
+	memmove(self->results, &self->results[1],
+			sizeof(self->results) - sizeof(*self->results));
+	self->nr_results--;
+
+	if (rc > 0) {
+		memcpy(buf, self->data, (size_t)rc < bufsize? (size_t)rc : bufsize);
+	}
+	return rc;
+}
+
+static int trace[16];
+static int nr_trace;
+
+static void wakeup(void *ctx) {
+	mock().actualCall(__func__).withPointerParameter("ctx", ctx);
+}
+
+static coro_status_t yielder(struct coro *co, void *ctx) {
+	struct task *t = (struct task *)ctx;
+	CORO_BEGIN(co);
+	for (t->count = 0; t->count < t->steps; t->count++) {
+		trace[nr_trace++] = t->id;
+		CORO_YIELD(co);
+	}
+	CORO_END(co);
+}
+
+static coro_status_t sleeper(struct coro *co, void *ctx) {
+	struct task *t = (struct task *)ctx;
+	CORO_BEGIN(co);
+	CORO_SLEEP(co, 100);
+	t->count++;
+	CORO_END(co);
+}
+
+static coro_status_t waiter(struct coro *co, void *ctx) {
+	struct task *t = (struct task *)ctx;
+	CORO_BEGIN(co);
+	CORO_AWAIT_EVENT(co, t->ev, 500);
+	t->last_err = co->err;
+	t->count++;
+	CORO_END(co);
+}
+
+static coro_status_t poller(struct coro *co, void *ctx) {
+	struct task *t = (struct task *)ctx;
+	CORO_BEGIN(co);
+	CORO_AWAIT_UNTIL(co, t->cond, 50);
+	t->last_err = co->err;
+	t->count++;
+	CORO_END(co);
+}
+
+static coro_status_t receiver(struct coro *co, void *ctx) {
+	struct task *t = (struct task *)ctx;
+	CORO_BEGIN(co);
+	CORO_AWAIT_MSGQ(co, t->q, t->buf, sizeof(t->buf), CORO_WAIT_FOREVER);
+	t->last_err = co->err;
+	t->count++;
+	CORO_END(co);
+}
+
+static coro_status_t reader(struct coro *co, void *ctx) {
+	struct task *t = (struct task *)ctx;
+	CORO_BEGIN(co);
+	CORO_AWAIT_L4_READ(co, t->conn, t->buf, sizeof(t->buf), 50);
+	t->last_err = co->err;
+	t->count++;
+	CORO_END(co);
+}
+
+/* cancels the victim while being run, as another thread would do while the
+ * scheduler lock is released */
+static coro_status_t canceller(struct coro *co, void *ctx) {
+	struct task *t = (struct task *)ctx;
+	CORO_BEGIN(co);
+	for (;;) {
+		t->count++;
+		t->cancel_err = coro_cancel(t->sched, t->victim);
+		CORO_YIELD(co);
+	}
+	CORO_END(co);
+}
+
+TEST_GROUP(Coro) {
+	struct coro_sched sched;
+	struct coro_event ev;
+	struct task tasks[2];
+
+	void setup(void) {
+		time_ms = 0;
+		nr_trace = 0;
+		memset(tasks, 0, sizeof(tasks));
+		memset(trace, 0, sizeof(trace));
+		mock().ignoreOtherCalls();
+		coro_sched_init(&sched, NULL, NULL);
+		coro_event_init(&ev, &sched);
+	}
+	void teardown(void) {
+		mock().checkExpectations();
+		mock().clear();
+	}
+};
+
+TEST(Coro, spawn_ShouldReturnEINVAL_WhenInvalidParamsGiven) {
+	LONGS_EQUAL(-EINVAL, coro_spawn(NULL, &tasks[0].co, yielder, NULL));
+	LONGS_EQUAL(-EINVAL, coro_spawn(&sched, NULL, yielder, NULL));
+	LONGS_EQUAL(-EINVAL, coro_spawn(&sched, &tasks[0].co, NULL, NULL));
+}
+
+TEST(Coro, spawn_ShouldCallWakeup) {
+	int ctx;
+	coro_sched_init(&sched, wakeup, &ctx);
+	mock().expectOneCall("wakeup").withPointerParameter("ctx", &ctx);
+	LONGS_EQUAL(0, coro_spawn(&sched, &tasks[0].co, yielder, &tasks[0]));
+	LONGS_EQUAL(1, coro_sched_count(&sched));
+}
+
+TEST(Coro, run_ShouldReturnNoDeadline_WhenNothingSpawned) {
+	LONGS_EQUAL(CORO_NO_DEADLINE, coro_sched_run(&sched));
+}
+
+TEST(Coro, run_ShouldInterleaveCoroutines_WhenYielded) {
+	tasks[0] = (struct task) { .id = 1, .steps = 2, };
+	tasks[1] = (struct task) { .id = 2, .steps = 2, };
+	coro_spawn(&sched, &tasks[0].co, yielder, &tasks[0]);
+	coro_spawn(&sched, &tasks[1].co, yielder, &tasks[1]);
+
+	LONGS_EQUAL(0, coro_sched_run(&sched));
+	LONGS_EQUAL(0, coro_sched_run(&sched));
+	LONGS_EQUAL(CORO_NO_DEADLINE, coro_sched_run(&sched));
+
+	LONGS_EQUAL(4, nr_trace);
+	LONGS_EQUAL(1, trace[0]);
+	LONGS_EQUAL(2, trace[1]);
+	LONGS_EQUAL(1, trace[2]);
+	LONGS_EQUAL(2, trace[3]);
+	LONGS_EQUAL(0, coro_sched_count(&sched));
+	CHECK(coro_is_done(&tasks[0].co));
+}
+
+TEST(Coro, run_ShouldReturnTimeUntilWakeup_WhenSleeping) {
+	coro_spawn(&sched, &tasks[0].co, sleeper, &tasks[0]);
+	LONGS_EQUAL(100, coro_sched_run(&sched));
+	time_ms = 60;
+	LONGS_EQUAL(40, coro_sched_run(&sched));
+	LONGS_EQUAL(0, tasks[0].count);
+	time_ms = 100;
+	LONGS_EQUAL(CORO_NO_DEADLINE, coro_sched_run(&sched));
+	LONGS_EQUAL(1, tasks[0].count);
+}
+
+TEST(Coro, run_ShouldWakeSleeper_WhenTimeWrapsAround) {
+	time_ms = UINT32_MAX - 10;
+	coro_spawn(&sched, &tasks[0].co, sleeper, &tasks[0]);
+	LONGS_EQUAL(100, coro_sched_run(&sched));
+	time_ms = 89;
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+}
+
+TEST(Coro, awaitEvent_ShouldResume_WhenSignaled) {
+	int ctx;
+	coro_sched_init(&sched, wakeup, &ctx);
+	tasks[0].ev = &ev;
+	tasks[0].last_err = 1;
+	mock().expectNCalls(2, "wakeup").withPointerParameter("ctx", &ctx);
+	coro_spawn(&sched, &tasks[0].co, waiter, &tasks[0]);
+	LONGS_EQUAL(500, coro_sched_run(&sched));
+
+	coro_event_signal(&ev);
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+	LONGS_EQUAL(0, tasks[0].last_err);
+	CHECK_FALSE(ev.signaled);
+}
+
+TEST(Coro, awaitEvent_ShouldNotWait_WhenAlreadySignaled) {
+	tasks[0].ev = &ev;
+	coro_event_signal(&ev);
+	coro_spawn(&sched, &tasks[0].co, waiter, &tasks[0]);
+	LONGS_EQUAL(CORO_NO_DEADLINE, coro_sched_run(&sched));
+	LONGS_EQUAL(1, tasks[0].count);
+	LONGS_EQUAL(0, tasks[0].last_err);
+}
+
+TEST(Coro, awaitEvent_ShouldSetETIMEDOUT_WhenTimedOut) {
+	tasks[0].ev = &ev;
+	coro_spawn(&sched, &tasks[0].co, waiter, &tasks[0]);
+	coro_sched_run(&sched);
+	time_ms = 499;
+	coro_sched_run(&sched);
+	LONGS_EQUAL(0, tasks[0].count);
+	time_ms = 500;
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+	LONGS_EQUAL(-ETIMEDOUT, tasks[0].last_err);
+}
+
+TEST(Coro, awaitEvent_ShouldWakeOnlyOneWaiter_WhenSignaledOnce) {
+	tasks[0].ev = &ev;
+	tasks[1].ev = &ev;
+	coro_spawn(&sched, &tasks[0].co, waiter, &tasks[0]);
+	coro_spawn(&sched, &tasks[1].co, waiter, &tasks[1]);
+	coro_sched_run(&sched);
+	coro_event_signal(&ev);
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+	LONGS_EQUAL(0, tasks[1].count);
+	LONGS_EQUAL(1, coro_sched_count(&sched));
+}
+
+TEST(Coro, awaitUntil_ShouldReturnPollInterval_WhenConditionNotMet) {
+	coro_spawn(&sched, &tasks[0].co, poller, &tasks[0]);
+	LONGS_EQUAL(CORO_POLL_INTERVAL_MS, coro_sched_run(&sched));
+	time_ms = 45;
+	LONGS_EQUAL(5, coro_sched_run(&sched));
+	tasks[0].cond = true;
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+	LONGS_EQUAL(0, tasks[0].last_err);
+}
+
+TEST(Coro, awaitUntil_ShouldSetETIMEDOUT_WhenTimedOut) {
+	coro_spawn(&sched, &tasks[0].co, poller, &tasks[0]);
+	coro_sched_run(&sched);
+	time_ms = 50;
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+	LONGS_EQUAL(-ETIMEDOUT, tasks[0].last_err);
+}
+
+TEST(Coro, awaitMsgq_ShouldReceiveMessage_WhenPushed) {
+	tasks[0].q = msgq_create(msgq_calc_size(2, 8));
+	coro_spawn(&sched, &tasks[0].co, receiver, &tasks[0]);
+	coro_sched_run(&sched);
+	LONGS_EQUAL(0, tasks[0].count);
+
+	msgq_push(tasks[0].q, "hello", 5);
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+	LONGS_EQUAL(5, tasks[0].last_err);
+	MEMCMP_EQUAL("hello", tasks[0].buf, 5);
+
+	msgq_destroy(tasks[0].q);
+}
+
+TEST(Coro, awaitL4Read_ShouldPollOncePerRun_WhenNothingReceived) {
+	struct l4 conn = { .nr_results = 0, };
+	tasks[0].conn = &conn;
+	coro_spawn(&sched, &tasks[0].co, reader, &tasks[0]);
+
+	LONGS_EQUAL(CORO_POLL_INTERVAL_MS, coro_sched_run(&sched));
+	LONGS_EQUAL(CORO_POLL_INTERVAL_MS, coro_sched_run(&sched));
+	LONGS_EQUAL(2, conn.nr_reads);
+	LONGS_EQUAL(0, tasks[0].count);
+}
+
+TEST(Coro, awaitL4Read_ShouldReturnBytesRead_WhenReceived) {
+	struct l4 conn = { .results = { 0, 5 }, .nr_results = 2,
+		.data = "hello", };
+	tasks[0].conn = &conn;
+	coro_spawn(&sched, &tasks[0].co, reader, &tasks[0]);
+
+	coro_sched_run(&sched);
+	LONGS_EQUAL(0, tasks[0].count);
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+	LONGS_EQUAL(5, tasks[0].last_err);
+	MEMCMP_EQUAL("hello", tasks[0].buf, 5);
+	LONGS_EQUAL(2, conn.nr_reads);
+}
+
+TEST(Coro, awaitL4Read_ShouldReturnError_WhenReadFailed) {
+	struct l4 conn = { .results = { -ECONNRESET }, .nr_results = 1, };
+	tasks[0].conn = &conn;
+	coro_spawn(&sched, &tasks[0].co, reader, &tasks[0]);
+
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+	LONGS_EQUAL(-ECONNRESET, tasks[0].last_err);
+}
+
+TEST(Coro, awaitL4Read_ShouldSetETIMEDOUT_WhenTimedOut) {
+	struct l4 conn = { .nr_results = 0, };
+	tasks[0].conn = &conn;
+	coro_spawn(&sched, &tasks[0].co, reader, &tasks[0]);
+
+	coro_sched_run(&sched);
+	time_ms = 50;
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+	LONGS_EQUAL(-ETIMEDOUT, tasks[0].last_err);
+	LONGS_EQUAL(0, coro_sched_count(&sched));
+}
+
+TEST(Coro, cancel_ShouldRemoveCoroutine) {
+	coro_spawn(&sched, &tasks[0].co, sleeper, &tasks[0]);
+	coro_sched_run(&sched);
+	LONGS_EQUAL(0, coro_cancel(&sched, &tasks[0].co));
+	LONGS_EQUAL(-ENOENT, coro_cancel(&sched, &tasks[0].co));
+	LONGS_EQUAL(0, coro_sched_count(&sched));
+	time_ms = 100;
+	LONGS_EQUAL(CORO_NO_DEADLINE, coro_sched_run(&sched));
+	LONGS_EQUAL(0, tasks[0].count);
+}
+
+TEST(Coro, cancel_ShouldStopCoroutine_WhenCancelledWhileRunning) {
+	tasks[0].sched = &sched;
+	tasks[0].victim = &tasks[0].co;
+	coro_spawn(&sched, &tasks[0].co, canceller, &tasks[0]);
+
+	LONGS_EQUAL(CORO_NO_DEADLINE, coro_sched_run(&sched));
+	LONGS_EQUAL(0, tasks[0].cancel_err);
+	LONGS_EQUAL(1, tasks[0].count);
+	CHECK_TRUE(coro_is_done(&tasks[0].co));
+	LONGS_EQUAL(0, coro_sched_count(&sched));
+	LONGS_EQUAL(-ENOENT, coro_cancel(&sched, &tasks[0].co));
+
+	coro_sched_run(&sched);
+	LONGS_EQUAL(1, tasks[0].count);
+}
+
+TEST(Coro, cancel_ShouldSkipNext_WhenNextCancelledWhileRunning) {
+	tasks[0].sched = &sched;
+	tasks[0].victim = &tasks[1].co;
+	tasks[1] = (struct task) { .id = 2, .steps = 2, };
+	coro_spawn(&sched, &tasks[0].co, canceller, &tasks[0]);
+	coro_spawn(&sched, &tasks[1].co, yielder, &tasks[1]);
+
+	LONGS_EQUAL(0, coro_sched_run(&sched));
+	LONGS_EQUAL(0, tasks[0].cancel_err);
+	LONGS_EQUAL(0, nr_trace);
+	CHECK_TRUE(coro_is_done(&tasks[1].co));
+	LONGS_EQUAL(1, coro_sched_count(&sched));
+
+	coro_sched_run(&sched);
+	LONGS_EQUAL(-ENOENT, tasks[0].cancel_err);
+	LONGS_EQUAL(2, tasks[0].count);
+	LONGS_EQUAL(0, nr_trace);
+	LONGS_EQUAL(0, coro_cancel(&sched, &tasks[0].co));
+}
+
+TEST(Coro, run_ShouldHandleThousandsOfCoroutines) {
+	static struct task many[2000];
+	memset(many, 0, sizeof(many));
+
+	for (unsigned int i = 0; i < sizeof(many) / sizeof(*many); i++) {
+		coro_spawn(&sched, &many[i].co, sleeper, &many[i]);
+	}
+	LONGS_EQUAL(2000, coro_sched_count(&sched));
+	LONGS_EQUAL(100, coro_sched_run(&sched));
+
+	time_ms = 100;
+	coro_sched_run(&sched);
+	LONGS_EQUAL(0, coro_sched_count(&sched));
+	LONGS_EQUAL(1, many[1999].count);
+}
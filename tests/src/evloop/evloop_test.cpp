@@ -0,0 +1,220 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+#include "CppUTestExt/MockSupport.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "libmcu/evloop.h"
+
+static struct evloop *loop;
+static int pa[2];
+static int pb[2];
+
+static void on_fd(struct evloop *l, int fd, uint32_t events, void *ctx) {
+	char buf[16];
+	if (events & EVLOOP_READ) {
+		read(fd, buf, sizeof(buf));
+	}
+	mock().actualCall(__func__)
+		.withParameter("fd", fd)
+		.withParameter("events", events);
+}
+
+static void on_fd_remove_other(struct evloop *l, int fd, uint32_t events,
+		void *ctx) {
+	char buf[16];
+	read(fd, buf, sizeof(buf));
+	evloop_remove_fd(l, *(int *)ctx);
+	mock().actualCall(__func__).withParameter("fd", fd);
+}
+
+static void on_timer(void *ctx) {
+	(*(int *)ctx)++;
+}
+
+static void on_post(void *ctx) {
+	mock().actualCall(__func__).withPointerParameter("ctx", ctx);
+}
+
+static void *poster(void *arg) {
+	evloop_post(loop, on_post, arg);
+	return NULL;
+}
+
+static void *stopper(void *arg) {
+	usleep(10000);
+	evloop_stop(loop);
+	return NULL;
+}
+
+TEST_GROUP(EventLoop) {
+	void setup(void) {
+		loop = evloop_create();
+		pipe(pa);
+		pipe(pb);
+	}
+	void teardown(void) {
+		mock().checkExpectations();
+		mock().clear();
+
+		evloop_destroy(loop);
+		close(pa[0]);
+		close(pa[1]);
+		close(pb[0]);
+		close(pb[1]);
+	}
+};
+
+TEST(EventLoop, run_once_ShouldReturnZero_WhenTimedOut) {
+	LONGS_EQUAL(0, evloop_run_once(loop, 0));
+}
+
+TEST(EventLoop, add_fd_ShouldDispatchReadable) {
+	LONGS_EQUAL(0, evloop_add_fd(loop, pa[0], EVLOOP_READ, on_fd, 0));
+	write(pa[1], "a", 1);
+
+	mock().expectOneCall("on_fd")
+		.withParameter("fd", pa[0])
+		.withParameter("events", EVLOOP_READ);
+	LONGS_EQUAL(1, evloop_run_once(loop, 100));
+	LONGS_EQUAL(0, evloop_run_once(loop, 0));
+}
+
+TEST(EventLoop, add_fd_ShouldReturnEEXIST_WhenAlreadyAdded) {
+	LONGS_EQUAL(0, evloop_add_fd(loop, pa[0], EVLOOP_READ, on_fd, 0));
+	LONGS_EQUAL(-EEXIST, evloop_add_fd(loop, pa[0], EVLOOP_READ, on_fd, 0));
+	LONGS_EQUAL(-EINVAL, evloop_add_fd(loop, -1, EVLOOP_READ, on_fd, 0));
+}
+
+TEST(EventLoop, add_fd_ShouldReturnENOSPC_WhenNoSlotLeft) {
+	int fds[EVLOOP_MAX_WATCHES + 1];
+	for (unsigned int i = 0; i <= EVLOOP_MAX_WATCHES; i++) {
+		fds[i] = dup(pa[0]);
+	}
+	for (unsigned int i = 0; i < EVLOOP_MAX_WATCHES; i++) {
+		LONGS_EQUAL(0, evloop_add_fd(loop, fds[i], EVLOOP_READ, on_fd, 0));
+	}
+	LONGS_EQUAL(-ENOSPC, evloop_add_fd(loop,
+			fds[EVLOOP_MAX_WATCHES], EVLOOP_READ, on_fd, 0));
+	for (unsigned int i = 0; i <= EVLOOP_MAX_WATCHES; i++) {
+		close(fds[i]);
+	}
+}
+
+TEST(EventLoop, modify_fd_ShouldChangeEvents) {
+	LONGS_EQUAL(0, evloop_add_fd(loop, pa[1], EVLOOP_READ, on_fd, 0));
+	LONGS_EQUAL(0, evloop_run_once(loop, 0));
+
+	LONGS_EQUAL(0, evloop_modify_fd(loop, pa[1], EVLOOP_WRITE));
+	mock().expectOneCall("on_fd")
+		.withParameter("fd", pa[1])
+		.withParameter("events", EVLOOP_WRITE);
+	LONGS_EQUAL(1, evloop_run_once(loop, 0));
+
+	LONGS_EQUAL(-ENOENT, evloop_modify_fd(loop, pb[1], EVLOOP_WRITE));
+}
+
+TEST(EventLoop, remove_fd_ShouldStopDispatching) {
+	evloop_add_fd(loop, pa[0], EVLOOP_READ, on_fd, 0);
+	LONGS_EQUAL(0, evloop_remove_fd(loop, pa[0]));
+	write(pa[1], "a", 1);
+
+	LONGS_EQUAL(0, evloop_run_once(loop, 10));
+	LONGS_EQUAL(-ENOENT, evloop_remove_fd(loop, pa[0]));
+}
+
+TEST(EventLoop, remove_fd_ShouldDropPendingEvent_WhenRemovedInCallback) {
+	evloop_add_fd(loop, pa[0], EVLOOP_READ, on_fd_remove_other, &pb[0]);
+	evloop_add_fd(loop, pb[0], EVLOOP_READ, on_fd_remove_other, &pa[0]);
+	write(pa[1], "a", 1);
+	write(pb[1], "a", 1);
+
+	mock().expectOneCall("on_fd_remove_other").ignoreOtherParameters();
+	LONGS_EQUAL(1, evloop_run_once(loop, 100));
+}
+
+TEST(EventLoop, error_ShouldBeReported_WhenPeerClosed) {
+	evloop_add_fd(loop, pa[0], EVLOOP_READ, on_fd, 0);
+	close(pa[1]);
+	pa[1] = dup(pb[1]);
+
+	mock().expectOneCall("on_fd")
+		.withParameter("fd", pa[0])
+		.withParameter("events", EVLOOP_ERROR);
+	LONGS_EQUAL(1, evloop_run_once(loop, 100));
+}
+
+TEST(EventLoop, timer_ShouldFireOnce_WhenOneShot) {
+	int count = 0;
+	struct evloop_timer *timer = evloop_timer_create(loop, on_timer, &count);
+
+	LONGS_EQUAL(0, evloop_timer_start(timer, 10, 0));
+	LONGS_EQUAL(0, evloop_run_once(loop, 0));
+	LONGS_EQUAL(1, evloop_run_once(loop, 1000));
+	LONGS_EQUAL(0, evloop_run_once(loop, 30));
+	LONGS_EQUAL(1, count);
+
+	evloop_timer_destroy(timer);
+}
+
+TEST(EventLoop, timer_ShouldFireImmediately_WhenZeroTimeoutGiven) {
+	int count = 0;
+	struct evloop_timer *timer = evloop_timer_create(loop, on_timer, &count);
+
+	evloop_timer_start(timer, 0, 0);
+	LONGS_EQUAL(1, evloop_run_once(loop, 100));
+	LONGS_EQUAL(1, count);
+
+	evloop_timer_destroy(timer);
+}
+
+TEST(EventLoop, timer_ShouldFirePeriodically_WhenIntervalGiven) {
+	int count = 0;
+	struct evloop_timer *timer = evloop_timer_create(loop, on_timer, &count);
+
+	evloop_timer_start(timer, 1, 1);
+	while (count < 3) {
+		evloop_run_once(loop, 100);
+	}
+	evloop_timer_stop(timer);
+	LONGS_EQUAL(0, evloop_run_once(loop, 10));
+
+	evloop_timer_destroy(timer);
+}
+
+TEST(EventLoop, post_ShouldRunFunctionInLoop_WhenPostedFromAnotherThread) {
+	pthread_t thread;
+	int ctx;
+
+	mock().expectOneCall("on_post").withPointerParameter("ctx", &ctx);
+	pthread_create(&thread, NULL, poster, &ctx);
+	pthread_join(thread, NULL);
+
+	LONGS_EQUAL(1, evloop_run_once(loop, 100));
+}
+
+TEST(EventLoop, post_ShouldReturnENOSPC_WhenQueueFull) {
+	for (unsigned int i = 0; i < EVLOOP_POST_MAXLEN; i++) {
+		LONGS_EQUAL(0, evloop_post(loop, on_post, 0));
+	}
+	LONGS_EQUAL(-ENOSPC, evloop_post(loop, on_post, 0));
+
+	mock().expectNCalls(EVLOOP_POST_MAXLEN, "on_post").ignoreOtherParameters();
+	LONGS_EQUAL(EVLOOP_POST_MAXLEN, evloop_run_once(loop, 0));
+}
+
+TEST(EventLoop, run_ShouldReturn_WhenStoppedFromAnotherThread) {
+	pthread_t thread;
+
+	pthread_create(&thread, NULL, stopper, NULL);
+	LONGS_EQUAL(0, evloop_run(loop));
+	pthread_join(thread, NULL);
+}
@@ -7,6 +7,9 @@
 #include "CppUTest/TestHarness.h"
 #include "CppUTest/TestHarness_c.h"
 
+#include <stdio.h>
+#include <string.h>
+
 #include "memory_kvstore.h"
 
 TEST_GROUP(MemoryKVStore) {
@@ -138,3 +141,53 @@ TEST(MemoryKVStore, new_ShouldReturnNull_WhenAllocFails) {
 	POINTERS_EQUAL(NULL, memory_kvstore_create("newNs"));
 	cpputest_malloc_set_not_out_of_memory();
 }
+
+static bool collect_key(char const *key, size_t size, void *ctx)
+{
+	char *keys = (char *)ctx;
+	size_t len = strlen(keys);
+	snprintf(&keys[len], 128 - len, "%s:%u,", key, (unsigned int)size);
+	return true;
+}
+
+static bool stop_at_first(char const *key, size_t size, void *ctx)
+{
+	(*(int *)ctx)++;
+	return false;
+}
+
+TEST(MemoryKVStore, iterate_ShouldVisitKeysInOrderOfCreation) {
+	uint32_t val = 0;
+	char keys[128] = { 0, };
+
+	kvstore_write(storage, "a/1", &val, sizeof(val));
+	kvstore_write(storage, "b/1", &val, 1);
+	kvstore_write(storage, "a/2", &val, 2);
+	kvstore_write(storage, "a/1", &val, 3);
+
+	LONGS_EQUAL(0, kvstore_iterate(storage, NULL, collect_key, &keys));
+	STRCMP_EQUAL("a/1:3,b/1:1,a/2:2,", keys);
+}
+
+TEST(MemoryKVStore, iterate_ShouldVisitOnlyMatchingKeys_WhenPrefixGiven) {
+	uint32_t val = 0;
+	char keys[128] = { 0, };
+
+	kvstore_write(storage, "a/1", &val, sizeof(val));
+	kvstore_write(storage, "b/1", &val, sizeof(val));
+	kvstore_write(storage, "a/2", &val, sizeof(val));
+
+	LONGS_EQUAL(0, kvstore_iterate(storage, "a/", collect_key, &keys));
+	STRCMP_EQUAL("a/1:4,a/2:4,", keys);
+}
+
+TEST(MemoryKVStore, iterate_ShouldStop_WhenCallbackReturnsFalse) {
+	uint32_t val = 0;
+	int count = 0;
+
+	kvstore_write(storage, "key1", &val, sizeof(val));
+	kvstore_write(storage, "key2", &val, sizeof(val));
+
+	LONGS_EQUAL(0, kvstore_iterate(storage, "", stop_at_first, &count));
+	LONGS_EQUAL(1, count);
+}
@@ -0,0 +1,205 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include "libmcu/i2c_regmap.h"
+#include "fake_i2c.h"
+
+#define REG_STATUS			0x10
+
+static bool is_volatile(uint32_t reg, void *ctx) {
+	return reg == REG_STATUS;
+}
+
+TEST_GROUP(I2CRegmap) {
+	struct i2c_device *dev;
+	struct i2c_regmap *map;
+	uint8_t *regs;
+
+	void setup(void) {
+		struct i2c_regmap_param param = {
+			.reg_addr_bits = 8,
+			.nr_regs = 0x20,
+			.max_burst_len = 8,
+			.timeout_ms = 100,
+			.is_volatile = is_volatile,
+			.is_volatile_ctx = NULL,
+		};
+
+		dev = fake_i2c_create_device();
+		regs = fake_i2c_regs(dev);
+		for (unsigned int i = 0; i < FAKE_I2C_NR_REGS; i++) {
+			regs[i] = (uint8_t)i;
+		}
+		map = i2c_regmap_create(dev, &param);
+	}
+	void teardown(void) {
+		i2c_regmap_destroy(map);
+	}
+
+	const struct fake_i2c_stats *stats(void) {
+		return fake_i2c_stats(dev);
+	}
+};
+
+TEST(I2CRegmap, create_ShouldReturnNull_WhenNoRegistersGiven) {
+	struct i2c_regmap_param param = { .reg_addr_bits = 8, };
+	POINTERS_EQUAL(NULL, i2c_regmap_create(dev, &param));
+}
+
+TEST(I2CRegmap, read_ShouldReturnEINVAL_WhenOutOfRange) {
+	uint8_t buf[2];
+	LONGS_EQUAL(-EINVAL, i2c_regmap_read(map, 0x1f, buf, 2));
+	LONGS_EQUAL(-EINVAL, i2c_regmap_read(map, 0x20, buf, 1));
+	LONGS_EQUAL(-EINVAL, i2c_regmap_read(map, 0, buf, 0));
+}
+
+TEST(I2CRegmap, read_ShouldBeServedFromCache_WhenReadAgain) {
+	uint8_t buf[4];
+	LONGS_EQUAL(0, i2c_regmap_read(map, 0, buf, sizeof(buf)));
+	LONGS_EQUAL(0, i2c_regmap_read(map, 0, buf, sizeof(buf)));
+	LONGS_EQUAL(1, stats()->nr_reads);
+	LONGS_EQUAL(3, buf[3]);
+}
+
+TEST(I2CRegmap, read_ShouldAlwaysGoToBus_WhenVolatile) {
+	uint8_t val;
+	LONGS_EQUAL(0, i2c_regmap_read(map, REG_STATUS, &val, 1));
+	regs[REG_STATUS] = 0xa5;
+	LONGS_EQUAL(0, i2c_regmap_read(map, REG_STATUS, &val, 1));
+	LONGS_EQUAL(0xa5, val);
+	LONGS_EQUAL(2, stats()->nr_reads);
+}
+
+TEST(I2CRegmap, read_ShouldCoalesceUncachedRegistersIntoOneBurst) {
+	uint8_t buf[6];
+	LONGS_EQUAL(0, i2c_regmap_read(map, 2, buf, 2));
+	regs[2] = 0xff; /* the cached value should win */
+	fake_i2c_reset_stats(dev);
+
+	LONGS_EQUAL(0, i2c_regmap_read(map, 0, buf, sizeof(buf)));
+	LONGS_EQUAL(1, stats()->nr_reads);
+	const uint8_t expected[] = { 0, 1, 2, 3, 4, 5 };
+	MEMCMP_EQUAL(expected, buf, sizeof(buf));
+}
+
+TEST(I2CRegmap, read_ShouldSplitBurst_WhenLongerThanMaxBurstLen) {
+	uint8_t buf[20];
+	LONGS_EQUAL(0, i2c_regmap_read(map, 0, buf, sizeof(buf)));
+	LONGS_EQUAL(3, stats()->nr_reads);
+	LONGS_EQUAL(19, buf[19]);
+}
+
+TEST(I2CRegmap, write_ShouldWriteThroughInOneBurst_WhenNotDeferred) {
+	const uint8_t data[] = { 0xa, 0xb, 0xc };
+	uint8_t buf[3];
+	LONGS_EQUAL(0, i2c_regmap_write(map, 4, data, sizeof(data)));
+	LONGS_EQUAL(1, stats()->nr_writes);
+	MEMCMP_EQUAL(data, &regs[4], sizeof(data));
+
+	LONGS_EQUAL(0, i2c_regmap_read(map, 4, buf, sizeof(buf)));
+	LONGS_EQUAL(0, stats()->nr_reads);
+	MEMCMP_EQUAL(data, buf, sizeof(buf));
+}
+
+TEST(I2CRegmap, write_ShouldInvalidateCache_WhenBusFails) {
+	const uint8_t data = 0x55;
+	uint8_t val;
+	fake_i2c_inject_error(dev, -EIO);
+	LONGS_EQUAL(-EIO, i2c_regmap_write(map, 1, &data, 1));
+	LONGS_EQUAL(0, i2c_regmap_read(map, 1, &val, 1));
+	LONGS_EQUAL(1, val);
+	LONGS_EQUAL(1, stats()->nr_reads);
+}
+
+TEST(I2CRegmap, update_bits_ShouldNotTouchBus_WhenValueUnchanged) {
+	LONGS_EQUAL(0, i2c_regmap_update_bits(map, 3, 0x03, 0x03));
+	LONGS_EQUAL(1, stats()->nr_reads);
+	LONGS_EQUAL(0, stats()->nr_writes);
+}
+
+TEST(I2CRegmap, update_bits_ShouldReadOnce_WhenModifiedRepeatedly) {
+	LONGS_EQUAL(0, i2c_regmap_update_bits(map, 3, 0x80, 0x80));
+	LONGS_EQUAL(0, i2c_regmap_update_bits(map, 3, 0x01, 0x00));
+	LONGS_EQUAL(1, stats()->nr_reads);
+	LONGS_EQUAL(2, stats()->nr_writes);
+	LONGS_EQUAL(0x82, regs[3]);
+}
+
+TEST(I2CRegmap, defer_ShouldHoldWritesUntilFlush) {
+	i2c_regmap_defer(map);
+	LONGS_EQUAL(0, i2c_regmap_update_bits(map, 1, 0xf0, 0x10));
+	LONGS_EQUAL(0, i2c_regmap_update_bits(map, 2, 0xf0, 0x20));
+	LONGS_EQUAL(0, i2c_regmap_update_bits(map, 3, 0xf0, 0x30));
+	LONGS_EQUAL(0, stats()->nr_writes);
+	LONGS_EQUAL(1, regs[1]);
+
+	LONGS_EQUAL(0, i2c_regmap_flush(map));
+	LONGS_EQUAL(1, stats()->nr_writes);
+	LONGS_EQUAL(3, stats()->bytes_written);
+	const uint8_t expected[] = { 0x11, 0x22, 0x33 };
+	MEMCMP_EQUAL(expected, &regs[1], sizeof(expected));
+}
+
+TEST(I2CRegmap, flush_ShouldBridgeCleanCachedRegisters) {
+	uint8_t buf[8];
+	LONGS_EQUAL(0, i2c_regmap_read(map, 0, buf, sizeof(buf)));
+	i2c_regmap_defer(map);
+	LONGS_EQUAL(0, i2c_regmap_update_bits(map, 0, 0xff, 0xa0));
+	LONGS_EQUAL(0, i2c_regmap_update_bits(map, 5, 0xff, 0xa5));
+
+	LONGS_EQUAL(0, i2c_regmap_flush(map));
+	LONGS_EQUAL(1, stats()->nr_writes);
+	LONGS_EQUAL(6, stats()->bytes_written);
+	const uint8_t expected[] = { 0xa0, 1, 2, 3, 4, 0xa5 };
+	MEMCMP_EQUAL(expected, regs, sizeof(expected));
+}
+
+TEST(I2CRegmap, flush_ShouldSplitBurst_WhenUncachedRegisterInBetween) {
+	i2c_regmap_defer(map);
+	LONGS_EQUAL(0, i2c_regmap_update_bits(map, 0, 0xff, 0xa0));
+	LONGS_EQUAL(0, i2c_regmap_update_bits(map, 5, 0xff, 0xa5));
+	LONGS_EQUAL(0, i2c_regmap_flush(map));
+	LONGS_EQUAL(2, stats()->nr_writes);
+	LONGS_EQUAL(2, stats()->bytes_written);
+}
+
+TEST(I2CRegmap, flush_ShouldKeepDirty_WhenBusFails) {
+	const uint8_t data[] = { 0xaa, 0xbb };
+	i2c_regmap_defer(map);
+	LONGS_EQUAL(0, i2c_regmap_write(map, 8, data, sizeof(data)));
+	fake_i2c_inject_error(dev, -EIO);
+	LONGS_EQUAL(-EIO, i2c_regmap_flush(map));
+	LONGS_EQUAL(8, regs[8]);
+
+	LONGS_EQUAL(0, i2c_regmap_flush(map));
+	MEMCMP_EQUAL(data, &regs[8], sizeof(data));
+	LONGS_EQUAL(0, i2c_regmap_flush(map));
+	LONGS_EQUAL(1, stats()->nr_writes);
+}
+
+TEST(I2CRegmap, write_ShouldGoOutImmediately_WhenVolatileEvenIfDeferred) {
+	const uint8_t val = 0x80;
+	i2c_regmap_defer(map);
+	LONGS_EQUAL(0, i2c_regmap_write(map, REG_STATUS, &val, 1));
+	LONGS_EQUAL(1, stats()->nr_writes);
+	LONGS_EQUAL(0x80, regs[REG_STATUS]);
+}
+
+TEST(I2CRegmap, invalidate_ShouldDropCache) {
+	uint8_t val;
+	LONGS_EQUAL(0, i2c_regmap_read(map, 0, &val, 1));
+	regs[0] = 0x77;
+	i2c_regmap_invalidate(map);
+	LONGS_EQUAL(0, i2c_regmap_read(map, 0, &val, 1));
+	LONGS_EQUAL(0x77, val);
+	LONGS_EQUAL(2, stats()->nr_reads);
+}
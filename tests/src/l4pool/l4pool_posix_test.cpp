@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "libmcu/l4pool.h"
+#include "libmcu/board.h"
+
+/* l4pool over the TCP implementation in ports/posix/l4.c, talking to a
+ * listener on the loopback interface. */
+
+static unsigned long time_ms;
+
+unsigned long board_get_time_since_boot_ms(void) {
+	return time_ms;
+}
+
+uint32_t board_random(void) {
+	return 0;
+}
+
+/* an idle connection reads nothing until its receive timeout while a closed
+ * one reads -ECONNRESET */
+static int health_check(struct l4 *conn, void *ctx) {
+	char buf[8];
+	const int rc = l4_read(conn, buf, sizeof(buf));
+	return rc < 0? rc : 0;
+}
+
+TEST_GROUP(L4PoolPosix) {
+	struct l4pool *pool;
+	struct l4_conn_param ep;
+	int listener;
+	int peers[2];
+	int nr_peers;
+
+	void setup(void) {
+		struct l4pool_param param = {
+			.max_connections = 2,
+			.idle_timeout_ms = 60000,
+			.keepalive_interval_ms = 10000,
+			.retry = {
+				.max_attempts = 2,
+				.min_backoff_ms = 1000,
+				.max_backoff_ms = 4000,
+				.max_jitter_ms = 0,
+			},
+		};
+		struct sockaddr_in addr = {
+			.sin_family = AF_INET,
+			.sin_port = 0,
+			.sin_addr = { .s_addr = htonl(INADDR_LOOPBACK) },
+		};
+		socklen_t addrlen = sizeof(addr);
+
+		time_ms = 0;
+		nr_peers = 0;
+
+		listener = socket(AF_INET, SOCK_STREAM, 0);
+		CHECK(listener >= 0);
+		LONGS_EQUAL(0, bind(listener,
+				(struct sockaddr *)&addr, sizeof(addr)));
+		LONGS_EQUAL(0, listen(listener, 2));
+		LONGS_EQUAL(0, getsockname(listener,
+				(struct sockaddr *)&addr, &addrlen));
+
+		memset(&ep, 0, sizeof(ep));
+		l4_set_endpoint(&ep, "127.0.0.1", 9, ntohs(addr.sin_port));
+		ep.timeout_ms = 100;
+
+		pool = l4pool_create(&param);
+		l4pool_set_health_check(pool, health_check, NULL);
+	}
+	void teardown(void) {
+		l4pool_destroy(pool);
+
+		for (int i = 0; i < nr_peers; i++) {
+			if (peers[i] >= 0) {
+				close(peers[i]);
+			}
+		}
+		close(listener);
+	}
+
+	bool is_pending(int timeout_ms) {
+		struct pollfd pfd = { .fd = listener, .events = POLLIN, };
+		return poll(&pfd, 1, timeout_ms) == 1;
+	}
+	int accept_peer(void) {
+		CHECK(is_pending(1000));
+		const int fd = accept(listener, NULL, NULL);
+		CHECK(fd >= 0);
+		peers[nr_peers++] = fd;
+		return fd;
+	}
+	void close_peer(int fd) {
+		for (int i = 0; i < nr_peers; i++) {
+			if (peers[i] == fd) {
+				peers[i] = -1;
+			}
+		}
+		close(fd);
+	}
+	void check_exchange(struct l4 *conn, int peer) {
+		char buf[8] = { 0, };
+		LONGS_EQUAL(4, l4_write(conn, "ping", 4));
+		LONGS_EQUAL(4, recv(peer, buf, sizeof(buf), 0));
+		MEMCMP_EQUAL("ping", buf, 4);
+		LONGS_EQUAL(4, send(peer, "pong", 4, 0));
+		LONGS_EQUAL(4, l4_read(conn, buf, sizeof(buf)));
+		MEMCMP_EQUAL("pong", buf, 4);
+	}
+};
+
+TEST(L4PoolPosix, acquire_ShouldConnectToServer) {
+	struct l4 *conn = NULL;
+	LONGS_EQUAL(0, l4pool_acquire(pool, &ep, &conn));
+	CHECK(conn != NULL);
+	check_exchange(conn, accept_peer());
+	LONGS_EQUAL(1, l4pool_count(pool));
+}
+
+TEST(L4PoolPosix, acquire_ShouldReturnError_WhenServerNotListening) {
+	struct l4 *conn = NULL;
+	close(listener);
+	listener = socket(AF_INET, SOCK_STREAM, 0);
+	LONGS_EQUAL(-ECONNREFUSED, l4pool_acquire(pool, &ep, &conn));
+	LONGS_EQUAL(0, l4pool_count(pool));
+}
+
+TEST(L4PoolPosix, acquire_ShouldReuseConnection_WhenKeptAlive) {
+	struct l4 *conn = NULL;
+	struct l4 *reused = NULL;
+	LONGS_EQUAL(0, l4pool_acquire(pool, &ep, &conn));
+	const int peer = accept_peer();
+	LONGS_EQUAL(0, l4pool_release(pool, conn));
+
+	time_ms = 10000;
+	l4pool_step(pool);
+	LONGS_EQUAL(1, l4pool_count(pool));
+
+	LONGS_EQUAL(0, l4pool_acquire(pool, &ep, &reused));
+	POINTERS_EQUAL(conn, reused);
+	CHECK_FALSE(is_pending(0));
+	check_exchange(reused, peer);
+}
+
+TEST(L4PoolPosix, step_ShouldCloseConnection_WhenServerClosed) {
+	struct l4 *conn = NULL;
+	LONGS_EQUAL(0, l4pool_acquire(pool, &ep, &conn));
+	close_peer(accept_peer());
+	LONGS_EQUAL(0, l4pool_release(pool, conn));
+
+	time_ms = 10000;
+	l4pool_step(pool);
+	LONGS_EQUAL(0, l4pool_count(pool));
+}
+
+TEST(L4PoolPosix, acquire_ShouldReconnect_WhenServerClosedIdleConnection) {
+	struct l4 *conn = NULL;
+	LONGS_EQUAL(0, l4pool_acquire(pool, &ep, &conn));
+	close_peer(accept_peer());
+	LONGS_EQUAL(0, l4pool_release(pool, conn));
+
+	time_ms = 10000;
+	LONGS_EQUAL(0, l4pool_acquire(pool, &ep, &conn));
+	check_exchange(conn, accept_peer());
+	LONGS_EQUAL(1, l4pool_count(pool));
+}
@@ -0,0 +1,267 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+#include "CppUTestExt/MockSupport.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include "libmcu/l4pool.h"
+#include "libmcu/board.h"
+
+struct l4 {
+	const struct l4_conn_param *param;
+};
+
+static struct l4 conns[L4POOL_MAX_CONNECTIONS * 2];
+static unsigned int nr_conns;
+static unsigned long time_ms;
+
+unsigned long board_get_time_since_boot_ms(void) {
+	return time_ms;
+}
+
+uint32_t board_random(void) {
+	return 0;
+}
+
+struct l4 *tls_create(const struct l4_conn_param *param) {
+	mock().actualCall(__func__);
+	struct l4 *conn = &conns[nr_conns++ % (L4POOL_MAX_CONNECTIONS * 2)];
+	conn->param = param;
+	return conn;
+}
+
+void tls_destroy(struct l4 *self) {
+	mock().actualCall(__func__).withPointerParameter("self", self);
+}
+
+int l4_connect(struct l4 *self) {
+	return mock().actualCall(__func__).returnIntValueOrDefault(0);
+}
+
+int l4_disconnect(struct l4 *self) {
+	return mock().actualCall(__func__).withPointerParameter("self", self)
+		.returnIntValueOrDefault(0);
+}
+
+static int health_check(struct l4 *conn, void *ctx) {
+	return mock().actualCall(__func__).withPointerParameter("conn", conn)
+		.returnIntValueOrDefault(0);
+}
+
+TEST_GROUP(L4Pool) {
+	struct l4pool *pool;
+	struct l4_conn_param ep1;
+	struct l4_conn_param ep2;
+
+	void setup(void) {
+		struct l4pool_param param = {
+			.max_connections = 2,
+			.idle_timeout_ms = 60000,
+			.keepalive_interval_ms = 10000,
+			.retry = {
+				.max_attempts = 2,
+				.min_backoff_ms = 1000,
+				.max_backoff_ms = 4000,
+				.max_jitter_ms = 0,
+			},
+		};
+
+		nr_conns = 0;
+		time_ms = 0;
+
+		memset(&ep1, 0, sizeof(ep1));
+		memset(&ep2, 0, sizeof(ep2));
+		l4_set_endpoint(&ep1, "ep1.libmcu.org", 14, 8883);
+		l4_set_endpoint(&ep2, "ep2.libmcu.org", 14, 8883);
+
+		pool = l4pool_create(&param);
+	}
+	void teardown(void) {
+		mock().checkExpectations();
+		mock().clear();
+
+		mock().ignoreOtherCalls();
+		l4pool_destroy(pool);
+		mock().clear();
+	}
+
+	struct l4 *connect(const struct l4_conn_param *ep) {
+		struct l4 *conn = NULL;
+		mock().expectOneCall("tls_create");
+		mock().expectOneCall("l4_connect").andReturnValue(0);
+		LONGS_EQUAL(0, l4pool_acquire(pool, ep, &conn));
+		return conn;
+	}
+	void fail_to_connect(const struct l4_conn_param *ep, int expected) {
+		struct l4 *conn = NULL;
+		mock().expectOneCall("tls_create");
+		mock().expectOneCall("l4_connect").andReturnValue(-ECONNREFUSED);
+		mock().expectOneCall("tls_destroy").ignoreOtherParameters();
+		LONGS_EQUAL(expected, l4pool_acquire(pool, ep, &conn));
+	}
+};
+
+TEST(L4Pool, create_ShouldReturnNull_WhenMaxConnectionsExceedsLimit) {
+	struct l4pool_param param = { .max_connections = L4POOL_MAX_CONNECTIONS + 1, };
+	POINTERS_EQUAL(NULL, l4pool_create(&param));
+	param.max_connections = 0;
+	POINTERS_EQUAL(NULL, l4pool_create(&param));
+}
+
+TEST(L4Pool, acquire_ShouldConnect_WhenNoIdleConnectionForEndpoint) {
+	struct l4 *conn = connect(&ep1);
+	CHECK(conn != NULL);
+	LONGS_EQUAL(1, l4pool_count(pool));
+}
+
+TEST(L4Pool, acquire_ShouldHandOutIdleConnection_WhenReleased) {
+	struct l4 *conn = connect(&ep1);
+	struct l4 *reused;
+	LONGS_EQUAL(0, l4pool_release(pool, conn));
+
+	LONGS_EQUAL(0, l4pool_acquire(pool, &ep1, &reused));
+	POINTERS_EQUAL(conn, reused);
+	LONGS_EQUAL(1, l4pool_count(pool));
+}
+
+TEST(L4Pool, acquire_ShouldOpenAnotherConnection_WhenSameEndpointIsLeased) {
+	struct l4 *conn1 = connect(&ep1);
+	struct l4 *conn2 = connect(&ep1);
+	CHECK(conn1 != conn2);
+	LONGS_EQUAL(2, l4pool_count(pool));
+}
+
+TEST(L4Pool, acquire_ShouldReturnEBUSY_WhenAllConnectionsLeased) {
+	struct l4 *conn;
+	connect(&ep1);
+	connect(&ep2);
+	LONGS_EQUAL(-EBUSY, l4pool_acquire(pool, &ep1, &conn));
+}
+
+TEST(L4Pool, acquire_ShouldEvictIdleConnection_WhenPoolIsFull) {
+	struct l4 *conn1 = connect(&ep1);
+	connect(&ep1);
+	l4pool_release(pool, conn1);
+
+	mock().expectOneCall("l4_disconnect").withPointerParameter("self", conn1);
+	mock().expectOneCall("tls_destroy").withPointerParameter("self", conn1);
+	connect(&ep2);
+	LONGS_EQUAL(2, l4pool_count(pool));
+}
+
+TEST(L4Pool, acquire_ShouldReturnEAGAIN_WhenBackingOffFromFailure) {
+	struct l4 *conn;
+	fail_to_connect(&ep1, -ECONNREFUSED);
+	LONGS_EQUAL(-EAGAIN, l4pool_acquire(pool, &ep1, &conn));
+	time_ms = 999;
+	LONGS_EQUAL(-EAGAIN, l4pool_acquire(pool, &ep1, &conn));
+	LONGS_EQUAL(0, l4pool_count(pool));
+}
+
+TEST(L4Pool, acquire_ShouldReconnect_WhenBackoffElapsed) {
+	fail_to_connect(&ep1, -ECONNREFUSED);
+	time_ms = 1000;
+	CHECK(connect(&ep1) != NULL);
+}
+
+TEST(L4Pool, acquire_ShouldNotBeAffected_WhenAnotherEndpointIsBackingOff) {
+	fail_to_connect(&ep1, -ECONNREFUSED);
+	CHECK(connect(&ep2) != NULL);
+}
+
+TEST(L4Pool, acquire_ShouldReturnETIMEDOUT_WhenRetryExhausted) {
+	fail_to_connect(&ep1, -ECONNREFUSED);
+	time_ms += 1000;
+	fail_to_connect(&ep1, -ECONNREFUSED);
+	time_ms += 2000;
+	fail_to_connect(&ep1, -ETIMEDOUT);
+	CHECK(connect(&ep1) != NULL);
+}
+
+TEST(L4Pool, release_ShouldReturnENOENT_WhenUnknownConnectionGiven) {
+	struct l4 unknown;
+	LONGS_EQUAL(-ENOENT, l4pool_release(pool, &unknown));
+	LONGS_EQUAL(-ENOENT, l4pool_invalidate(pool, &unknown));
+}
+
+TEST(L4Pool, invalidate_ShouldCloseConnectionAndBackoff) {
+	struct l4 *conn = connect(&ep1);
+	mock().expectOneCall("l4_disconnect").withPointerParameter("self", conn);
+	mock().expectOneCall("tls_destroy").withPointerParameter("self", conn);
+	LONGS_EQUAL(0, l4pool_invalidate(pool, conn));
+	LONGS_EQUAL(0, l4pool_count(pool));
+	LONGS_EQUAL(-EAGAIN, l4pool_acquire(pool, &ep1, &conn));
+}
+
+TEST(L4Pool, step_ShouldCloseIdleConnection_WhenIdleTimeoutExpired) {
+	struct l4 *conn = connect(&ep1);
+	l4pool_release(pool, conn);
+
+	time_ms = 59999;
+	l4pool_step(pool);
+	LONGS_EQUAL(1, l4pool_count(pool));
+
+	time_ms = 60000;
+	mock().expectOneCall("l4_disconnect").withPointerParameter("self", conn);
+	mock().expectOneCall("tls_destroy").withPointerParameter("self", conn);
+	l4pool_step(pool);
+	LONGS_EQUAL(0, l4pool_count(pool));
+}
+
+TEST(L4Pool, step_ShouldNotTouchLeasedConnection) {
+	connect(&ep1);
+	time_ms = 60000;
+	l4pool_step(pool);
+	LONGS_EQUAL(1, l4pool_count(pool));
+}
+
+TEST(L4Pool, step_ShouldCheckHealth_WhenKeepaliveIntervalElapsed) {
+	struct l4 *conn = connect(&ep1);
+	l4pool_set_health_check(pool, health_check, NULL);
+	l4pool_release(pool, conn);
+
+	time_ms = 9999;
+	l4pool_step(pool);
+
+	time_ms = 10000;
+	mock().expectOneCall("health_check").withPointerParameter("conn", conn)
+		.andReturnValue(0);
+	l4pool_step(pool);
+	LONGS_EQUAL(1, l4pool_count(pool));
+}
+
+TEST(L4Pool, step_ShouldCloseConnection_WhenHealthCheckFails) {
+	struct l4 *conn = connect(&ep1);
+	l4pool_set_health_check(pool, health_check, NULL);
+	l4pool_release(pool, conn);
+
+	time_ms = 10000;
+	mock().expectOneCall("health_check").withPointerParameter("conn", conn)
+		.andReturnValue(-EPIPE);
+	mock().expectOneCall("l4_disconnect").withPointerParameter("self", conn);
+	mock().expectOneCall("tls_destroy").withPointerParameter("self", conn);
+	l4pool_step(pool);
+	LONGS_EQUAL(0, l4pool_count(pool));
+}
+
+TEST(L4Pool, acquire_ShouldReconnect_WhenStaleIdleConnectionFailsHealthCheck) {
+	struct l4 *conn = connect(&ep1);
+	l4pool_set_health_check(pool, health_check, NULL);
+	l4pool_release(pool, conn);
+
+	time_ms = 10000;
+	mock().expectOneCall("health_check").withPointerParameter("conn", conn)
+		.andReturnValue(-EPIPE);
+	mock().expectOneCall("l4_disconnect").withPointerParameter("self", conn);
+	mock().expectOneCall("tls_destroy").withPointerParameter("self", conn);
+	struct l4 *reconnected = connect(&ep1);
+	CHECK(reconnected != conn);
+	LONGS_EQUAL(1, l4pool_count(pool));
+}
@@ -0,0 +1,225 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+
+#include <string.h>
+
+#include "libmcu/logging_noinit.h"
+#include "libmcu/crc16.h"
+
+static uint8_t persisted[256];
+static size_t persisted_len;
+static size_t persisted_count;
+static size_t persist_limit;
+
+static size_t persist(const void *data, size_t size) {
+	if (persisted_count >= persist_limit) {
+		return 0;
+	}
+	memcpy(&persisted[persisted_len], data, size);
+	persisted_len += size;
+	persisted_count++;
+	return size;
+}
+
+static const struct logging_backend flash_backend = {
+	.write = persist,
+};
+
+TEST_GROUP(LoggingNoinit) {
+	uint32_t noinit[32];
+	const struct logging_backend *backend;
+
+	void setup(void) {
+		memset(noinit, 0xa5, sizeof(noinit));
+		memset(persisted, 0, sizeof(persisted));
+		persisted_len = 0;
+		persisted_count = 0;
+		persist_limit = 100;
+
+		backend = logging_noinit_init(noinit, sizeof(noinit));
+	}
+	void teardown(void) {
+	}
+
+	void reset(void) {
+		backend = logging_noinit_init(noinit, sizeof(noinit));
+	}
+
+	/* magic, capacity, index, outdex, count, crc */
+	void set_header(uint32_t index, uint32_t outdex, uint32_t count) {
+		noinit[2] = index;
+		noinit[3] = outdex;
+		noinit[4] = count;
+		noinit[5] = crc16_modbus(noinit, 20);
+	}
+};
+
+TEST(LoggingNoinit, init_ShouldReturnNull_WhenBufferTooSmall) {
+	uint32_t buf[4];
+	POINTERS_EQUAL(NULL, logging_noinit_init(NULL, 128));
+	POINTERS_EQUAL(NULL, logging_noinit_init(buf, sizeof(buf)));
+}
+
+TEST(LoggingNoinit, init_ShouldStartEmpty_WhenGarbageGiven) {
+	CHECK(backend != NULL);
+	LONGS_EQUAL(0, logging_noinit_recovered());
+	LONGS_EQUAL(0, backend->count());
+}
+
+TEST(LoggingNoinit, read_ShouldReturnRecordsInOrder) {
+	char buf[16];
+	LONGS_EQUAL(5, backend->write("first", 5));
+	LONGS_EQUAL(6, backend->write("second", 6));
+	LONGS_EQUAL(2, backend->count());
+
+	LONGS_EQUAL(5, backend->peek(buf, sizeof(buf)));
+	LONGS_EQUAL(5, backend->read(buf, sizeof(buf)));
+	MEMCMP_EQUAL("first", buf, 5);
+	LONGS_EQUAL(6, backend->read(buf, sizeof(buf)));
+	MEMCMP_EQUAL("second", buf, 6);
+	LONGS_EQUAL(0, backend->read(buf, sizeof(buf)));
+}
+
+TEST(LoggingNoinit, read_ShouldReturnZero_WhenBufferTooSmall) {
+	char buf[4];
+	backend->write("first", 5);
+	LONGS_EQUAL(0, backend->read(buf, sizeof(buf)));
+	LONGS_EQUAL(1, backend->count());
+}
+
+TEST(LoggingNoinit, write_ShouldDropOldest_WhenFull) {
+	char buf[64];
+	memset(buf, 'x', sizeof(buf));
+	for (int i = 0; i < 10; i++) {
+		buf[0] = (char)('0' + i);
+		LONGS_EQUAL(30, backend->write(buf, 30));
+	}
+	LONGS_EQUAL(3, backend->count());
+	backend->read(buf, sizeof(buf));
+	LONGS_EQUAL('7', buf[0]);
+}
+
+TEST(LoggingNoinit, write_ShouldReturnZero_WhenRecordLargerThanRing) {
+	LONGS_EQUAL(0, backend->write(persisted, sizeof(noinit)));
+	LONGS_EQUAL(0, backend->write(persisted, 0));
+}
+
+TEST(LoggingNoinit, init_ShouldRecoverRecords_WhenReset) {
+	char buf[16];
+	backend->write("before", 6);
+	backend->write("reset", 5);
+
+	reset();
+
+	LONGS_EQUAL(2, logging_noinit_recovered());
+	LONGS_EQUAL(2, backend->count());
+	LONGS_EQUAL(6, backend->read(buf, sizeof(buf)));
+	MEMCMP_EQUAL("before", buf, 6);
+}
+
+TEST(LoggingNoinit, init_ShouldRecoverRecords_WhenWrappedAround) {
+	char buf[64];
+	memset(buf, 'y', sizeof(buf));
+	for (int i = 0; i < 7; i++) {
+		backend->write(buf, 23);
+	}
+	const size_t count = backend->count();
+	reset();
+	LONGS_EQUAL(count, logging_noinit_recovered());
+}
+
+TEST(LoggingNoinit, init_ShouldClear_WhenHeaderCorrupted) {
+	backend->write("before", 6);
+	noinit[2] ^= 1; /* index */
+	reset();
+	LONGS_EQUAL(0, logging_noinit_recovered());
+	LONGS_EQUAL(0, backend->count());
+}
+
+TEST(LoggingNoinit, init_ShouldClear_WhenRecordChainBroken) {
+	backend->write("before", 6);
+	uint8_t *ring = (uint8_t *)noinit + 24;
+	ring[0] = 7; /* length of the first record */
+	reset();
+	LONGS_EQUAL(0, logging_noinit_recovered());
+}
+
+TEST(LoggingNoinit, replay_ShouldMoveRecordsIntoBackend) {
+	backend->write("first", 5);
+	backend->write("second", 6);
+	reset();
+
+	LONGS_EQUAL(2, logging_noinit_replay(&flash_backend));
+	LONGS_EQUAL(0, backend->count());
+	LONGS_EQUAL(11, persisted_len);
+	MEMCMP_EQUAL("firstsecond", persisted, 11);
+}
+
+TEST(LoggingNoinit, replay_ShouldKeepRecords_WhenBackendFails) {
+	backend->write("first", 5);
+	backend->write("second", 6);
+	persist_limit = 1;
+
+	LONGS_EQUAL(1, logging_noinit_replay(&flash_backend));
+	LONGS_EQUAL(1, backend->count());
+}
+
+TEST(LoggingNoinit, replay_ShouldDropRecord_WhenLargerThanReplayBuffer) {
+	static uint32_t large[64];
+	uint8_t data[LOGGING_NOINIT_REPLAY_BUFSIZE + 1] = { 0, };
+	backend = logging_noinit_init(large, sizeof(large));
+	backend->write(data, sizeof(data));
+	backend->write("ok", 2);
+
+	LONGS_EQUAL(1, logging_noinit_replay(&flash_backend));
+	MEMCMP_EQUAL("ok", persisted, 2);
+	LONGS_EQUAL(0, backend->count());
+}
+
+TEST(LoggingNoinit, init_ShouldClear_WhenOffsetsOutOfRing) {
+	backend->write("before", 6);
+	set_header(UINT32_MAX - 3, UINT32_MAX - 11, 1);
+	reset();
+	LONGS_EQUAL(0, logging_noinit_recovered());
+	LONGS_EQUAL(0, backend->count());
+}
+
+TEST(LoggingNoinit, ShouldKeepRecordsIntact_WhenWrittenAcrossEndOfRing) {
+	const uint32_t capacity = noinit[1];
+	char buf[16];
+
+	/* an empty ring with the offsets right before the end */
+	set_header(capacity - 3, capacity - 3, 0);
+	reset();
+	LONGS_EQUAL(0, logging_noinit_recovered());
+
+	LONGS_EQUAL(7, backend->write("wrapped", 7));
+	LONGS_EQUAL(5, backend->write("after", 5));
+	reset();
+
+	LONGS_EQUAL(2, logging_noinit_recovered());
+	LONGS_EQUAL(7, backend->read(buf, sizeof(buf)));
+	MEMCMP_EQUAL("wrapped", buf, 7);
+	LONGS_EQUAL(5, backend->read(buf, sizeof(buf)));
+	MEMCMP_EQUAL("after", buf, 5);
+}
+
+TEST(LoggingNoinit, ShouldRecoverFullRing_WhenOffsetsMeet) {
+	const uint32_t capacity = noinit[1];
+	char buf[128];
+	const size_t len = capacity - sizeof(uint16_t);
+
+	memset(buf, 'z', sizeof(buf));
+	LONGS_EQUAL(len, backend->write(buf, len));
+	LONGS_EQUAL(noinit[2], noinit[3]);
+	reset();
+
+	LONGS_EQUAL(1, logging_noinit_recovered());
+	LONGS_EQUAL(len, backend->read(buf, sizeof(buf)));
+	LONGS_EQUAL(0, backend->count());
+}
@@ -42,6 +42,13 @@ static struct kvstore fake_kvstore = {
 	},
 };
 
+static int fake_iterate(struct kvstore *self, const char *prefix,
+		kvstore_iterate_cb_t cb, void *ctx) {
+	return mock().actualCall("fake_iterate")
+		.withParameter("prefix", prefix)
+		.returnIntValue();
+}
+
 static void on_iterate(const metricfs_id_t id, const void *data, const size_t datasize, void *ctx) {
 	mock().actualCall("on_iterate").withParameter("id", (metricfs_id_t)id);
 }
@@ -69,6 +76,8 @@ TEST_GROUP(metricfs) {
 		mock().checkExpectations();
 		mock().clear();
 
+		fake_kvstore.api.iterate = NULL;
+
 		metricfs_destroy(fs);
 	}
 
@@ -326,6 +335,53 @@ TEST(metricfs, iterate_ShouldCallCallback_WhenMetricsExist) {
 	LONGS_EQUAL(0, metricfs_iterate(fs, on_iterate, NULL, buf, sizeof(buf), MAX_METRICS));
 }
 
+TEST(metricfs, iterate_ShouldReadEachIdOldestFirst_WhenKVStoreSupportsIteration) {
+	uint8_t buf[8];
+	uint8_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+	expect_index_write("prefix/0", data, sizeof(data));
+	LONGS_EQUAL(0, metricfs_write(fs, data, sizeof(data), NULL));
+	expect_index_write("prefix/1", data, sizeof(data));
+	LONGS_EQUAL(0, metricfs_write(fs, data, sizeof(data), NULL));
+	fake_kvstore.api.iterate = fake_iterate;
+
+	expect_peek("prefix/0", data, sizeof(data));
+	expect_peek("prefix/1", data, sizeof(data));
+	mock().expectOneCall("on_iterate").withParameter("id", 0);
+	mock().expectOneCall("on_iterate").withParameter("id", 1);
+	LONGS_EQUAL(0, metricfs_iterate(fs, on_iterate, NULL, buf, sizeof(buf), MAX_METRICS));
+}
+
+TEST(metricfs, iterate_ShouldReturnEIO_WhenMetricMissing) {
+	uint8_t buf[8];
+	uint8_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+	expect_index_write("prefix/0", data, sizeof(data));
+	LONGS_EQUAL(0, metricfs_write(fs, data, sizeof(data), NULL));
+	expect_index_write("prefix/1", data, sizeof(data));
+	LONGS_EQUAL(0, metricfs_write(fs, data, sizeof(data), NULL));
+	fake_kvstore.api.iterate = fake_iterate;
+
+	mock().expectOneCall("fake_read")
+		.withParameter("key", "prefix/0")
+		.ignoreOtherParameters()
+		.andReturnValue(-ENOENT);
+	expect_peek("prefix/1", data, sizeof(data));
+	mock().expectOneCall("on_iterate").withParameter("id", 1);
+	LONGS_EQUAL(-EIO, metricfs_iterate(fs, on_iterate, NULL, buf, sizeof(buf), MAX_METRICS));
+}
+
+TEST(metricfs, iterate_ShouldVisitOnlyOldest_WhenMaxMetricsGiven) {
+	uint8_t buf[8];
+	uint8_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+	expect_index_write("prefix/0", data, sizeof(data));
+	LONGS_EQUAL(0, metricfs_write(fs, data, sizeof(data), NULL));
+	expect_index_write("prefix/1", data, sizeof(data));
+	LONGS_EQUAL(0, metricfs_write(fs, data, sizeof(data), NULL));
+
+	expect_peek("prefix/0", data, sizeof(data));
+	mock().expectOneCall("on_iterate").withParameter("id", 0);
+	LONGS_EQUAL(0, metricfs_iterate(fs, on_iterate, NULL, buf, sizeof(buf), 1));
+}
+
 TEST(metricfs, clear_ShouldClearAllMetrics_WhenCalled) {
 	uint8_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
 	expect_index_write("prefix/0", data, sizeof(data));
@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "libmcu/metrics.h"
+#include "libmcu/metrics_overrides.h"
+#include "libmcu/metrics_shm.h"
+
+bool sample_battery_voltage(metric_value_t *value)
+{
+	*value = 3700;
+	return true;
+}
+
+static void do_nothing(const metric_key_t key, const metric_value_t value,
+		void *ctx)
+{
+	(void)key;
+	(void)value;
+	(void)ctx;
+}
+
+TEST_GROUP(metrics_shm) {
+	struct metrics_shm shm;
+
+	void setup(void) {
+		metrics_init(true);
+		LONGS_EQUAL(0, metrics_shm_open(&shm, METRICS_SHM_NAME));
+	}
+	void teardown(void) {
+		metrics_shm_close(&shm);
+	}
+
+	uint32_t get_seq(void) {
+		const struct metrics_shm_header *header =
+			(const struct metrics_shm_header *)(const void *)shm.base;
+		return header->seq;
+	}
+};
+
+TEST(metrics_shm, open_ShouldReturnENOENT_WhenNoSegment) {
+	struct metrics_shm other;
+	LONGS_EQUAL(-ENOENT, metrics_shm_open(&other, "/libmcu_metrics_none"));
+}
+
+TEST(metrics_shm, open_ShouldReturnEPROTO_WhenLayoutUnknown) {
+	const char *name = "/libmcu_metrics_bogus";
+	int fd = shm_open(name, O_CREAT | O_RDWR, 0600);
+	CHECK(fd >= 0);
+	CHECK(ftruncate(fd, 4096) == 0);
+	close(fd);
+
+	struct metrics_shm other;
+	LONGS_EQUAL(-EPROTO, metrics_shm_open(&other, name));
+	LONGS_EQUAL(0, metrics_shm_unlink(name));
+}
+
+TEST(metrics_shm, count_ShouldReturnNumberOfMetrics) {
+	LONGS_EQUAL(metrics_count(), metrics_shm_count(&shm));
+}
+
+TEST(metrics_shm, key_string_ShouldReturnKeyString) {
+	STRCMP_EQUAL("ReportInterval",
+			metrics_shm_key_string(&shm, ReportInterval));
+	STRCMP_EQUAL("BatteryVoltage",
+			metrics_shm_key_string(&shm, BatteryVoltage));
+	STRCMP_EQUAL("", metrics_shm_key_string(&shm, 0xffff));
+}
+
+TEST(metrics_shm, get_ShouldReturnValue_WhenSetByWriter) {
+	int32_t value;
+	metrics_set(WallTime, 1234);
+	LONGS_EQUAL(0, metrics_shm_get(&shm, WallTime, &value));
+	LONGS_EQUAL(1234, value);
+	metrics_increase(WallTime);
+	LONGS_EQUAL(0, metrics_shm_get(&shm, WallTime, &value));
+	LONGS_EQUAL(1235, value);
+}
+
+TEST(metrics_shm, get_ShouldReturnENOENT_WhenNotSet) {
+	int32_t value;
+	LONGS_EQUAL(-ENOENT, metrics_shm_get(&shm, WallTime, &value));
+}
+
+TEST(metrics_shm, get_ShouldReturnERANGE_WhenKeyOutOfRange) {
+	int32_t value;
+	LONGS_EQUAL(-ERANGE, metrics_shm_get(&shm,
+			(uint16_t)metrics_count(), &value));
+}
+
+TEST(metrics_shm, get_ShouldReturnSampledGauge_WhenIterated) {
+	int32_t value;
+	LONGS_EQUAL(-ENOENT, metrics_shm_get(&shm, BatteryVoltage, &value));
+	metrics_iterate(do_nothing, NULL);
+	LONGS_EQUAL(0, metrics_shm_get(&shm, BatteryVoltage, &value));
+	LONGS_EQUAL(3700, value);
+}
+
+TEST(metrics_shm, snapshot_ShouldCopyAllMetrics) {
+	struct metrics_shm_value values[16];
+	metrics_set(ReportInterval, 10);
+	metrics_set(HeapHighWaterMark, -20);
+
+	LONGS_EQUAL(metrics_count(),
+			metrics_shm_snapshot(&shm, values, 16));
+	LONGS_EQUAL(ReportInterval, values[ReportInterval].key);
+	CHECK(values[ReportInterval].is_set);
+	LONGS_EQUAL(10, values[ReportInterval].value);
+	CHECK(values[HeapHighWaterMark].is_set);
+	LONGS_EQUAL(-20, values[HeapHighWaterMark].value);
+	CHECK(!values[WallTime].is_set);
+}
+
+TEST(metrics_shm, snapshot_ShouldReturnENOBUFS_WhenBufferTooSmall) {
+	struct metrics_shm_value values[1];
+	LONGS_EQUAL(-ENOBUFS, metrics_shm_snapshot(&shm, values, 1));
+}
+
+TEST(metrics_shm, seq_ShouldBeEven_WhenNotWriting) {
+	uint32_t seq = get_seq();
+	metrics_lock();
+	CHECK(get_seq() & 1);
+	metrics_unlock();
+	LONGS_EQUAL(seq + 2, get_seq());
+}
+
+TEST(metrics_shm, get_ShouldReturnEAGAIN_WhenWriterKeepsWriting) {
+	int32_t value;
+	metrics_set(WallTime, 1);
+	metrics_lock();
+	LONGS_EQUAL(-EAGAIN, metrics_shm_get(&shm, WallTime, &value));
+	metrics_unlock();
+	LONGS_EQUAL(0, metrics_shm_get(&shm, WallTime, &value));
+}
@@ -8,6 +8,7 @@
 #include "CppUTest/TestHarness_c.h"
 #include "libmcu/metrics.h"
 #include <time.h>
+#include <string.h>
 #include "libmcu/logging.h"
 
 #define SAVED_METRICS_LEN		3
@@ -43,6 +44,19 @@ static void print_metric_each(metric_key_t keyid, int32_t value, void *ctx)
 	debug("Metric %02u : %d", keyid, value);
 }
 
+static struct {
+	bool available;
+	metric_value_t value;
+	int called;
+} battery;
+
+bool sample_battery_voltage(metric_value_t *value)
+{
+	battery.called++;
+	*value = battery.value;
+	return battery.available;
+}
+
 static int32_t get_heap_hwm(void)
 {
 	return 1234;
@@ -67,6 +81,7 @@ static void report_periodic(void)
 TEST_GROUP(metrics) {
 	void setup(void) {
 		clear_saved_metrics();
+		memset(&battery, 0, sizeof(battery));
 		metrics_init(true);
 	}
 	void teardown() {
@@ -157,7 +172,7 @@ TEST(metrics, is_set_ShouldReturnFalse_WhenReportIntervalIsNotSet) {
 }
 
 TEST(metrics, count_ShouldReturnNumberOfMetrics) {
-	LONGS_EQUAL(7, metrics_count());
+	LONGS_EQUAL(8, metrics_count());
 }
 
 TEST(metrics, set_if_min_ShouldSetMinValue_WhenNotSet) {
@@ -212,3 +227,48 @@ TEST(metrics, test) {
 	// 2. timer_create(report_periodic, 1hour)
 	report_periodic();
 }
+
+TEST(metrics, gauge_ShouldNotBeSampled_WhenNotCollected) {
+	battery.available = true;
+	metrics_set(ReportInterval, 1);
+	metrics_get(BatteryVoltage);
+	LONGS_EQUAL(0, battery.called);
+	LONGS_EQUAL(false, metrics_is_set(BatteryVoltage));
+}
+
+TEST(metrics, gauge_ShouldBeSampledOnce_WhenCollected) {
+	uint8_t expected_encoded_data[] = { 7, 0, 0, 0, 0x9a, 0x0e, 0, 0, };
+	uint8_t buf[128];
+	battery.available = true;
+	battery.value = 3738;
+	size_t size = metrics_collect(buf, sizeof(buf));
+	LONGS_EQUAL(1, battery.called);
+	LONGS_EQUAL(8, size);
+	MEMCMP_EQUAL(expected_encoded_data, buf, size);
+}
+
+TEST(metrics, gauge_ShouldBeSampled_WhenIterated) {
+	battery.available = true;
+	battery.value = 3700;
+	metrics_iterate(print_metric_each, 0);
+	LONGS_EQUAL(1, battery.called);
+	LONGS_EQUAL(3700, metrics_get(BatteryVoltage));
+}
+
+TEST(metrics, get_ShouldReturnCachedGauge_WhenSampledInLastCycle) {
+	battery.available = true;
+	battery.value = 3700;
+	metrics_iterate(print_metric_each, 0);
+	battery.value = 3600;
+	LONGS_EQUAL(3700, metrics_get(BatteryVoltage));
+	LONGS_EQUAL(1, battery.called);
+}
+
+TEST(metrics, gauge_ShouldNotBeReported_WhenSamplerHasNoValue) {
+	uint8_t buf[128];
+	battery.available = true;
+	metrics_iterate(print_metric_each, 0);
+	battery.available = false;
+	LONGS_EQUAL(0, metrics_collect(buf, sizeof(buf)));
+	LONGS_EQUAL(false, metrics_is_set(BatteryVoltage));
+}
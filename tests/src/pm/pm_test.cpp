@@ -8,10 +8,31 @@
 #include "CppUTest/TestHarness_c.h"
 #include "CppUTestExt/MockSupport.h"
 
+#include <string.h>
+
 #include "libmcu/pm.h"
 #include "libmcu/port/pm.h"
+#include "libmcu/deadline.h"
+#include "libmcu/board.h"
 
 static int cnt;
+static uint64_t time_us;
+static uint64_t sleep_us;
+static uint64_t callback_us;
+static uint32_t next_deadline_ms;
+
+uint64_t board_get_time_since_boot_us(void) {
+	return time_us;
+}
+
+static uint32_t get_next_deadline(void) {
+	return next_deadline_ms;
+}
+
+static void cb_latency(void *ctx) {
+	(void)ctx;
+	time_us += callback_us;
+}
 
 static void cb_1(void *ctx) {
 	int *t = (int *)ctx;
@@ -33,17 +54,26 @@ static void cb_3(void *ctx) {
 
 int pm_port_enter(pm_mode_t mode, uint32_t duration_ms)
 {
-	(void)mode;
-	(void)duration_ms;
-	return 0;
+	time_us += sleep_us;
+	return mock().actualCall(__func__)
+		.withParameter("mode", mode)
+		.withParameter("duration_ms", duration_ms)
+		.returnIntValueOrDefault(0);
 }
 
 TEST_GROUP(PM) {
 	void setup(void) {
 		pm_init();
 		cnt = 0;
+		time_us = 0;
+		sleep_us = 0;
+		callback_us = 0;
+		next_deadline_ms = DEADLINE_NONE;
+		deadline_register(get_next_deadline);
+		mock().ignoreOtherCalls();
 	}
 	void teardown(void) {
+		deadline_unregister(get_next_deadline);
 		mock().checkExpectations();
 		mock().clear();
 	}
@@ -105,3 +135,115 @@ TEST(PM, register_ShouldReturnEXIST_WhenDuplicated) {
 	LONGS_EQUAL(0, pm_register_entry_callback(PM_SLEEP, 0, cb_1, 0));
 	LONGS_EQUAL(-EEXIST, pm_register_entry_callback(PM_SLEEP, 0, cb_1, 0));
 }
+
+TEST(PM, enter_ShouldAccumulateResidency) {
+	struct pm_stats stats;
+	sleep_us = 5000;
+	pm_enter(PM_SLEEP, 5);
+	sleep_us = 100000;
+	pm_enter(PM_SLEEP, 100);
+
+	LONGS_EQUAL(0, pm_get_stats(PM_SLEEP, &stats));
+	LONGS_EQUAL(2, stats.entries);
+	LONGS_EQUAL(105, stats.residency_ms);
+	LONGS_EQUAL(1, stats.residency_hist_ms[3]);
+	LONGS_EQUAL(1, stats.residency_hist_ms[7]);
+}
+
+TEST(PM, enter_ShouldMeasureCallbackLatency) {
+	struct pm_stats stats;
+	callback_us = 300;
+	pm_register_entry_callback(PM_SLEEP_DEEP, 0, cb_latency, 0);
+	pm_register_exit_callback(PM_SLEEP_DEEP, 0, cb_latency, 0);
+	pm_set_latency(PM_SLEEP_DEEP, 1000);
+
+	pm_enter(PM_SLEEP_DEEP, 10);
+
+	pm_get_stats(PM_SLEEP_DEEP, &stats);
+	LONGS_EQUAL(1, stats.entries);
+	LONGS_EQUAL(1600, stats.latency_us);
+	LONGS_EQUAL(1, stats.latency_hist_us[11]);
+}
+
+TEST(PM, enter_ShouldAverageLatency) {
+	struct pm_stats stats;
+	callback_us = 400;
+	pm_register_entry_callback(PM_SLEEP, 0, cb_latency, 0);
+	pm_enter(PM_SLEEP, 0);
+	callback_us = 1200;
+	pm_enter(PM_SLEEP, 0);
+
+	pm_get_stats(PM_SLEEP, &stats);
+	LONGS_EQUAL(500, stats.latency_us);
+}
+
+TEST(PM, get_stats_ShouldReturnEINVAL_WhenInvalidParamGiven) {
+	struct pm_stats stats;
+	LONGS_EQUAL(-EINVAL, pm_get_stats(PM_SLEEP, NULL));
+	LONGS_EQUAL(-EINVAL, pm_get_stats((pm_mode_t)(PM_SHUTDOWN + 1), &stats));
+	LONGS_EQUAL(-EINVAL, pm_set_latency((pm_mode_t)(PM_SHUTDOWN + 1), 0));
+}
+
+TEST(PM, reset_stats_ShouldClearStatsButKeepHardwareLatency) {
+	struct pm_stats stats;
+	pm_set_latency(PM_SLEEP, 100);
+	sleep_us = 1000;
+	pm_enter(PM_SLEEP, 1);
+
+	pm_reset_stats();
+
+	pm_get_stats(PM_SLEEP, &stats);
+	LONGS_EQUAL(0, stats.entries);
+	LONGS_EQUAL(0, stats.residency_ms);
+	LONGS_EQUAL(100, stats.latency_us);
+	LONGS_EQUAL(0, stats.residency_hist_ms[1]);
+}
+
+TEST(PM, select_ShouldReturnDeepestMode_WhenLatencyFits) {
+	pm_set_latency(PM_SLEEP, 50);
+	pm_set_latency(PM_SLEEP_DEEP, 2000);
+
+	LONGS_EQUAL(PM_SLEEP_DEEP, pm_select(2));
+	LONGS_EQUAL(PM_SLEEP_DEEP, pm_select(100));
+}
+
+TEST(PM, select_ShouldReturnShallowerMode_WhenDeepModeTooSlow) {
+	pm_set_latency(PM_SLEEP, 50);
+	pm_set_latency(PM_SLEEP_DEEP, 2000);
+
+	LONGS_EQUAL(PM_SLEEP, pm_select(1));
+	LONGS_EQUAL(PM_SLEEP, pm_select(0));
+}
+
+TEST(PM, select_ShouldTakeMeasuredLatencyIntoAccount) {
+	pm_set_latency(PM_SLEEP_DEEP, 1500);
+	LONGS_EQUAL(PM_SLEEP_DEEP, pm_select(2));
+
+	callback_us = 300;
+	pm_register_entry_callback(PM_SLEEP_DEEP, 0, cb_latency, 0);
+	pm_register_exit_callback(PM_SLEEP_DEEP, 0, cb_latency, 0);
+	pm_enter(PM_SLEEP_DEEP, 0);
+
+	LONGS_EQUAL(PM_SLEEP, pm_select(2));
+}
+
+TEST(PM, idle_ShouldEnterModeFittingNextDeadline) {
+	pm_set_latency(PM_SLEEP_DEEP, 5000);
+	next_deadline_ms = 10;
+	mock().expectOneCall("pm_port_enter")
+		.withParameter("mode", PM_SLEEP_DEEP)
+		.withParameter("duration_ms", 10);
+	LONGS_EQUAL(0, pm_idle());
+
+	next_deadline_ms = 4;
+	mock().expectOneCall("pm_port_enter")
+		.withParameter("mode", PM_SLEEP)
+		.withParameter("duration_ms", 4);
+	LONGS_EQUAL(0, pm_idle());
+}
+
+TEST(PM, idle_ShouldReturnEAGAIN_WhenDeadlineIsDue) {
+	next_deadline_ms = 0;
+	mock().expectNoCall("pm_port_enter");
+	LONGS_EQUAL(-EAGAIN, pm_idle());
+}
@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "libmcu/profiler.h"
+#include "libmcu/trace.h"
+
+static int fake_thread;
+
+void *trace_get_current_thread(void)
+{
+	return &fake_thread;
+}
+
+static __attribute__((noinline)) void burn_cpu(long ms)
+{
+	struct timespec start, now;
+	volatile unsigned long x = 0;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
+	do {
+		for (int i = 0; i < 10000; i++) {
+			x = x + (unsigned long)i;
+		}
+		clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+	} while ((now.tv_sec - start.tv_sec) * 1000 +
+			(now.tv_nsec - start.tv_nsec) / 1000000 < ms);
+}
+
+struct summary {
+	uint32_t samples;
+	uint32_t stacks;
+	uint8_t max_depth;
+	bool named;
+	bool thread;
+};
+
+static void summarize(const struct profiler_stack *stack, void *ctx)
+{
+	struct summary *summary = (struct summary *)ctx;
+
+	summary->samples += stack->count;
+	summary->stacks++;
+	summary->max_depth = stack->depth > summary->max_depth?
+		stack->depth : summary->max_depth;
+	summary->named |= strcmp(stack->thread_name, "prof-test") == 0;
+	summary->thread |= stack->thread == &fake_thread;
+}
+
+static char output[64 * 1024];
+static size_t output_len;
+
+static int writer(const void *data, size_t datasize, void *ctx)
+{
+	if (output_len + datasize >= sizeof(output)) {
+		return -ENOSPC;
+	}
+	memcpy(&output[output_len], data, datasize);
+	output_len += datasize;
+	output[output_len] = '\0';
+	return (int)datasize;
+}
+
+TEST_GROUP(profiler) {
+	void setup(void) {
+		output_len = 0;
+		output[0] = '\0';
+		pthread_setname_np(pthread_self(), "prof-test");
+		profiler_reset();
+	}
+	void teardown(void) {
+		profiler_stop();
+		profiler_unregister_thread();
+	}
+};
+
+TEST(profiler, register_ShouldReturnEALREADY_WhenRegisteredTwice) {
+	LONGS_EQUAL(0, profiler_register_thread());
+	LONGS_EQUAL(-EALREADY, profiler_register_thread());
+}
+
+TEST(profiler, unregister_ShouldReturnENOENT_WhenNotRegistered) {
+	LONGS_EQUAL(-ENOENT, profiler_unregister_thread());
+}
+
+TEST(profiler, start_ShouldReturnEALREADY_WhenRunning) {
+	LONGS_EQUAL(0, profiler_start(100));
+	LONGS_EQUAL(-EALREADY, profiler_start(100));
+}
+
+TEST(profiler, ShouldCollectNothing_WhenNotStarted) {
+	struct summary summary = { 0, };
+
+	LONGS_EQUAL(0, profiler_register_thread());
+	burn_cpu(20);
+	profiler_collect();
+	profiler_iterate(summarize, &summary);
+
+	LONGS_EQUAL(0, summary.samples);
+}
+
+TEST(profiler, ShouldSampleRegisteredThread_WhenRunning) {
+	struct summary summary = { 0, };
+
+	LONGS_EQUAL(0, profiler_register_thread());
+	LONGS_EQUAL(0, profiler_start(1000));
+	burn_cpu(100);
+	profiler_stop();
+	profiler_iterate(summarize, &summary);
+
+	CHECK(summary.samples >= 5);
+	CHECK(summary.stacks < summary.samples);
+	CHECK(summary.max_depth > 1);
+	CHECK(summary.named);
+	CHECK(summary.thread);
+	LONGS_EQUAL(0, profiler_dropped());
+}
+
+TEST(profiler, reset_ShouldClearCollectedStacks) {
+	struct summary summary = { 0, };
+
+	LONGS_EQUAL(0, profiler_register_thread());
+	LONGS_EQUAL(0, profiler_start(1000));
+	burn_cpu(50);
+	profiler_stop();
+	profiler_reset();
+	profiler_iterate(summarize, &summary);
+
+	LONGS_EQUAL(0, summary.samples);
+	LONGS_EQUAL(0, profiler_dropped());
+}
+
+TEST(profiler, export_ShouldWriteFoldedStacks) {
+	LONGS_EQUAL(0, profiler_register_thread());
+	LONGS_EQUAL(0, profiler_start(1000));
+	burn_cpu(50);
+	profiler_stop();
+
+	LONGS_EQUAL(0, profiler_export_folded(writer, NULL));
+	STRNCMP_EQUAL("prof-test;", output, strlen("prof-test;"));
+	CHECK(output[output_len - 1] == '\n');
+}
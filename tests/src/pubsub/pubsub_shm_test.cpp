@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "libmcu/pubsub.h"
+#include "libmcu/pubsub_shm.h"
+
+#define LOOPBACK		"/libmcu_pubsub_test_loop"
+#define A2B			"/libmcu_pubsub_test_a2b"
+#define B2A			"/libmcu_pubsub_test_b2a"
+
+static struct {
+	int count;
+	char topic[PUBSUB_TOPIC_NAME_MAXLEN];
+	uint8_t msg[256];
+	size_t msglen;
+} received;
+
+static void on_message(void *context, const void *msg, size_t msglen) {
+	(void)context;
+	received.count++;
+	strncpy(received.topic, pubsub_topic(), sizeof(received.topic) - 1);
+	memcpy(received.msg, msg, msglen);
+	received.msglen = msglen;
+}
+
+static uint64_t now_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void *publish_later(void *arg) {
+	(void)arg;
+	usleep(10000);
+	pubsub_publish("a/late", "x", 1);
+	return NULL;
+}
+
+TEST_GROUP(pubsub_shm) {
+	struct pubsub_shm *bridge;
+	pubsub_subscribe_t sub;
+
+	void setup(void) {
+		memset(&received, 0, sizeof(received));
+		pubsub_init();
+		pubsub_shm_unlink(LOOPBACK);
+		/* the messages forwarded come back to this process */
+		bridge = pubsub_shm_create(LOOPBACK, LOOPBACK, 256);
+		CHECK(bridge != NULL);
+		LONGS_EQUAL(0, pubsub_shm_forward(bridge, "a/#"));
+		sub = pubsub_subscribe("a/#", on_message, NULL);
+	}
+	void teardown(void) {
+		pubsub_unsubscribe(sub);
+		pubsub_shm_delete(bridge);
+		pubsub_shm_unlink(LOOPBACK);
+		pubsub_deinit();
+	}
+};
+
+TEST(pubsub_shm, create_ShouldReturnNull_WhenCapacityNotPowerOf2) {
+	POINTERS_EQUAL(NULL, pubsub_shm_create(A2B, B2A, 100));
+}
+
+TEST(pubsub_shm, create_ShouldReturnNull_WhenCapacityDiffersFromPeer) {
+	POINTERS_EQUAL(NULL, pubsub_shm_create(LOOPBACK, LOOPBACK, 512));
+}
+
+TEST(pubsub_shm, forward_ShouldReturnENOSPC_WhenFiltersFull) {
+	for (int i = 1; i < PUBSUB_SHM_MAX_FILTERS; i++) {
+		LONGS_EQUAL(0, pubsub_shm_forward(bridge, "b"));
+	}
+	LONGS_EQUAL(-ENOSPC, pubsub_shm_forward(bridge, "b"));
+}
+
+TEST(pubsub_shm, poll_ShouldPublishForwardedMessage) {
+	pubsub_publish("a/b", "hello", 5);
+	LONGS_EQUAL(1, received.count);
+
+	LONGS_EQUAL(1, pubsub_shm_poll(bridge, 0));
+	LONGS_EQUAL(2, received.count);
+	STRCMP_EQUAL("a/b", received.topic);
+	LONGS_EQUAL(5, received.msglen);
+	MEMCMP_EQUAL("hello", received.msg, 5);
+}
+
+TEST(pubsub_shm, poll_ShouldNotForwardBack_WhenPublishedFromRing) {
+	pubsub_publish("a/b", "hello", 5);
+	LONGS_EQUAL(1, pubsub_shm_poll(bridge, 0));
+	LONGS_EQUAL(0, pubsub_shm_poll(bridge, 0));
+	LONGS_EQUAL(2, received.count);
+}
+
+TEST(pubsub_shm, poll_ShouldReturnZero_WhenTopicNotForwarded) {
+	pubsub_publish("b/a", "hello", 5);
+	LONGS_EQUAL(0, pubsub_shm_poll(bridge, 0));
+}
+
+TEST(pubsub_shm, poll_ShouldPublishEmptyMessage) {
+	pubsub_publish("a/empty", NULL, 0);
+	LONGS_EQUAL(1, pubsub_shm_poll(bridge, 0));
+	LONGS_EQUAL(0, received.msglen);
+}
+
+TEST(pubsub_shm, poll_ShouldReturnZero_WhenTimedOut) {
+	uint64_t t0 = now_ns();
+	LONGS_EQUAL(0, pubsub_shm_poll(bridge, 20));
+	CHECK(now_ns() - t0 >= 20000000ULL);
+}
+
+TEST(pubsub_shm, poll_ShouldWakeUp_WhenPublishedWhileWaiting) {
+	pthread_t thread;
+	pthread_create(&thread, NULL, publish_later, NULL);
+	LONGS_EQUAL(1, pubsub_shm_poll(bridge, -1));
+	pthread_join(thread, NULL);
+	STRCMP_EQUAL("a/late", received.topic);
+}
+
+TEST(pubsub_shm, publish_ShouldDrop_WhenMessageTooLarge) {
+	uint8_t msg[128] = { 0, };
+	pubsub_publish("a/b", msg, sizeof(msg));
+	LONGS_EQUAL(1, pubsub_shm_dropped(bridge));
+	LONGS_EQUAL(0, pubsub_shm_poll(bridge, 0));
+}
+
+TEST(pubsub_shm, publish_ShouldDrop_WhenRingFull) {
+	uint8_t msg[64] = { 0, };
+	for (int i = 0; i < 3; i++) {
+		pubsub_publish("a/b", msg, sizeof(msg));
+	}
+	LONGS_EQUAL(1, pubsub_shm_dropped(bridge));
+	LONGS_EQUAL(2, pubsub_shm_poll(bridge, 0));
+}
+
+TEST(pubsub_shm, poll_ShouldKeepMessagesIntact_WhenWrappedAround) {
+	char msg[64];
+	for (int i = 0; i < 100; i++) {
+		int len = snprintf(msg, sizeof(msg), "message %d", i * 7919);
+		pubsub_publish("a/wrap", msg, (size_t)len);
+		LONGS_EQUAL(1, pubsub_shm_poll(bridge, 0));
+		LONGS_EQUAL(len, received.msglen);
+		MEMCMP_EQUAL(msg, received.msg, (size_t)len);
+	}
+	LONGS_EQUAL(0, pubsub_shm_dropped(bridge));
+}
+
+#define ROUNDS			10000
+
+static void ping_pong(const char *tx, const char *rx, const char *out,
+		const char *in, bool initiate) {
+	struct pubsub_shm *b = pubsub_shm_create(tx, rx, 4096);
+	CHECK(b != NULL);
+	pubsub_shm_forward(b, out);
+	pubsub_subscribe_t s = pubsub_subscribe(in, on_message, NULL);
+
+	for (int i = 0; i < ROUNDS; i++) {
+		if (initiate) {
+			pubsub_publish(out, &i, sizeof(i));
+		}
+		while (pubsub_shm_poll(b, -1) == 0) {
+		}
+		if (!initiate) {
+			pubsub_publish(out, &i, sizeof(i));
+		}
+	}
+
+	pubsub_unsubscribe(s);
+	pubsub_shm_delete(b);
+}
+
+TEST(pubsub_shm, poll_ShouldReceiveFromAnotherProcess) {
+	pubsub_shm_unlink(A2B);
+	pubsub_shm_unlink(B2A);
+
+	pid_t pid = fork();
+	if (pid == 0) {
+		ping_pong(B2A, A2B, "pong", "ping", false);
+		_exit(0);
+	}
+
+	uint64_t t0 = now_ns();
+	ping_pong(A2B, B2A, "ping", "pong", true);
+	uint64_t elapsed = now_ns() - t0;
+
+	int status;
+	waitpid(pid, &status, 0);
+	LONGS_EQUAL(0, WEXITSTATUS(status));
+	LONGS_EQUAL(ROUNDS, received.count);
+	printf("\n\tround trip %.2f us\n", (double)elapsed / ROUNDS / 1000.0);
+
+	pubsub_shm_unlink(A2B);
+	pubsub_shm_unlink(B2A);
+}
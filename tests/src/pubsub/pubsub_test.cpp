@@ -343,6 +343,22 @@ TEST(PubSub, publish_wildcardExtraTest) {
 	pubsub_unsubscribe(sub);
 }
 
+static void topic_callback(void *context, const void *msg, size_t msglen) {
+	(void)msg;
+	(void)msglen;
+	*(const char **)context = pubsub_topic();
+}
+
+TEST(PubSub, topic_ShouldReturnPublishedTopic_WhenCalledInCallback) {
+	const char *topic = NULL;
+	pubsub_subscribe_t sub = pubsub_subscribe("group/#",
+			topic_callback, &topic);
+	pubsub_publish(testopic, "x", 1);
+	STRCMP_EQUAL(testopic, topic);
+	POINTERS_EQUAL(NULL, pubsub_topic());
+	pubsub_unsubscribe(sub);
+}
+
 TEST(PubSub, stringify_ShouldReturnStrings_WhenErrorCodeGiven) {
 	STRCMP_EQUAL("success", pubsub_stringify_error(PUBSUB_SUCCESS));
 	STRCMP_EQUAL("error", pubsub_stringify_error(PUBSUB_ERROR));
@@ -8,6 +8,7 @@
 #include "CppUTest/TestHarness_c.h"
 #include <string.h>
 #include "libmcu/pubsub.h"
+#include "libmcu/pubsub_static.h"
 
 static const char *topic = "default/name";
 
@@ -21,12 +22,27 @@ static void callback(void *context, const void *msg, size_t msglen)
 	memcpy(message_spy, msg, msglen);
 }
 
+static const char static_topic[] = "static/topic";
+static int static_callback_count;
+static void *static_context_spy;
+static void static_callback(void *context, const void *msg, size_t msglen)
+{
+	static_callback_count++;
+	static_context_spy = context;
+	callback(NULL, msg, msglen);
+}
+
+PUBSUB_STATIC_SUBSCRIBE(static_topic, static_callback, (void *)1);
+PUBSUB_STATIC_SUBSCRIBE(static_topic, static_callback, (void *)2);
+
 TEST_GROUP(PubSub) {
 	void setup(void) {
 		pubsub_init();
 		pubsub_create(topic);
 
 		callback_count = 0;
+		static_callback_count = 0;
+		static_context_spy = NULL;
 		message_length_spy = 0;
 		memset(message_spy, 0, sizeof(message_spy));
 	}
@@ -195,3 +211,34 @@ TEST(PubSub, stringify_ShouldReturnStrings_WhenErrorCodeGiven) {
 	STRCMP_EQUAL("no exist subscriber",
 			pubsub_stringify_error(PUBSUB_NO_EXIST_SUBSCRIBER));
 }
+
+TEST(PubSub, publish_ShouldCallStaticSubscribers_WhenTopicNotCreated) {
+	LONGS_EQUAL(PUBSUB_SUCCESS, pubsub_publish(static_topic, "msg", 3));
+	LONGS_EQUAL(2, static_callback_count);
+	POINTERS_EQUAL((void *)2, static_context_spy);
+	MEMCMP_EQUAL("msg", message_spy, 3);
+}
+
+TEST(PubSub, publish_ShouldCallBothStaticAndDynamicSubscribers) {
+	pubsub_create(static_topic);
+	pubsub_subscribe_t sub = pubsub_subscribe(static_topic, callback, NULL);
+	LONGS_EQUAL(PUBSUB_SUCCESS, pubsub_publish(static_topic, "msg", 3));
+	LONGS_EQUAL(2, static_callback_count);
+	LONGS_EQUAL(3, callback_count);
+	pubsub_unsubscribe(sub);
+	pubsub_destroy(static_topic);
+}
+
+TEST(PubSub, publish_ShouldNotCallStaticSubscribers_WhenOtherTopicGiven) {
+	pubsub_publish(topic, "msg", 3);
+	LONGS_EQUAL(0, static_callback_count);
+}
+
+TEST(PubSub, count_ShouldIncludeStaticSubscribers) {
+	LONGS_EQUAL(2, pubsub_count(static_topic));
+	pubsub_create(static_topic);
+	pubsub_subscribe_t sub = pubsub_subscribe(static_topic, callback, NULL);
+	LONGS_EQUAL(3, pubsub_count(static_topic));
+	pubsub_unsubscribe(sub);
+	pubsub_destroy(static_topic);
+}
@@ -0,0 +1,195 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "libmcu/posix_sim.h"
+#include "libmcu/board.h"
+#include "libmcu/deadline.h"
+
+#define EPOCH			1767225600ULL
+
+static unsigned long period_ms;
+static unsigned long next_ms;
+
+static uint32_t get_next_deadline(void) {
+	const unsigned long now = board_get_time_since_boot_ms();
+	return next_ms > now? (uint32_t)(next_ms - now) : 0;
+}
+
+struct sleeper {
+	pthread_t thread;
+	uint32_t sleep_ms;
+	struct sim_event *ev;
+	int err;
+	unsigned long woken_ms;
+	struct sim_event registered;
+};
+
+static void *sleeper_thread(void *arg) {
+	struct sleeper *p = (struct sleeper *)arg;
+
+	sim_thread_register();
+	sim_event_signal(&p->registered);
+
+	if (p->ev) {
+		p->err = sim_event_wait(p->ev, p->sleep_ms);
+	} else {
+		p->err = sim_sleep_ms(p->sleep_ms);
+	}
+	p->woken_ms = board_get_time_since_boot_ms();
+
+	sim_thread_unregister();
+	return NULL;
+}
+
+TEST_GROUP(Sim) {
+	void setup(void) {
+		sim_init(EPOCH);
+		sim_thread_register();
+		period_ms = 0;
+		next_ms = 0;
+	}
+	void teardown(void) {
+		deadline_unregister(get_next_deadline);
+		sim_thread_unregister();
+	}
+
+	void start(struct sleeper *p, uint32_t ms, struct sim_event *ev) {
+		*p = (struct sleeper) { .sleep_ms = ms, .ev = ev, };
+		pthread_create(&p->thread, NULL, sleeper_thread, p);
+		/* unregistered waiting, so the clock does not move */
+		while (!p->registered.signaled) {
+			sched_yield();
+		}
+	}
+};
+
+TEST(Sim, time_ShouldStartFromBootAndEpoch) {
+	LONGS_EQUAL(0, board_get_time_since_boot_ms());
+	LONGS_EQUAL(EPOCH, time(NULL));
+}
+
+TEST(Sim, sleep_ShouldAdvanceClockWithoutWaiting) {
+	const unsigned long eight_hours_ms = 8UL * 3600 * 1000;
+
+	for (unsigned long i = 0; i < eight_hours_ms / 1000; i++) {
+		LONGS_EQUAL(0, sim_sleep_ms(1000));
+	}
+
+	LONGS_EQUAL(eight_hours_ms, board_get_time_since_boot_ms());
+	LONGS_EQUAL(eight_hours_ms * 1000, board_get_time_since_boot_us());
+	LONGS_EQUAL(EPOCH + 8 * 3600, time(NULL));
+}
+
+TEST(Sim, sleep_ShouldReturnEPERM_WhenThreadNotRegistered) {
+	sim_thread_unregister();
+	LONGS_EQUAL(-EPERM, sim_sleep_ms(1));
+	LONGS_EQUAL(-EPERM, sim_advance(1));
+	LONGS_EQUAL(-ENOENT, sim_thread_unregister());
+	sim_thread_register();
+	LONGS_EQUAL(-EALREADY, sim_thread_register());
+}
+
+TEST(Sim, advance_ShouldJumpToNextDeadline) {
+	next_ms = 1234;
+	deadline_register(get_next_deadline);
+
+	LONGS_EQUAL(1234, sim_advance(UINT32_MAX));
+	LONGS_EQUAL(1234, board_get_time_since_boot_ms());
+}
+
+TEST(Sim, advance_ShouldReturnZero_WhenDeadlineIsDue) {
+	next_ms = 0;
+	deadline_register(get_next_deadline);
+
+	LONGS_EQUAL(0, sim_advance(UINT32_MAX));
+	LONGS_EQUAL(0, board_get_time_since_boot_ms());
+}
+
+TEST(Sim, advance_ShouldStopAtMax_WhenDeadlineIsLater) {
+	next_ms = 5000;
+	deadline_register(get_next_deadline);
+
+	LONGS_EQUAL(1000, sim_advance(1000));
+	LONGS_EQUAL(1000, board_get_time_since_boot_ms());
+}
+
+TEST(Sim, advance_ShouldRunPeriodicDeadlinesOvernight) {
+	const unsigned long twelve_hours_ms = 12UL * 3600 * 1000;
+	unsigned long fired = 0;
+
+	period_ms = 100;
+	next_ms = period_ms;
+	deadline_register(get_next_deadline);
+
+	while (board_get_time_since_boot_ms() < twelve_hours_ms) {
+		sim_advance(UINT32_MAX);
+		if (board_get_time_since_boot_ms() >= next_ms) {
+			next_ms += period_ms;
+			fired++;
+		}
+	}
+
+	LONGS_EQUAL(twelve_hours_ms / period_ms, fired);
+}
+
+TEST(Sim, sleep_ShouldWakeThreadsInOrderOfDeadline) {
+	struct sleeper a, b;
+	start(&a, 300, NULL);
+	start(&b, 100, NULL);
+
+	sim_sleep_ms(200);
+	LONGS_EQUAL(200, board_get_time_since_boot_ms());
+
+	sim_sleep_ms(200);
+	pthread_join(a.thread, NULL);
+	pthread_join(b.thread, NULL);
+
+	LONGS_EQUAL(100, b.woken_ms);
+	LONGS_EQUAL(300, a.woken_ms);
+	LONGS_EQUAL(400, board_get_time_since_boot_ms());
+}
+
+TEST(Sim, event_ShouldWakeWaiter_WhenSignaled) {
+	struct sim_event ev = { false };
+	struct sleeper a;
+	start(&a, 1000, &ev);
+
+	sim_sleep_ms(10);
+	sim_event_signal(&ev);
+	sim_thread_unregister();
+	pthread_join(a.thread, NULL);
+	sim_thread_register();
+
+	LONGS_EQUAL(0, a.err);
+	LONGS_EQUAL(10, a.woken_ms);
+}
+
+TEST(Sim, event_ShouldReturnETIMEDOUT_WhenNotSignaled) {
+	struct sim_event ev = { false };
+	struct sleeper a;
+	start(&a, 1000, &ev);
+
+	sim_sleep_ms(5000);
+	pthread_join(a.thread, NULL);
+
+	LONGS_EQUAL(-ETIMEDOUT, a.err);
+	LONGS_EQUAL(1000, a.woken_ms);
+}
+
+TEST(Sim, event_ShouldReturnImmediately_WhenSignaledBeforeWait) {
+	struct sim_event ev = { false };
+	sim_event_signal(&ev);
+	LONGS_EQUAL(0, sim_event_wait(&ev, 1000));
+	LONGS_EQUAL(0, board_get_time_since_boot_ms());
+	LONGS_EQUAL(-ETIMEDOUT, sim_event_wait(&ev, 1000));
+}
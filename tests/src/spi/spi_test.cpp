@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+#include "CppUTestExt/MockSupport.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include "libmcu/spi.h"
+
+static void done_cb(struct spi_device *dev, int err, void *ctx) {
+	mock().actualCall(__func__)
+		.withPointerParameter("dev", dev)
+		.withIntParameter("err", err)
+		.withPointerParameter("ctx", ctx);
+}
+
+TEST_GROUP(SPI) {
+	struct spi_device *dev;
+
+	void setup(void) {
+		dev = spi_create_device(spi_create(0, NULL), SPI_MODE_0, 1000000, 0);
+		mock().strictOrder();
+	}
+	void teardown(void) {
+		mock().checkExpectations();
+		mock().clear();
+	}
+};
+
+TEST(SPI, submit_ShouldReturnEINVAL_WhenInvalidParamsGiven) {
+	LONGS_EQUAL(-EINVAL, spi_submit(NULL, NULL, 0, done_cb, NULL));
+	LONGS_EQUAL(-EINVAL, spi_submit(dev, NULL, 1, done_cb, NULL));
+}
+
+TEST(SPI, submit_ShouldCallDoneCallback_WhenEmptyListGiven) {
+	mock().expectOneCall("done_cb").withPointerParameter("dev", dev)
+		.withIntParameter("err", 0).withPointerParameter("ctx", this);
+	LONGS_EQUAL(0, spi_submit(dev, NULL, 0, done_cb, this));
+}
+
+TEST(SPI, submit_ShouldPerformTransfersInOrder) {
+	const uint8_t cmd[] = { 0x9f };
+	const uint8_t addr[] = { 0x03, 0x00, 0x10, 0x00 };
+	const uint8_t data[] = { 0xde, 0xad };
+	const uint8_t expected_id[] = { 0xef, 0x40, 0x18 };
+	const uint8_t expected_payload[] = { 1, 2, 3, 4 };
+	uint8_t id[3];
+	uint8_t payload[4];
+	const struct spi_xfer xfers[] = {
+		{ .tx = cmd, .tx_len = sizeof(cmd), .rx = id, .rx_len = sizeof(id) },
+		{ .tx = data, .tx_len = sizeof(data), },
+		{ .tx = addr, .tx_len = sizeof(addr), },
+		{ .rx = payload, .rx_len = sizeof(payload) },
+	};
+
+	mock().expectOneCall("spi_writeread").withPointerParameter("self", dev)
+		.withMemoryBufferParameter("txdata", cmd, sizeof(cmd))
+		.withOutputParameterReturning("rxbuf", expected_id, sizeof(expected_id))
+		.withUnsignedIntParameter("rxbuf_len", sizeof(id));
+	mock().expectOneCall("spi_write").withPointerParameter("self", dev)
+		.withMemoryBufferParameter("data", data, sizeof(data));
+	mock().expectOneCall("spi_write").withPointerParameter("self", dev)
+		.withMemoryBufferParameter("data", addr, sizeof(addr));
+	mock().expectOneCall("spi_read").withPointerParameter("self", dev)
+		.withOutputParameterReturning("buf", expected_payload, sizeof(expected_payload))
+		.withUnsignedIntParameter("rx_len", sizeof(payload));
+	mock().expectOneCall("done_cb").withPointerParameter("dev", dev)
+		.withIntParameter("err", 0).withPointerParameter("ctx", NULL);
+
+	LONGS_EQUAL(0, spi_submit(dev, xfers, 4, done_cb, NULL));
+	MEMCMP_EQUAL(expected_id, id, sizeof(id));
+	MEMCMP_EQUAL(expected_payload, payload, sizeof(payload));
+}
+
+TEST(SPI, submit_ShouldStopAndReportError_WhenTransferFails) {
+	const uint8_t data[] = { 0x01, 0x02 };
+	const struct spi_xfer xfers[] = {
+		{ .tx = data, .tx_len = 1, },
+		{ .tx = &data[1], .tx_len = 1, },
+		{ .tx = data, .tx_len = sizeof(data), },
+	};
+
+	mock().expectOneCall("spi_write").withPointerParameter("self", dev)
+		.withMemoryBufferParameter("data", data, 1);
+	mock().expectOneCall("spi_write").withPointerParameter("self", dev)
+		.withMemoryBufferParameter("data", &data[1], 1)
+		.andReturnValue(-EIO);
+	mock().expectOneCall("done_cb").withPointerParameter("dev", dev)
+		.withIntParameter("err", -EIO).withPointerParameter("ctx", NULL);
+
+	LONGS_EQUAL(0, spi_submit(dev, xfers, 3, done_cb, NULL));
+}
+
+TEST(SPI, submit_ShouldSkipEmptyTransfer) {
+	const uint8_t data[] = { 0x01 };
+	const struct spi_xfer xfers[] = {
+		{ .tx = NULL, .tx_len = 0, },
+		{ .tx = data, .tx_len = sizeof(data), },
+	};
+
+	mock().expectOneCall("spi_write").withPointerParameter("self", dev)
+		.withMemoryBufferParameter("data", data, sizeof(data));
+
+	LONGS_EQUAL(0, spi_submit(dev, xfers, 2, NULL, NULL));
+}
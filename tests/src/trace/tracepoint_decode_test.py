@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+
+import importlib.util
+import os
+import unittest
+
+path = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                    "../../../tools/scripts/tracepoint_decode.py")
+spec = importlib.util.spec_from_file_location("tracepoint_decode", path)
+decode = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(decode)
+
+
+def dump(*records):
+    return b"".join(decode.RECORD.pack(ts, 0, id, cpu, 0, 0)
+                    for ts, id, cpu in records)
+
+
+def timestamps(records):
+    return [(r[0], r[4]) for r in records]
+
+
+class TracepointDecodeTest(unittest.TestCase):
+    def test_unpack_ShouldKeepOrder_WhenTimestampsIncrease(self):
+        records = decode.unpack(dump((10, 0, 0), (20, 1, 0), (30, 2, 0)))
+        self.assertEqual([(10, 0), (20, 1), (30, 2)], timestamps(records))
+
+    def test_unpack_ShouldUnwrap_WhenCounterWrapsAround(self):
+        records = decode.unpack(dump((0xfffffff0, 0, 0), (0x10, 1, 0)))
+        self.assertEqual([(0xfffffff0, 0), (0x100000010, 1)],
+                         timestamps(records))
+
+    def test_unpack_ShouldNotUnwrap_WhenTimestampSlightlyInverted(self):
+        records = decode.unpack(dump((100, 0, 0), (98, 1, 0), (105, 2, 0)))
+        self.assertEqual([(98, 1), (100, 0), (105, 2)], timestamps(records))
+
+    def test_unpack_ShouldNotUnwrap_WhenInvertedAcrossWrap(self):
+        records = decode.unpack(dump((0xfffffffe, 0, 0), (0x2, 1, 0),
+                                     (0xffffffff, 2, 0), (0x3, 3, 0)))
+        self.assertEqual([(0xfffffffe, 0), (0xffffffff, 2),
+                          (0x100000002, 1), (0x100000003, 3)],
+                         timestamps(records))
+
+    def test_unpack_ShouldUnwrapPerCpu(self):
+        records = decode.unpack(dump((0xfffffff0, 0, 0), (5, 1, 1),
+                                     (0x10, 2, 0), (6, 3, 1)))
+        self.assertEqual([(5, 1), (6, 3), (0xfffffff0, 0), (0x100000010, 2)],
+                         timestamps(records))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <errno.h>
+#include <string.h>
+#include "libmcu/tracepoint.h"
+#include "libmcu/trace.h"
+#include "libmcu/board.h"
+
+static uint32_t fake_time;
+static unsigned int fake_cpu;
+
+uint64_t board_get_time_since_boot_us(void) {
+	return 0;
+}
+void *trace_get_current_thread(void) {
+	return (void *)(uintptr_t)0x1234;
+}
+uint32_t tracepoint_get_time(void) {
+	return fake_time++;
+}
+unsigned int tracepoint_get_cpu(void) {
+	return fake_cpu;
+}
+
+static struct tracepoint_record records[TRACEPOINT_BUFFER_LEN *
+		TRACEPOINT_MAX_CPUS];
+static size_t nr_records;
+
+static void collect(const struct tracepoint_record *rec, void *ctx) {
+	(void)ctx;
+	records[nr_records++] = *rec;
+}
+
+static uint8_t output[256];
+static size_t output_len;
+static int write_output(const void *data, size_t datasize, void *ctx) {
+	int *budget = (int *)ctx;
+	if (budget && (*budget)-- <= 0) {
+		return -ENOSPC;
+	}
+	memcpy(&output[output_len], data, datasize);
+	output_len += datasize;
+	return (int)datasize;
+}
+
+TEST_GROUP(tracepoint) {
+	void setup(void) {
+		fake_time = 0;
+		fake_cpu = 0;
+		nr_records = 0;
+		output_len = 0;
+		tracepoint_disable(~0U);
+		tracepoint_clear();
+	}
+	void teardown(void) {
+	}
+};
+
+TEST(tracepoint, ShouldRecordNothing_WhenCategoryDisabled) {
+	TRACEPOINT(PacketRx, 1, 2);
+	LONGS_EQUAL(0, tracepoint_iterate(collect, NULL));
+}
+
+TEST(tracepoint, ShouldRecordEvent_WhenCategoryEnabled) {
+	tracepoint_enable(TRACEPOINT_CATEGORY(0));
+	fake_time = 100;
+
+	TRACEPOINT(PacketRx, 1, -1);
+
+	LONGS_EQUAL(1, tracepoint_iterate(collect, NULL));
+	LONGS_EQUAL(100, records[0].timestamp);
+	LONGS_EQUAL(0x1234, records[0].thread);
+	LONGS_EQUAL(PacketRx, records[0].id);
+	LONGS_EQUAL(0, records[0].cpu);
+	LONGS_EQUAL(1, records[0].a);
+	LONGS_EQUAL(0xffffffff, records[0].b);
+}
+
+TEST(tracepoint, ShouldRecordOnlyEnabledCategories) {
+	tracepoint_enable(TRACEPOINT_CATEGORY(2));
+
+	TRACEPOINT(PacketRx, 0, 0);
+	TRACEPOINT(FlushStart, 0, 0);
+	TRACEPOINT(StateChange, 0, 0);
+	TRACEPOINT(FlushEnd, 0, 0);
+
+	LONGS_EQUAL(2, tracepoint_iterate(collect, NULL));
+	LONGS_EQUAL(FlushStart, records[0].id);
+	LONGS_EQUAL(FlushEnd, records[1].id);
+}
+
+TEST(tracepoint, disable_ShouldLeaveOtherCategoriesEnabled) {
+	tracepoint_enable(TRACEPOINT_CATEGORY(0) | TRACEPOINT_CATEGORY(1));
+	tracepoint_disable(TRACEPOINT_CATEGORY(0));
+
+	LONGS_EQUAL(TRACEPOINT_CATEGORY(1), tracepoint_categories);
+}
+
+TEST(tracepoint, ShouldKeepLatestRecords_WhenOverflowed) {
+	tracepoint_enable(TRACEPOINT_CATEGORY(1));
+
+	for (uint32_t i = 0; i < TRACEPOINT_BUFFER_LEN + 3; i++) {
+		TRACEPOINT(StateChange, i, 0);
+	}
+
+	LONGS_EQUAL(TRACEPOINT_BUFFER_LEN, tracepoint_iterate(collect, NULL));
+	LONGS_EQUAL(3, records[0].a);
+	LONGS_EQUAL(TRACEPOINT_BUFFER_LEN + 2,
+			records[TRACEPOINT_BUFFER_LEN - 1].a);
+}
+
+TEST(tracepoint, ShouldKeepRecordsPerCpu) {
+	tracepoint_enable(TRACEPOINT_CATEGORY(0));
+
+	TRACEPOINT(PacketRx, 0, 0);
+	fake_cpu = 1;
+	TRACEPOINT(PacketRx, 1, 0);
+	fake_cpu = 0;
+	TRACEPOINT(PacketRx, 2, 0);
+
+	LONGS_EQUAL(3, tracepoint_iterate(collect, NULL));
+	LONGS_EQUAL(0, records[0].a);
+	LONGS_EQUAL(2, records[1].a);
+	LONGS_EQUAL(1, records[2].a);
+	LONGS_EQUAL(1, records[2].cpu);
+}
+
+TEST(tracepoint, clear_ShouldDropRecordsSoFar) {
+	tracepoint_enable(TRACEPOINT_CATEGORY(0));
+
+	TRACEPOINT(PacketRx, 1, 0);
+	tracepoint_clear();
+	TRACEPOINT(PacketRx, 2, 0);
+
+	LONGS_EQUAL(1, tracepoint_iterate(collect, NULL));
+	LONGS_EQUAL(2, records[0].a);
+}
+
+TEST(tracepoint, emit_ShouldRecord_RegardlessOfCategory) {
+	tracepoint_emit(FlushEnd, 7, 8);
+	LONGS_EQUAL(1, tracepoint_iterate(NULL, NULL));
+}
+
+TEST(tracepoint, export_ShouldWriteRecordsAsInMemory) {
+	tracepoint_enable(TRACEPOINT_CATEGORY(0) | TRACEPOINT_CATEGORY(1));
+
+	TRACEPOINT(PacketRx, 1, 2);
+	TRACEPOINT(StateChange, 3, 4);
+	tracepoint_iterate(collect, NULL);
+
+	LONGS_EQUAL(0, tracepoint_export(write_output, NULL));
+	LONGS_EQUAL(2 * sizeof(struct tracepoint_record), output_len);
+	MEMCMP_EQUAL(records, output, output_len);
+}
+
+TEST(tracepoint, export_ShouldReturnWriterError_WhenWriterFails) {
+	int budget = 1;
+	tracepoint_enable(TRACEPOINT_CATEGORY(0));
+
+	TRACEPOINT(PacketRx, 1, 2);
+	TRACEPOINT(PacketRx, 3, 4);
+
+	LONGS_EQUAL(-ENOSPC, tracepoint_export(write_output, &budget));
+	LONGS_EQUAL(sizeof(struct tracepoint_record), output_len);
+}
+
+TEST(tracepoint, name_ShouldReturnNameOfEvent) {
+	STRCMP_EQUAL("PacketRx", tracepoint_name(PacketRx));
+	STRCMP_EQUAL("FlushEnd", tracepoint_name(FlushEnd));
+	POINTERS_EQUAL(NULL, tracepoint_name(FlushEnd + 1));
+}
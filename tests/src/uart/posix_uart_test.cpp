@@ -0,0 +1,234 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <atomic>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "libmcu/posix_uart.h"
+#include "libmcu/uart_rx.h"
+#include "libmcu/board.h"
+
+/* the port over a pseudo terminal, with the test playing the peer on the
+ * slave side */
+
+unsigned long board_get_time_since_boot_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long)ts.tv_sec * 1000UL
+		+ (unsigned long)ts.tv_nsec / 1000000UL;
+}
+
+static std::atomic<int> nr_callbacks;
+
+static void on_rx(struct uart *self, void *ctx) {
+	nr_callbacks++;
+}
+
+TEST_GROUP(PosixUart) {
+	struct uart *uart;
+	int peer;
+
+	void setup(void) {
+		struct uart_config config = {
+			.baudrate = 115200,
+			.databit = 8,
+			.parity = UART_PARITY_NONE,
+			.stopbit = UART_STOPBIT_1,
+			.flowctrl = UART_FLOWCTRL_NONE,
+			.rx_timeout_ms = 1000,
+		};
+
+		nr_callbacks = 0;
+
+		uart = uart_create(1, NULL);
+		CHECK(uart != NULL);
+		LONGS_EQUAL(0, uart_configure(uart, &config));
+		LONGS_EQUAL(0, uart_register_rx_callback(uart, on_rx, NULL));
+		LONGS_EQUAL(0, uart_enable(uart, 115200));
+
+		peer = open(posix_uart_name(uart), O_RDWR | O_NOCTTY);
+		CHECK(peer >= 0);
+	}
+	void teardown(void) {
+		if (peer >= 0) {
+			close(peer);
+		}
+		uart_delete(uart);
+	}
+
+	void peer_write(const char *str) {
+		LONGS_EQUAL(strlen(str), write(peer, str, strlen(str)));
+	}
+	size_t read_exactly(void *buf, size_t len) {
+		size_t received = 0;
+		int n;
+
+		while (received < len && (n = uart_read(uart,
+				(uint8_t *)buf + received, len - received)) > 0) {
+			received += (size_t)n;
+		}
+
+		return received;
+	}
+	size_t wait_for_frame(void) {
+		struct uart_rx *rx = uart_rx_get(uart);
+		size_t len = 0;
+
+		for (int i = 0; i < 100 && (len = uart_rx_frame(rx)) == 0; i++) {
+			usleep(10000);
+		}
+
+		return len;
+	}
+	void check_frame(const char *expected) {
+		struct uart_rx *rx = uart_rx_get(uart);
+		char frame[32];
+		const size_t len = wait_for_frame();
+
+		LONGS_EQUAL(strlen(expected), len);
+		LONGS_EQUAL(len, uart_rx_read(rx, frame, len));
+		MEMCMP_EQUAL(expected, frame, len);
+	}
+};
+
+TEST(PosixUart, enable_ShouldOpenPseudoTerminal) {
+	STRNCMP_EQUAL("/dev/pts/", posix_uart_name(uart), 9);
+	LONGS_EQUAL(-EALREADY, uart_enable(uart, 115200));
+}
+
+TEST(PosixUart, read_ShouldReceiveBytes_WhenPeerWrites) {
+	char buf[16] = { 0, };
+	peer_write("hello");
+	LONGS_EQUAL(5, read_exactly(buf, 5));
+	STRCMP_EQUAL("hello", buf);
+	CHECK(nr_callbacks > 0);
+}
+
+TEST(PosixUart, read_ShouldReturnZero_WhenNothingReceivedInTimeout) {
+	struct uart_config config = {
+		.baudrate = 115200,
+		.databit = 8,
+		.rx_timeout_ms = 50,
+	};
+	char buf[4];
+	LONGS_EQUAL(0, uart_configure(uart, &config));
+	LONGS_EQUAL(0, uart_read(uart, buf, sizeof(buf)));
+}
+
+TEST(PosixUart, read_ShouldKeepOrder_WhenLargerThanReadChunk) {
+	static uint8_t tx[10000];
+	static uint8_t rx[sizeof(tx)];
+	for (size_t i = 0; i < sizeof(tx); i++) {
+		tx[i] = (uint8_t)(i * 7);
+	}
+
+	size_t sent = 0;
+	size_t received = 0;
+	while (received < sizeof(rx)) {
+		if (sent < sizeof(tx)) {
+			const ssize_t n = write(peer, &tx[sent], sizeof(tx) - sent);
+			CHECK(n > 0);
+			sent += (size_t)n;
+		}
+		const int n = uart_read(uart, &rx[received],
+				sizeof(rx) - received);
+		CHECK(n > 0);
+		received += (size_t)n;
+	}
+
+	MEMCMP_EQUAL(tx, rx, sizeof(tx));
+}
+
+TEST(PosixUart, write_ShouldReachPeer) {
+	struct pollfd pfd = { .fd = peer, .events = POLLIN, };
+	char buf[16] = { 0, };
+	size_t received = 0;
+
+	LONGS_EQUAL(5, uart_write(uart, "world", 5));
+	LONGS_EQUAL(0, uart_flush(uart));
+
+	while (received < 5 && poll(&pfd, 1, 1000) == 1) {
+		const ssize_t n = read(peer, &buf[received], sizeof(buf) - received);
+		CHECK(n > 0);
+		received += (size_t)n;
+	}
+
+	LONGS_EQUAL(5, received);
+	STRCMP_EQUAL("world", buf);
+}
+
+TEST(PosixUart, frame_ShouldEndWithDelimiter) {
+	const struct uart_rx_param param = {
+		.use_delimiter = true,
+		.delimiter = '\n',
+	};
+	uart_rx_configure(uart_rx_get(uart), &param);
+
+	peer_write("ab\ncde\nf");
+	check_frame("ab\n");
+	check_frame("cde\n");
+	LONGS_EQUAL(0, uart_rx_frame(uart_rx_get(uart)));
+}
+
+TEST(PosixUart, frame_ShouldEndWithIdleGap) {
+	const struct uart_rx_param param = {
+		.idle_gap_ms = 20,
+	};
+	uart_rx_configure(uart_rx_get(uart), &param);
+
+	peer_write("xyz");
+	check_frame("xyz");
+	/* once for the bytes and once more for the idle gap */
+	CHECK(nr_callbacks >= 2);
+}
+
+TEST(PosixUart, clear_ShouldDiscardReceivedBytes) {
+	char buf[4];
+	peer_write("abc");
+	LONGS_EQUAL(1, read_exactly(buf, 1));
+	for (int i = 0; i < 100 && uart_rx_length(uart_rx_get(uart)) < 2; i++) {
+		usleep(10000);
+	}
+	LONGS_EQUAL(2, uart_rx_length(uart_rx_get(uart)));
+	LONGS_EQUAL(0, uart_clear(uart));
+	LONGS_EQUAL(0, uart_rx_length(uart_rx_get(uart)));
+}
+
+TEST(PosixUart, disable_ShouldStopReaderAndCloseTerminal) {
+	struct pollfd pfd = { .fd = peer, .events = POLLIN, };
+	char buf[4];
+
+	LONGS_EQUAL(0, uart_disable(uart));
+	LONGS_EQUAL(-EALREADY, uart_disable(uart));
+	LONGS_EQUAL(-EPIPE, uart_read(uart, buf, sizeof(buf)));
+	LONGS_EQUAL(-EPIPE, uart_write(uart, "a", 1));
+
+	LONGS_EQUAL(1, poll(&pfd, 1, 1000));
+	CHECK(pfd.revents & POLLHUP);
+}
+
+TEST(PosixUart, enable_ShouldWorkAgain_WhenDisabled) {
+	char buf[8] = { 0, };
+
+	LONGS_EQUAL(0, uart_disable(uart));
+	close(peer);
+
+	LONGS_EQUAL(0, uart_enable(uart, 115200));
+	peer = open(posix_uart_name(uart), O_RDWR | O_NOCTTY);
+	CHECK(peer >= 0);
+
+	peer_write("again");
+	LONGS_EQUAL(5, read_exactly(buf, 5));
+	STRCMP_EQUAL("again", buf);
+}
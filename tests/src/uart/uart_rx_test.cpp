@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Kyunghwan Kwon <k@mononn.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/TestHarness_c.h"
+
+#include <string.h>
+
+#include "libmcu/uart_rx.h"
+#include "libmcu/board.h"
+
+static unsigned long time_ms;
+
+unsigned long board_get_time_since_boot_ms(void) {
+	return time_ms;
+}
+
+TEST_GROUP(UartRx) {
+	struct uart_rx rx;
+	uint8_t buf[32];
+
+	void setup(void) {
+		time_ms = 0;
+	}
+	void teardown(void) {
+	}
+
+	void init(uint32_t idle_gap_ms, bool use_delimiter, uint8_t delimiter) {
+		struct uart_rx_param param = {
+			.idle_gap_ms = idle_gap_ms,
+			.use_delimiter = use_delimiter,
+			.delimiter = delimiter,
+		};
+		LONGS_EQUAL(0, uart_rx_init(&rx, buf, sizeof(buf), &param));
+	}
+	void push(const char *str) {
+		uart_rx_push(&rx, str, strlen(str));
+	}
+	void check_frame(const char *expected) {
+		char frame[sizeof(buf)];
+		const size_t len = uart_rx_frame(&rx);
+		LONGS_EQUAL(strlen(expected), len);
+		LONGS_EQUAL(len, uart_rx_read(&rx, frame, len));
+		MEMCMP_EQUAL(expected, frame, len);
+	}
+};
+
+TEST(UartRx, init_ShouldReturnEINVAL_WhenInvalidParamsGiven) {
+	LONGS_EQUAL(-EINVAL, uart_rx_init(NULL, buf, sizeof(buf), NULL));
+	LONGS_EQUAL(-EINVAL, uart_rx_init(&rx, NULL, sizeof(buf), NULL));
+	LONGS_EQUAL(-EINVAL, uart_rx_init(&rx, buf, 0, NULL));
+}
+
+TEST(UartRx, peek_ShouldGiveBytesInPlace) {
+	size_t contiguous;
+	init(0, false, 0);
+	push("hello");
+	const void *p = uart_rx_peek(&rx, 0, &contiguous);
+	LONGS_EQUAL(5, contiguous);
+	MEMCMP_EQUAL("hello", p, 5);
+	POINTERS_EQUAL(&buf[0], p);
+	uart_rx_consume(&rx, 5);
+	LONGS_EQUAL(0, uart_rx_length(&rx));
+}
+
+TEST(UartRx, peek_ShouldGiveContiguousPart_WhenWrappedAround) {
+	size_t contiguous;
+	uint8_t tmp[30] = { 0, };
+	init(0, false, 0);
+	uart_rx_push(&rx, tmp, sizeof(tmp));
+	uart_rx_consume(&rx, sizeof(tmp));
+	push("abcd");
+	const void *p = uart_rx_peek(&rx, 0, &contiguous);
+	LONGS_EQUAL(2, contiguous);
+	MEMCMP_EQUAL("ab", p, 2);
+	p = uart_rx_peek(&rx, 2, &contiguous);
+	LONGS_EQUAL(2, contiguous);
+	MEMCMP_EQUAL("cd", p, 2);
+}
+
+TEST(UartRx, push_ShouldCountOverrun_WhenRingIsFull) {
+	struct uart_rx_stats stats;
+	uint8_t tmp[40] = { 0, };
+	init(0, false, 0);
+	LONGS_EQUAL(32, uart_rx_push(&rx, tmp, sizeof(tmp)));
+	LONGS_EQUAL(0, uart_rx_push(&rx, tmp, 1));
+	uart_rx_get_stats(&rx, &stats);
+	LONGS_EQUAL(32, stats.received);
+	LONGS_EQUAL(9, stats.dropped);
+	LONGS_EQUAL(2, stats.overruns);
+	LONGS_EQUAL(32, stats.high_water);
+}
+
+TEST(UartRx, high_water_ShouldKeepMaximum) {
+	struct uart_rx_stats stats;
+	init(0, false, 0);
+	push("0123456789");
+	uart_rx_consume(&rx, 10);
+	push("01");
+	uart_rx_get_stats(&rx, &stats);
+	LONGS_EQUAL(10, stats.high_water);
+	uart_rx_reset_stats(&rx);
+	uart_rx_get_stats(&rx, &stats);
+	LONGS_EQUAL(0, stats.high_water);
+}
+
+TEST(UartRx, frame_ShouldReturnZero_WhenNoFramingConfigured) {
+	init(0, false, 0);
+	push("hello\n");
+	LONGS_EQUAL(0, uart_rx_frame(&rx));
+}
+
+TEST(UartRx, frame_ShouldSplitByDelimiter) {
+	init(0, true, '\n');
+	push("help\nver");
+	check_frame("help\n");
+	LONGS_EQUAL(0, uart_rx_frame(&rx));
+	push("sion\n");
+	check_frame("version\n");
+}
+
+TEST(UartRx, frame_ShouldFindDelimiter_WhenFrameWrapsAround) {
+	uint8_t tmp[28] = { 0, };
+	init(0, true, 0);
+	uart_rx_push(&rx, tmp, sizeof(tmp));
+	uart_rx_consume(&rx, sizeof(tmp));
+	uart_rx_push(&rx, "abcdef\0", 7);
+	LONGS_EQUAL(7, uart_rx_frame(&rx));
+}
+
+TEST(UartRx, frame_ShouldCompleteOnIdleGap) {
+	init(5, false, 0);
+	push("abc");
+	time_ms = 4;
+	LONGS_EQUAL(0, uart_rx_frame(&rx));
+	time_ms = 5;
+	check_frame("abc");
+}
+
+TEST(UartRx, frame_ShouldSeparateBursts_WhenReadLate) {
+	init(5, false, 0);
+	push("first");
+	time_ms = 10;
+	push("second");
+	time_ms = 11;
+	push("!");
+	check_frame("first");
+	LONGS_EQUAL(0, uart_rx_frame(&rx));
+	time_ms = 16;
+	check_frame("second!");
+}
+
+TEST(UartRx, frame_ShouldPreferDelimiter_WhenBothConfigured) {
+	init(5, true, ';');
+	push("a;b");
+	check_frame("a;");
+	LONGS_EQUAL(0, uart_rx_frame(&rx));
+	time_ms = 5;
+	check_frame("b");
+}
+
+TEST(UartRx, frame_ShouldIgnoreStaleIdleMark_WhenAlreadyConsumed) {
+	init(5, false, 0);
+	push("abc");
+	time_ms = 5;
+	check_frame("abc");
+	push("def");
+	time_ms = 6;
+	LONGS_EQUAL(0, uart_rx_frame(&rx));
+	time_ms = 10;
+	check_frame("def");
+}
+
+TEST(UartRx, clear_ShouldDiscardAll) {
+	init(0, true, '\n');
+	push("abc");
+	LONGS_EQUAL(0, uart_rx_frame(&rx));
+	uart_rx_clear(&rx);
+	LONGS_EQUAL(0, uart_rx_length(&rx));
+	push("d\n");
+	check_frame("d\n");
+}
+
+TEST(UartRx, get_ShouldReturnNull_WhenPortDoesNotOverride) {
+	POINTERS_EQUAL(NULL, uart_rx_get(NULL));
+}
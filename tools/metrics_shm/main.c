@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: 2026 권경환 Kyunghwan Kwon <k@libmcu.org>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "libmcu/metrics_shm.h"
+
+enum format {
+	FORMAT_TEXT,
+	FORMAT_JSON,
+	FORMAT_PROMETHEUS,
+};
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "Usage: %s [-n name] [-a] [-f text|json|prom]\n"
+			"  -n name  shared memory segment (default: %s)\n"
+			"  -a       include the metrics not set\n"
+			"  -f fmt   output format (default: text)\n",
+			prog, METRICS_SHM_NAME);
+}
+
+static const char *get_name(const struct metrics_shm *shm, uint16_t key,
+		char *buf, size_t bufsize)
+{
+	const char *name = metrics_shm_key_string(shm, key);
+
+	if (name[0] == '\0') {
+		snprintf(buf, bufsize, "metric_%u", key);
+		return buf;
+	}
+
+	return name;
+}
+
+static void print(const struct metrics_shm *shm,
+		const struct metrics_shm_value *values, size_t n,
+		enum format format, int all)
+{
+	const char *sep = "";
+	char buf[32];
+
+	if (format == FORMAT_JSON) {
+		printf("{");
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		const struct metrics_shm_value *v = &values[i];
+		const char *name = get_name(shm, v->key, buf, sizeof(buf));
+
+		if (!v->is_set && !all) {
+			continue;
+		}
+
+		switch (format) {
+		case FORMAT_JSON:
+			if (v->is_set) {
+				printf("%s\"%s\":%ld", sep, name, (long)v->value);
+			} else {
+				printf("%s\"%s\":null", sep, name);
+			}
+			sep = ",";
+			break;
+		case FORMAT_PROMETHEUS:
+			if (v->is_set) {
+				printf("libmcu_%s %ld\n", name, (long)v->value);
+			}
+			break;
+		case FORMAT_TEXT: /* fall through */
+		default:
+			if (v->is_set) {
+				printf("%s %ld\n", name, (long)v->value);
+			} else {
+				printf("%s -\n", name);
+			}
+			break;
+		}
+	}
+
+	if (format == FORMAT_JSON) {
+		printf("}\n");
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	const char *name = METRICS_SHM_NAME;
+	enum format format = FORMAT_TEXT;
+	int all = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "n:af:h")) != -1) {
+		switch (opt) {
+		case 'n':
+			name = optarg;
+			break;
+		case 'a':
+			all = 1;
+			break;
+		case 'f':
+			if (strcmp(optarg, "json") == 0) {
+				format = FORMAT_JSON;
+			} else if (strcmp(optarg, "prom") == 0) {
+				format = FORMAT_PROMETHEUS;
+			} else if (strcmp(optarg, "text") == 0) {
+				format = FORMAT_TEXT;
+			} else {
+				usage(argv[0]);
+				return EXIT_FAILURE;
+			}
+			break;
+		default:
+			usage(argv[0]);
+			return opt == 'h'? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+
+	struct metrics_shm shm;
+	int err = metrics_shm_open(&shm, name);
+
+	if (err < 0) {
+		fprintf(stderr, "%s: %s\n", name, strerror(-err));
+		return EXIT_FAILURE;
+	}
+
+	const size_t n = metrics_shm_count(&shm);
+	struct metrics_shm_value *values = malloc(n * sizeof(*values) + 1);
+
+	if (values == NULL) {
+		err = -ENOMEM;
+	} else if ((err = metrics_shm_snapshot(&shm, values, n)) >= 0) {
+		print(&shm, values, n, format, all);
+	}
+
+	free(values);
+	metrics_shm_close(&shm);
+
+	if (err < 0) {
+		fprintf(stderr, "%s: %s\n", name, strerror(-err));
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+
+"""Compare two benchmark runs written by `tests/bench/build/bench -o`.
+
+Exits with 1 when any benchmark got slower than the threshold or started
+allocating more, so that it can be used as a CI gate.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        return {b["name"]: b for b in json.load(f)["benchmarks"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("-t", "--threshold", type=float, default=10.0,
+                        help="regression threshold in percent (default 10)")
+    parser.add_argument("-m", "--metric", default="p50_ns",
+                        help="latency metric to compare (default p50_ns)")
+    args = parser.parse_args()
+
+    base = load(args.baseline)
+    curr = load(args.current)
+    regressions = 0
+
+    print("{:<36} {:>12} {:>12} {:>9}  {}".format(
+        "benchmark", "baseline", "current", "delta", ""))
+
+    for name in sorted(set(base) | set(curr)):
+        if name not in base or name not in curr:
+            print("{:<36} {:>12} {:>12} {:>9}  {}".format(
+                name, "-" if name not in base else "", "-" if name not in curr
+                else "", "", "added" if name not in base else "removed"))
+            continue
+
+        b = base[name][args.metric]
+        c = curr[name][args.metric]
+        delta = (c - b) / b * 100.0 if b else 0.0
+        allocs = (base[name]["allocs_per_op"], curr[name]["allocs_per_op"])
+        regressed = delta > args.threshold or allocs[1] > allocs[0]
+        notes = []
+
+        if delta > args.threshold:
+            notes.append("REGRESSION")
+        elif delta < -args.threshold:
+            notes.append("improved")
+        if allocs[1] > allocs[0]:
+            notes.append("ALLOCS {:.2f} -> {:.2f}".format(*allocs))
+
+        regressions += regressed
+
+        print("{:<36} {:>12.1f} {:>12.1f} {:>+8.1f}%  {}".format(
+            name, b, c, delta, " ".join(notes)))
+
+    if regressions:
+        print("\n{} regression(s) beyond {:.1f}%".format(
+            regressions, args.threshold))
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+
+"""Turn the records written by tracepoint_export() into a timeline.
+
+usage: tracepoint_decode.py [-d tracepoints.def] [-t NS] [--json] [dump]
+
+Records of each CPU come oldest first, so a timestamp going backwards by more
+than half the 32-bit range is taken as the counter wrapping around. A smaller
+step backwards is a record written by an interrupt or another thread between
+reserving its slot and reading the clock, and is kept as it is. The records
+of all CPUs are merged by time afterwards. With --json, the output is in the Chrome trace event format
+to be loaded in chrome://tracing or Perfetto.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+RECORD = struct.Struct("<LLHHLL") # timestamp, thread, id, cpu, a, b
+
+
+def load_names(path):
+    names = {}
+    pattern = re.compile(r"^\s*TRACEPOINT_DEFINE\(\s*(\w+)\s*,")
+    with open(path) as f:
+        for line in f:
+            m = pattern.match(line)
+            if m:
+                names[len(names)] = m.group(1)
+    return names
+
+
+def unpack(stream):
+    records = []
+    last = {}
+    for i in range(len(stream) // RECORD.size):
+        ts, thread, id, cpu, a, b = RECORD.unpack_from(stream, i * RECORD.size)
+        prev = last.get(cpu)
+        if prev is None:
+            full = ts
+        else:
+            # the shortest way around the 32-bit circle from the previous
+            # one, so that a slightly older timestamp written right after a
+            # newer one by an interrupt is not taken as a wrap
+            full = prev + ((ts - prev + (1 << 31)) % (1 << 32)) - (1 << 31)
+        last[cpu] = full
+        records.append((full, cpu, i, thread, id, a, b))
+    records.sort()
+    return records
+
+
+def print_timeline(records, names, tick_ns):
+    start = records[0][0] if records else 0
+    prev = start
+    for ts, cpu, _, thread, id, a, b in records:
+        print("{t:14.3f}us {d:+12.3f}us cpu{cpu} {thread:#010x} {name} "
+              "a={a:#x} b={b:#x}".format(
+                  t=(ts - start) * tick_ns / 1000,
+                  d=(ts - prev) * tick_ns / 1000,
+                  cpu=cpu, thread=thread,
+                  name=names.get(id, "#{}".format(id)), a=a, b=b))
+        prev = ts
+
+
+def print_json(records, names, tick_ns):
+    events = [{
+        "name": names.get(id, "#{}".format(id)),
+        "ph": "i",
+        "s": "t",
+        "ts": ts * tick_ns / 1000,
+        "pid": cpu,
+        "tid": thread,
+        "args": {"a": a, "b": b},
+    } for ts, cpu, _, thread, id, a, b in records]
+    json.dump({"traceEvents": events}, sys.stdout, indent=1)
+    print()
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("dump", nargs="?", help="binary dump, stdin if omitted")
+    parser.add_argument("-d", "--defs", help="definition file for event names")
+    parser.add_argument("-t", "--tick-ns", type=float, default=1000,
+                        help="nanoseconds per timestamp tick (default: 1000)")
+    parser.add_argument("--json", action="store_true",
+                        help="output in the Chrome trace event format")
+    args = parser.parse_args()
+
+    if args.dump:
+        with open(args.dump, "rb") as f:
+            stream = f.read()
+    else:
+        stream = sys.stdin.buffer.read()
+
+    names = load_names(args.defs) if args.defs else {}
+    records = unpack(stream)
+
+    if args.json:
+        print_json(records, names, args.tick_ns)
+    else:
+        print_timeline(records, names, args.tick_ns)